@@ -0,0 +1,942 @@
+/*
+ * Windows NT access check plan functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_access_check_plan.h"
+#include "libfwnt_access_control_entry.h"
+#include "libfwnt_access_control_list.h"
+#include "libfwnt_access_token.h"
+#include "libfwnt_allocator.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_types.h"
+#include "libfwnt_well_known_security_identifier.h"
+
+/* Creates an access check plan
+ * Make sure the value access_check_plan is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_initialize(
+     libfwnt_access_check_plan_t **access_check_plan,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_check_plan_t *internal_access_check_plan = NULL;
+	static char *function                                            = "libfwnt_access_check_plan_initialize";
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_check_plan != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access check plan value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_check_plan = libfwnt_allocator_allocate_structure(
+	                              libfwnt_internal_access_check_plan_t );
+
+	if( internal_access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_access_check_plan,
+	     0,
+	     sizeof( libfwnt_internal_access_check_plan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access check plan.",
+		 function );
+
+		libfwnt_allocator_free(
+		 internal_access_check_plan );
+
+		return( -1 );
+	}
+	/* A plan that has not been compiled behaves as an empty discretionary ACL
+	 */
+	internal_access_check_plan->owner_rights_index = -1;
+
+	*access_check_plan = (libfwnt_access_check_plan_t *) internal_access_check_plan;
+
+	return( 1 );
+}
+
+/* Frees an access check plan
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_free(
+     libfwnt_access_check_plan_t **access_check_plan,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_check_plan_t *internal_access_check_plan = NULL;
+	static char *function                                            = "libfwnt_access_check_plan_free";
+	int result                                                       = 1;
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_check_plan != NULL )
+	{
+		internal_access_check_plan = (libfwnt_internal_access_check_plan_t *) *access_check_plan;
+		*access_check_plan         = NULL;
+
+		if( libfwnt_internal_access_check_plan_clear(
+		     internal_access_check_plan,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear access check plan.",
+			 function );
+
+			result = -1;
+		}
+		libfwnt_allocator_free(
+		 internal_access_check_plan );
+	}
+	return( result );
+}
+
+/* Clears an access check plan
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_check_plan_clear(
+     libfwnt_internal_access_check_plan_t *internal_access_check_plan,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_access_check_plan_clear";
+
+	if( internal_access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_check_plan->security_identifiers != NULL )
+	{
+		libfwnt_allocator_free(
+		 internal_access_check_plan->security_identifiers );
+	}
+	if( internal_access_check_plan->hashes != NULL )
+	{
+		libfwnt_allocator_free(
+		 internal_access_check_plan->hashes );
+	}
+	if( internal_access_check_plan->entries != NULL )
+	{
+		libfwnt_allocator_free(
+		 internal_access_check_plan->entries );
+	}
+	if( memory_set(
+	     internal_access_check_plan,
+	     0,
+	     sizeof( libfwnt_internal_access_check_plan_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_check_plan->owner_rights_index = -1;
+
+	return( 1 );
+}
+
+/* Compiles a discretionary ACL into the access check plan
+ * A discretionary ACL of NULL represents a security descriptor without a discretionary ACL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_check_plan_compile(
+     libfwnt_internal_access_check_plan_t *internal_access_check_plan,
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     libfwnt_internal_security_identifier_t *owner_security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_access_check_plan_entry_t *plan_entry                          = NULL;
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	libfwnt_internal_security_identifier_t *internal_security_identifier   = NULL;
+	static char *function                                                  = "libfwnt_internal_access_check_plan_compile";
+	uint64_t hash                                                          = 0;
+	uint32_t access_mask                                                   = 0;
+	uint8_t is_allowed                                                     = 0;
+	int entry_index                                                        = 0;
+	int security_identifier_index                                          = 0;
+
+	if( internal_access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_check_plan_clear(
+	     internal_access_check_plan,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( owner_security_identifier != NULL )
+	{
+		if( libfwnt_internal_security_identifier_copy_values(
+		     &( internal_access_check_plan->owner_security_identifier ),
+		     owner_security_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy owner security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		internal_access_check_plan->owner_hash = libfwnt_internal_security_identifier_get_hash(
+		                                          owner_security_identifier );
+
+		internal_access_check_plan->has_owner_security_identifier = 1;
+	}
+	if( internal_access_control_list == NULL )
+	{
+		internal_access_check_plan->flags |= LIBFWNT_ACCESS_CHECK_PLAN_FLAG_NO_DISCRETIONARY_ACL;
+
+		return( 1 );
+	}
+	if( internal_access_control_list->number_of_entries == 0 )
+	{
+		return( 1 );
+	}
+	/* Every access control entry adds at most 1 security identifier and 1 plan entry
+	 */
+	internal_access_check_plan->security_identifiers = (libfwnt_internal_security_identifier_t *) libfwnt_allocator_allocate(
+	                                                                                                sizeof( libfwnt_internal_security_identifier_t ) * internal_access_control_list->number_of_entries );
+
+	if( internal_access_check_plan->security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security identifiers.",
+		 function );
+
+		goto on_error;
+	}
+	internal_access_check_plan->hashes = (uint64_t *) libfwnt_allocator_allocate(
+	                                                    sizeof( uint64_t ) * internal_access_control_list->number_of_entries );
+
+	if( internal_access_check_plan->hashes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hashes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_access_check_plan->entries = (libfwnt_access_check_plan_entry_t *) libfwnt_allocator_allocate(
+	                                                                             sizeof( libfwnt_access_check_plan_entry_t ) * internal_access_control_list->number_of_entries );
+
+	if( internal_access_check_plan->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_access_control_list->number_of_entries;
+	     entry_index++ )
+	{
+		internal_access_control_entry = internal_access_control_list->entries[ entry_index ];
+
+		if( ( internal_access_control_entry->flags & LIBFWNT_ACE_FLAG_INHERIT_ONLY ) != 0 )
+		{
+			continue;
+		}
+		switch( internal_access_control_entry->type )
+		{
+			case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_OBJECT:
+				internal_access_check_plan->flags |= LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_OBJECT_ENTRIES;
+				break;
+
+			case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK:
+				internal_access_check_plan->flags |= LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_CALLBACK_ENTRIES;
+				break;
+
+			case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+				internal_access_check_plan->flags |= LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_OBJECT_ENTRIES
+				                                   | LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_CALLBACK_ENTRIES;
+				break;
+
+			default:
+				break;
+		}
+		internal_security_identifier = (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier;
+
+		if( internal_security_identifier == NULL )
+		{
+			continue;
+		}
+		if( libfwnt_well_known_security_identifier_get_type(
+		     internal_security_identifier ) == LIBFWNT_WELL_KNOWN_SID_OWNER_RIGHTS )
+		{
+			internal_access_check_plan->flags |= LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_OWNER_RIGHTS;
+		}
+		/* The entry types are evaluated the same way as libfwnt_internal_access_control_list_check_access
+		 */
+		switch( internal_access_control_entry->type )
+		{
+			case LIBFWNT_ACCESS_ALLOWED:
+				is_allowed = 1;
+				break;
+
+			case LIBFWNT_ACCESS_DENIED:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK:
+				is_allowed = 0;
+				break;
+
+			default:
+				continue;
+		}
+		if( internal_access_control_entry->access_mask == 0 )
+		{
+			continue;
+		}
+		hash = libfwnt_internal_security_identifier_get_hash(
+		        internal_security_identifier );
+
+		for( security_identifier_index = 0;
+		     security_identifier_index < internal_access_check_plan->number_of_security_identifiers;
+		     security_identifier_index++ )
+		{
+			if( ( internal_access_check_plan->hashes[ security_identifier_index ] == hash )
+			 && ( libfwnt_security_identifier_is_equal(
+			       (libfwnt_security_identifier_t *) &( internal_access_check_plan->security_identifiers[ security_identifier_index ] ),
+			       (libfwnt_security_identifier_t *) internal_security_identifier,
+			       NULL ) == 1 ) )
+			{
+				break;
+			}
+		}
+		if( security_identifier_index >= internal_access_check_plan->number_of_security_identifiers )
+		{
+			if( libfwnt_internal_security_identifier_copy_values(
+			     &( internal_access_check_plan->security_identifiers[ security_identifier_index ] ),
+			     internal_security_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy security identifier: %d.",
+				 function,
+				 security_identifier_index );
+
+				goto on_error;
+			}
+			internal_access_check_plan->hashes[ security_identifier_index ] = hash;
+
+			internal_access_check_plan->number_of_security_identifiers += 1;
+
+			if( libfwnt_well_known_security_identifier_get_type(
+			     internal_security_identifier ) == LIBFWNT_WELL_KNOWN_SID_OWNER_RIGHTS )
+			{
+				internal_access_check_plan->owner_rights_index = security_identifier_index;
+			}
+		}
+		plan_entry = NULL;
+
+		if( internal_access_check_plan->number_of_entries > 0 )
+		{
+			plan_entry = &( internal_access_check_plan->entries[ internal_access_check_plan->number_of_entries - 1 ] );
+
+			if( plan_entry->security_identifier_index != security_identifier_index )
+			{
+				plan_entry = NULL;
+			}
+		}
+		if( plan_entry == NULL )
+		{
+			plan_entry = &( internal_access_check_plan->entries[ internal_access_check_plan->number_of_entries ] );
+
+			plan_entry->security_identifier_index = security_identifier_index;
+			plan_entry->allowed_access            = 0;
+			plan_entry->denied_access             = 0;
+
+			internal_access_check_plan->number_of_entries += 1;
+		}
+		/* Consecutive entries of the same security identifier either all apply or none apply
+		 * hence only the access rights not decided by a previous entry of the run are added
+		 */
+		access_mask = internal_access_control_entry->access_mask & ~( plan_entry->allowed_access | plan_entry->denied_access );
+
+		if( is_allowed != 0 )
+		{
+			plan_entry->allowed_access |= access_mask;
+		}
+		else
+		{
+			plan_entry->denied_access |= access_mask;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libfwnt_internal_access_check_plan_clear(
+	 internal_access_check_plan,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Compiles a discretionary ACL into the access check plan
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_compile_access_control_list(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_access_control_list_t *access_control_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_check_plan_compile_access_control_list";
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_check_plan_compile(
+	     (libfwnt_internal_access_check_plan_t *) access_check_plan,
+	     (libfwnt_internal_access_control_list_t *) access_control_list,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile access control list.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compiles the discretionary ACL and owner of a security descriptor into the access check plan
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_compile_security_descriptor(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_access_check_plan_compile_security_descriptor";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_check_plan_compile(
+	     (libfwnt_internal_access_check_plan_t *) access_check_plan,
+	     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl,
+	     (libfwnt_internal_security_identifier_t *) internal_security_descriptor->owner_sid,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to compile security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_get_flags(
+     libfwnt_access_check_plan_t *access_check_plan,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_check_plan_t *internal_access_check_plan = NULL;
+	static char *function                                            = "libfwnt_access_check_plan_get_flags";
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_check_plan = (libfwnt_internal_access_check_plan_t *) access_check_plan;
+
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	*flags = internal_access_check_plan->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of (deduplicated) security identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_get_number_of_security_identifiers(
+     libfwnt_access_check_plan_t *access_check_plan,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_check_plan_t *internal_access_check_plan = NULL;
+	static char *function                                            = "libfwnt_access_check_plan_get_number_of_security_identifiers";
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_check_plan = (libfwnt_internal_access_check_plan_t *) access_check_plan;
+
+	if( number_of_security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_security_identifiers = internal_access_check_plan->number_of_security_identifiers;
+
+	return( 1 );
+}
+
+/* Retrieves the number of plan entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_get_number_of_entries(
+     libfwnt_access_check_plan_t *access_check_plan,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_check_plan_t *internal_access_check_plan = NULL;
+	static char *function                                            = "libfwnt_access_check_plan_get_number_of_entries";
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_check_plan = (libfwnt_internal_access_check_plan_t *) access_check_plan;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = internal_access_check_plan->number_of_entries;
+
+	return( 1 );
+}
+
+/* Determines the access granted to an access token by the access check plan
+ * The result is the same as libfwnt_security_descriptor_check_access for the compiled security descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_check_access(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_access_token_t *access_token,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error )
+{
+	libfwnt_access_check_plan_entry_t *plan_entry                    = NULL;
+	libfwnt_internal_access_check_plan_t *internal_access_check_plan = NULL;
+	libfwnt_internal_access_token_t *internal_access_token           = NULL;
+	static char *function                                            = "libfwnt_access_check_plan_check_access";
+	uint64_t checked_security_identifiers                            = 0;
+	uint64_t matched_security_identifiers                            = 0;
+	uint64_t security_identifier_bit                                 = 0;
+	uint32_t allowed_access                                          = 0;
+	uint32_t denied_access                                           = 0;
+	uint32_t entry_allowed_access                                    = 0;
+	uint32_t entry_denied_access                                     = 0;
+	uint8_t is_owner                                                 = 0;
+	uint8_t maximum_allowed                                          = 0;
+	int entry_index                                                  = 0;
+	int result                                                       = 0;
+	int security_identifier_index                                    = 0;
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_check_plan = (libfwnt_internal_access_check_plan_t *) access_check_plan;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = (libfwnt_internal_access_token_t *) access_token;
+
+	if( granted_access == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( desired_access & LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED ) != 0 )
+	{
+		maximum_allowed = 1;
+		desired_access &= ~( (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED );
+	}
+	if( ( internal_access_check_plan->flags & LIBFWNT_ACCESS_CHECK_PLAN_FLAG_NO_DISCRETIONARY_ACL ) != 0 )
+	{
+		if( maximum_allowed != 0 )
+		{
+			/* All standard and object specific access rights
+			 */
+			desired_access |= 0x001fffffUL;
+		}
+		*granted_access = desired_access;
+
+		return( 1 );
+	}
+	if( ( internal_access_check_plan->has_owner_security_identifier != 0 )
+	 && ( internal_access_token->number_of_security_identifiers > 0 ) )
+	{
+		if( libfwnt_internal_access_token_find(
+		     internal_access_token,
+		     &( internal_access_check_plan->owner_security_identifier ),
+		     internal_access_check_plan->owner_hash,
+		     NULL ) != -1 )
+		{
+			is_owner = 1;
+		}
+	}
+	if( ( is_owner != 0 )
+	 && ( ( internal_access_check_plan->flags & LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_OWNER_RIGHTS ) == 0 ) )
+	{
+		allowed_access = LIBFWNT_ACCESS_MASK_READ_CONTROL | LIBFWNT_ACCESS_MASK_WRITE_DAC;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_access_check_plan->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( maximum_allowed == 0 )
+		 && ( ( desired_access & ~( allowed_access | denied_access ) ) == 0 ) )
+		{
+			break;
+		}
+		plan_entry = &( internal_access_check_plan->entries[ entry_index ] );
+
+		entry_allowed_access = plan_entry->allowed_access & ~( allowed_access | denied_access );
+		entry_denied_access  = plan_entry->denied_access & ~( allowed_access | denied_access );
+
+		if( ( entry_allowed_access | entry_denied_access ) == 0 )
+		{
+			continue;
+		}
+		security_identifier_index = plan_entry->security_identifier_index;
+
+		if( security_identifier_index == internal_access_check_plan->owner_rights_index )
+		{
+			result = (int) is_owner;
+		}
+		else if( security_identifier_index < 64 )
+		{
+			/* The results of the first 64 security identifiers are remembered
+			 * so that every security identifier is looked up in the access token only once
+			 */
+			security_identifier_bit = (uint64_t) 1 << security_identifier_index;
+
+			if( ( checked_security_identifiers & security_identifier_bit ) == 0 )
+			{
+				if( libfwnt_internal_access_token_find(
+				     internal_access_token,
+				     &( internal_access_check_plan->security_identifiers[ security_identifier_index ] ),
+				     internal_access_check_plan->hashes[ security_identifier_index ],
+				     NULL ) != -1 )
+				{
+					matched_security_identifiers |= security_identifier_bit;
+				}
+				checked_security_identifiers |= security_identifier_bit;
+			}
+			result = (int) ( ( matched_security_identifiers & security_identifier_bit ) != 0 );
+		}
+		else
+		{
+			result = (int) ( libfwnt_internal_access_token_find(
+			                  internal_access_token,
+			                  &( internal_access_check_plan->security_identifiers[ security_identifier_index ] ),
+			                  internal_access_check_plan->hashes[ security_identifier_index ],
+			                  NULL ) != -1 );
+		}
+		if( result != 0 )
+		{
+			allowed_access |= entry_allowed_access;
+			denied_access  |= entry_denied_access;
+		}
+	}
+	if( maximum_allowed == 0 )
+	{
+		allowed_access &= desired_access;
+	}
+	*granted_access = allowed_access;
+
+	return( 1 );
+}
+
+/* Determines the access granted by the access check plan to multiple access tokens
+ * granted_access_masks must contain an access mask for every access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_check_plan_check_access_for_tokens(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_access_token_t **access_tokens,
+     int number_of_access_tokens,
+     uint32_t desired_access,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwnt_access_check_plan_check_access_for_tokens";
+	int access_token_index = 0;
+
+	if( access_check_plan == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access check plan.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access tokens.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_access_tokens < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of access tokens value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access_masks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access masks.",
+		 function );
+
+		return( -1 );
+	}
+	for( access_token_index = 0;
+	     access_token_index < number_of_access_tokens;
+	     access_token_index++ )
+	{
+		if( libfwnt_access_check_plan_check_access(
+		     access_check_plan,
+		     access_tokens[ access_token_index ],
+		     desired_access,
+		     &( granted_access_masks[ access_token_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check access of access token: %d.",
+			 function,
+			 access_token_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
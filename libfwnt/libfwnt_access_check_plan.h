@@ -0,0 +1,179 @@
+/*
+ * Windows NT access check plan functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_ACCESS_CHECK_PLAN_H )
+#define _LIBFWNT_INTERNAL_ACCESS_CHECK_PLAN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_access_control_list.h"
+#include "libfwnt_access_token.h"
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* An access check plan is a compiled form of a discretionary ACL.
+ * The security identifiers of the access control entries are deduplicated
+ * and consecutive entries of the same security identifier are combined into
+ * a single plan entry with disjoint allowed and denied access masks.
+ */
+
+typedef struct libfwnt_access_check_plan_entry libfwnt_access_check_plan_entry_t;
+
+struct libfwnt_access_check_plan_entry
+{
+	/* The index of the security identifier
+	 */
+	int security_identifier_index;
+
+	/* The allowed access mask
+	 */
+	uint32_t allowed_access;
+
+	/* The denied access mask
+	 */
+	uint32_t denied_access;
+};
+
+typedef struct libfwnt_internal_access_check_plan libfwnt_internal_access_check_plan_t;
+
+struct libfwnt_internal_access_check_plan
+{
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* Value to indicate the owner security identifier is set
+	 */
+	uint8_t has_owner_security_identifier;
+
+	/* The owner security identifier
+	 */
+	libfwnt_internal_security_identifier_t owner_security_identifier;
+
+	/* The hash of the owner security identifier
+	 */
+	uint64_t owner_hash;
+
+	/* The (deduplicated) security identifiers
+	 */
+	libfwnt_internal_security_identifier_t *security_identifiers;
+
+	/* The hashes of the security identifiers
+	 */
+	uint64_t *hashes;
+
+	/* The number of security identifiers
+	 */
+	int number_of_security_identifiers;
+
+	/* The index of the OWNER RIGHTS security identifier or -1 if not set
+	 */
+	int owner_rights_index;
+
+	/* The entries
+	 */
+	libfwnt_access_check_plan_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_initialize(
+     libfwnt_access_check_plan_t **access_check_plan,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_free(
+     libfwnt_access_check_plan_t **access_check_plan,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_check_plan_clear(
+     libfwnt_internal_access_check_plan_t *internal_access_check_plan,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_check_plan_compile(
+     libfwnt_internal_access_check_plan_t *internal_access_check_plan,
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     libfwnt_internal_security_identifier_t *owner_security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_compile_access_control_list(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_access_control_list_t *access_control_list,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_compile_security_descriptor(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_get_flags(
+     libfwnt_access_check_plan_t *access_check_plan,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_get_number_of_security_identifiers(
+     libfwnt_access_check_plan_t *access_check_plan,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_get_number_of_entries(
+     libfwnt_access_check_plan_t *access_check_plan,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_check_access(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_access_token_t *access_token,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_check_plan_check_access_for_tokens(
+     libfwnt_access_check_plan_t *access_check_plan,
+     libfwnt_access_token_t **access_tokens,
+     int number_of_access_tokens,
+     uint32_t desired_access,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_ACCESS_CHECK_PLAN_H ) */
+
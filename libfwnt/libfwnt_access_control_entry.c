@@ -28,6 +28,7 @@
 #include <wide_string.h>
 
 #include "libfwnt_access_control_entry.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_debug.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
@@ -42,9 +43,25 @@
 int libfwnt_access_control_entry_initialize(
      libfwnt_access_control_entry_t **access_control_entry,
      libcerror_error_t **error )
+{
+	return( libfwnt_access_control_entry_initialize_with_arena(
+	         access_control_entry,
+	         NULL,
+	         error ) );
+}
+
+/* Creates an access control entry
+ * Make sure the value access_control_entry is referencing, is set to NULL
+ * If no arena is provided the access control entry is allocated using the allocator
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_initialize_with_arena(
+     libfwnt_access_control_entry_t **access_control_entry,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
-	static char *function                                                  = "libfwnt_access_control_entry_initialize";
+	static char *function                                                  = "libfwnt_access_control_entry_initialize_with_arena";
 
 	if( access_control_entry == NULL )
 	{
@@ -68,7 +85,8 @@ int libfwnt_access_control_entry_initialize(
 
 		return( -1 );
 	}
-	internal_access_control_entry = memory_allocate_structure(
+	internal_access_control_entry = libfwnt_arena_allocate_structure(
+	                                 arena,
 	                                 libfwnt_internal_access_control_entry_t );
 
 	if( internal_access_control_entry == NULL )
@@ -96,6 +114,8 @@ int libfwnt_access_control_entry_initialize(
 
 		goto on_error;
 	}
+	internal_access_control_entry->arena = arena;
+
 	*access_control_entry = (libfwnt_access_control_entry_t *) internal_access_control_entry;
 
 	return( 1 );
@@ -103,7 +123,8 @@ int libfwnt_access_control_entry_initialize(
 on_error:
 	if( internal_access_control_entry != NULL )
 	{
-		memory_free(
+		libfwnt_arena_release(
+		 arena,
 		 internal_access_control_entry );
 	}
 	return( -1 );
@@ -175,7 +196,14 @@ int libfwnt_internal_access_control_entry_free(
 				result = -1;
 			}
 		}
-		memory_free(
+		if( ( *internal_access_control_entry )->application_data != NULL )
+		{
+			libfwnt_arena_release(
+			 ( *internal_access_control_entry )->arena,
+			 ( *internal_access_control_entry )->application_data );
+		}
+		libfwnt_arena_release(
+		 ( *internal_access_control_entry )->arena,
 		 *internal_access_control_entry );
 
 		*internal_access_control_entry = NULL;
@@ -183,7 +211,191 @@ int libfwnt_internal_access_control_entry_free(
 	return( result );
 }
 
+/* Determines the layout of an access control entry stored in a byte stream
+ * The byte stream must contain at least the 4-byte header of the entry and
+ * entry_size is the size of the entry as stored in the header
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_get_layout(
+     const uint8_t *byte_stream,
+     size_t entry_size,
+     libfwnt_access_control_entry_layout_t *layout,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_entry_get_layout";
+	size_t data_offset    = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_size < 4 )
+	 || ( entry_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( layout == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid layout.",
+		 function );
+
+		return( -1 );
+	}
+	layout->access_mask_offset           = 0;
+	layout->object_flags                 = 0;
+	layout->object_type_offset           = 0;
+	layout->inherited_object_type_offset = 0;
+	layout->security_identifier_offset   = 0;
+	layout->has_application_data         = 0;
+
+	switch( byte_stream[ 0 ] )
+	{
+		/* Basic types */
+		case LIBFWNT_ACCESS_ALLOWED:
+		case LIBFWNT_ACCESS_DENIED:
+		case LIBFWNT_SYSTEM_AUDIT:
+		case LIBFWNT_SYSTEM_ALARM:
+		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+			layout->access_mask_offset         = 4;
+			layout->security_identifier_offset = 8;
+			break;
+
+		/* Callback types */
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+			layout->access_mask_offset         = 4;
+			layout->security_identifier_offset = 8;
+			layout->has_application_data       = 1;
+			break;
+
+		/* Object types */
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+			layout->access_mask_offset = 4;
+			data_offset                = 8;
+			break;
+
+		/* Callback object types */
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			layout->access_mask_offset   = 4;
+			layout->has_application_data = 1;
+			data_offset                  = 8;
+			break;
+
+		/* Unknown types */
+		case LIBFWNT_ACCESS_ALLOWED_COMPOUND:
+		default:
+			break;
+	}
+	if( layout->access_mask_offset > ( entry_size - 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access control mask offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset > 0 )
+	{
+		/* The object flags determine which of the object type GUIDs are present
+		 */
+		if( data_offset > ( entry_size - 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: object flags offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( byte_stream[ data_offset ] ),
+		 layout->object_flags );
+
+		data_offset += 4;
+
+		if( ( layout->object_flags & LIBFWNT_ACE_OBJECT_TYPE_PRESENT ) != 0 )
+		{
+			if( ( entry_size - data_offset ) < 16 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: object type offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			layout->object_type_offset = data_offset;
+
+			data_offset += 16;
+		}
+		if( ( layout->object_flags & LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) != 0 )
+		{
+			if( ( entry_size - data_offset ) < 16 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: inherited object type offset value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			layout->inherited_object_type_offset = data_offset;
+
+			data_offset += 16;
+		}
+		layout->security_identifier_offset = data_offset;
+	}
+	if( layout->security_identifier_offset > entry_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: security identifier offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Converts an access control entry stored in a byte stream into a runtime version
+ * The security identifier of a previously converted access control entry is reused
  * Returns 1 if successful or -1 on error
  */
 int libfwnt_access_control_entry_copy_from_byte_stream(
@@ -193,10 +405,13 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error )
 {
+	libfwnt_access_control_entry_layout_t layout;
+
 	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
 	static char *function                                                  = "libfwnt_access_control_entry_copy_from_byte_stream";
-	size_t access_mask_offset                                              = 0;
+	size_t application_data_offset                                         = 0;
 	size_t sid_offset                                                      = 0;
+	size_t sid_size                                                        = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	system_character_t *sid_string                                         = NULL;
@@ -334,56 +549,50 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
 		 0 );
 	}
 #endif
-	switch( internal_access_control_entry->type )
+	if( libfwnt_access_control_entry_get_layout(
+	     byte_stream,
+	     (size_t) internal_access_control_entry->size,
+	     &layout,
+	     error ) != 1 )
 	{
-		/* Basic types */
-		case LIBFWNT_ACCESS_ALLOWED:
-		case LIBFWNT_ACCESS_DENIED:
-		case LIBFWNT_SYSTEM_AUDIT:
-		case LIBFWNT_SYSTEM_ALARM:
-		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
-		case LIBFWNT_ACCESS_DENIED_CALLBACK:
-		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
-		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
-		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
-			access_mask_offset = 4;
-			sid_offset         = 8;
-			break;
-
-		/* Object types */
-		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
-		case LIBFWNT_ACCESS_DENIED_OBJECT:
-		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
-		case LIBFWNT_SYSTEM_ALARM_OBJECT:
-		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
-		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
-		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
-		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
-			access_mask_offset = 4;
-			sid_offset         = 40;
-			break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine access control entry layout.",
+		 function );
 
-		/* Unknown types */
-		case LIBFWNT_ACCESS_ALLOWED_COMPOUND:
-		default:
-			break;
+		goto on_error;
 	}
-	if( access_mask_offset > 0 )
-	{
-		if( access_mask_offset > (size_t) ( internal_access_control_entry->size - 4 ) )
+	internal_access_control_entry->access_mask  = 0;
+	internal_access_control_entry->object_flags = layout.object_flags;
+
+	/* The application data buffer is kept for reuse
+	 */
+	internal_access_control_entry->application_data_size = 0;
+	sid_offset = layout.security_identifier_offset;
 
+	if( ( sid_offset == 0 )
+	 && ( internal_access_control_entry->security_identifier != NULL ) )
+	{
+		if( libfwnt_internal_security_identifier_free(
+		     (libfwnt_internal_security_identifier_t **) &( internal_access_control_entry->security_identifier ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: access control mask offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free security identifier.",
 			 function );
 
 			goto on_error;
 		}
+	}
+	if( layout.access_mask_offset > 0 )
+	{
 		byte_stream_copy_to_uint32_little_endian(
-		 &( byte_stream[ access_mask_offset ] ),
+		 &( byte_stream[ layout.access_mask_offset ] ),
 		 internal_access_control_entry->access_mask );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -400,49 +609,106 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
 		}
 #endif
 	}
-	if( sid_offset > 0 )
+	if( memory_set(
+	     internal_access_control_entry->object_type,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object type.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_access_control_entry->inherited_object_type,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inherited object type.",
+		 function );
+
+		goto on_error;
+	}
+	if( layout.object_type_offset > 0 )
 	{
-		if( sid_offset > internal_access_control_entry->size )
+		if( memory_copy(
+		     internal_access_control_entry->object_type,
+		     &( byte_stream[ layout.object_type_offset ] ),
+		     16 ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: security identifier offset value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy object type.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfwnt_security_identifier_initialize(
-		     &( internal_access_control_entry->security_identifier ),
-		     error ) != 1 )
+	}
+	if( layout.inherited_object_type_offset > 0 )
+	{
+		if( memory_copy(
+		     internal_access_control_entry->inherited_object_type,
+		     &( byte_stream[ layout.inherited_object_type_offset ] ),
+		     16 ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create security identifier.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy inherited object type.",
 			 function );
 
 			goto on_error;
 		}
+	}
+	if( sid_offset > 0 )
+	{
 		if( internal_access_control_entry->security_identifier == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid access control entry - missing owner security identifier.",
-			 function );
+			if( libfwnt_security_identifier_initialize_with_arena(
+			     &( internal_access_control_entry->security_identifier ),
+			     internal_access_control_entry->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create security identifier.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( internal_access_control_entry->security_identifier == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid access control entry - missing owner security identifier.",
+				 function );
+
+				goto on_error;
+			}
+			( (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier )->is_managed = 1;
 		}
-		( (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier )->is_managed = 1;
 
+		/* The security identifier is stored within the entry
+		 */
 		if( libfwnt_security_identifier_copy_from_byte_stream(
 		     internal_access_control_entry->security_identifier,
 		     &( byte_stream[ sid_offset ] ),
-		     byte_stream_size - sid_offset,
+		     (size_t) internal_access_control_entry->size - sid_offset,
 		     byte_order,
 		     error ) != 1 )
 		{
@@ -455,6 +721,7 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
 
 			goto on_error;
 		}
+		sid_size = 8 + ( (size_t) ( (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier )->number_of_sub_authorities * 4 );
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -533,6 +800,40 @@ int libfwnt_access_control_entry_copy_from_byte_stream(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
+	application_data_offset = sid_offset + sid_size;
+
+	if( ( layout.has_application_data != 0 )
+	 && ( sid_offset > 0 )
+	 && ( application_data_offset < (size_t) internal_access_control_entry->size ) )
+	{
+		if( libfwnt_internal_access_control_entry_set_application_data(
+		     internal_access_control_entry,
+		     &( byte_stream[ application_data_offset ] ),
+		     (size_t) internal_access_control_entry->size - application_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set application data.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: application data:\n",
+			 function );
+			libcnotify_print_data(
+			 internal_access_control_entry->application_data,
+			 internal_access_control_entry->application_data_size,
+			 0 );
+		}
+#endif
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -550,6 +851,8 @@ on_error:
 		 sid_string );
 	}
 #endif
+	internal_access_control_entry->application_data_size = 0;
+
 	if( internal_access_control_entry->security_identifier != NULL )
 	{
 		libfwnt_internal_security_identifier_free(
@@ -762,3 +1065,1535 @@ int libfwnt_access_control_entry_get_security_identifier(
 	return( 1 );
 }
 
+/* Retrieves the object flags
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_get_object_flags(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint32_t *object_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_get_object_flags";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( object_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object flags.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_access_control_entry->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		default:
+			return( 0 );
+	}
+	*object_flags = internal_access_control_entry->object_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the object type
+ * The object type is a GUID stored in little-endian and is 16 bytes of size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_get_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_get_object_type";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_access_control_entry->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_OBJECT_TYPE_PRESENT ) == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     internal_access_control_entry->object_type,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy object type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the inherited object type
+ * The inherited object type is a GUID stored in little-endian and is 16 bytes of size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_get_inherited_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_get_inherited_object_type";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_access_control_entry->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		default:
+			return( 0 );
+	}
+	if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) == 0 )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     guid_data,
+	     internal_access_control_entry->inherited_object_type,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy inherited object type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the application data size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_get_application_data_size(
+     libfwnt_access_control_entry_t *access_control_entry,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_get_application_data_size";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_control_entry->application_data_size == 0 )
+	{
+		return( 0 );
+	}
+	*data_size = internal_access_control_entry->application_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the application data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_access_control_entry_get_application_data(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_get_application_data";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_control_entry->application_data_size == 0 )
+	{
+		return( 0 );
+	}
+	if( data_size < internal_access_control_entry->application_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     internal_access_control_entry->application_data,
+	     internal_access_control_entry->application_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy application data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the security identifier of an access control entry
+ * The values of the security identifier are copied into a security identifier managed by the entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_entry_set_security_identifier(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_access_control_entry_set_security_identifier";
+
+	if( internal_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_control_entry->security_identifier == NULL )
+	{
+		if( libfwnt_security_identifier_initialize_with_arena(
+		     &( internal_access_control_entry->security_identifier ),
+		     internal_access_control_entry->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		( (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier )->is_managed = 1;
+	}
+	if( libfwnt_internal_security_identifier_set_values(
+	     (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier,
+	     (libfwnt_internal_security_identifier_t *) security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set security identifier values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the values of an access control entry
+ * The values of the security identifier are copied. Object types and
+ * application data of a previous type are cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_values(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t type,
+     uint8_t flags,
+     uint32_t access_mask,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_values";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	switch( type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED:
+		case LIBFWNT_ACCESS_DENIED:
+		case LIBFWNT_SYSTEM_AUDIT:
+		case LIBFWNT_SYSTEM_ALARM:
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported type: 0x%02" PRIx8 ".",
+			 function,
+			 type );
+
+			return( -1 );
+	}
+	if( libfwnt_internal_access_control_entry_set_security_identifier(
+	     internal_access_control_entry,
+	     security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_access_control_entry->object_type,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear object type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_access_control_entry->inherited_object_type,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inherited object type.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry->application_data_size = 0;
+
+	internal_access_control_entry->type         = type;
+	internal_access_control_entry->flags        = flags;
+	internal_access_control_entry->access_mask  = access_mask;
+	internal_access_control_entry->object_flags = 0;
+
+	return( 1 );
+}
+
+/* Sets the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_flags(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_flags";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	internal_access_control_entry->flags = flags;
+
+	return( 1 );
+}
+
+/* Sets the access mask
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_access_mask(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint32_t access_mask,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_access_mask";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	internal_access_control_entry->access_mask = access_mask;
+
+	return( 1 );
+}
+
+/* Sets the security identifier
+ * The values of the security identifier are copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_security_identifier(
+     libfwnt_access_control_entry_t *access_control_entry,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_security_identifier";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( ( internal_access_control_entry->type == LIBFWNT_ACCESS_ALLOWED_COMPOUND )
+	 || ( internal_access_control_entry->type > LIBFWNT_SYSTEM_MANDATORY_LABEL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid access control entry - unsupported type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_control_entry_set_security_identifier(
+	     internal_access_control_entry,
+	     security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets an object type GUID of an object access control entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_entry_set_object_type_guid(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     uint8_t *object_type,
+     uint32_t object_flag,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_access_control_entry_set_object_type_guid";
+
+	if( internal_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_access_control_entry->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid access control entry - unsupported type.",
+			 function );
+
+			return( -1 );
+	}
+	if( memory_copy(
+	     object_type,
+	     guid_data,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry->object_flags |= object_flag;
+
+	return( 1 );
+}
+
+/* Sets the object type
+ * The object type is a GUID stored in little-endian and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_object_type";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( libfwnt_internal_access_control_entry_set_object_type_guid(
+	     internal_access_control_entry,
+	     internal_access_control_entry->object_type,
+	     LIBFWNT_ACE_OBJECT_TYPE_PRESENT,
+	     guid_data,
+	     guid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set object type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the inherited object type
+ * The inherited object type is a GUID stored in little-endian and is 16 bytes of size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_inherited_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_inherited_object_type";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( libfwnt_internal_access_control_entry_set_object_type_guid(
+	     internal_access_control_entry,
+	     internal_access_control_entry->inherited_object_type,
+	     LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT,
+	     guid_data,
+	     guid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set inherited object type.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the application data
+ * The application data is only reallocated when it needs to grow
+ * A data size of 0 removes the application data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_entry_set_application_data(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *application_data = NULL;
+	static char *function     = "libfwnt_internal_access_control_entry_set_application_data";
+
+	if( internal_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry->application_data_size = 0;
+
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( data_size > internal_access_control_entry->application_data_allocated_size )
+	{
+		application_data = (uint8_t *) libfwnt_arena_allocate(
+		                                internal_access_control_entry->arena,
+		                                data_size );
+
+		if( application_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create application data.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_access_control_entry->application_data != NULL )
+		{
+			libfwnt_arena_release(
+			 internal_access_control_entry->arena,
+			 internal_access_control_entry->application_data );
+		}
+		internal_access_control_entry->application_data                = application_data;
+		internal_access_control_entry->application_data_allocated_size = data_size;
+	}
+	if( memory_copy(
+	     internal_access_control_entry->application_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy application data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry->application_data_size = data_size;
+
+	return( 1 );
+}
+
+/* Sets the application data of a callback access control entry
+ * A data size of 0 removes the application data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_set_application_data(
+     libfwnt_access_control_entry_t *access_control_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_set_application_data";
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_access_control_entry->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid access control entry - unsupported type.",
+			 function );
+
+			return( -1 );
+	}
+	if( libfwnt_internal_access_control_entry_set_application_data(
+	     internal_access_control_entry,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set application data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares two access control entries
+ * Access control entries are ordered by type, flags, security identifier, access mask,
+ * object types and application data
+ * Returns LIBFWNT_COMPARE_LESS, LIBFWNT_COMPARE_EQUAL, LIBFWNT_COMPARE_GREATER if successful or -1 on error
+ */
+int libfwnt_internal_access_control_entry_compare(
+     libfwnt_internal_access_control_entry_t *first_access_control_entry,
+     libfwnt_internal_access_control_entry_t *second_access_control_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_access_control_entry_compare";
+	size_t data_size      = 0;
+	int result            = 0;
+
+	if( first_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_access_control_entry->type < second_access_control_entry->type )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( first_access_control_entry->type > second_access_control_entry->type )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	if( first_access_control_entry->flags < second_access_control_entry->flags )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( first_access_control_entry->flags > second_access_control_entry->flags )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	/* An entry without a security identifier is ordered first
+	 */
+	if( ( first_access_control_entry->security_identifier == NULL )
+	 || ( second_access_control_entry->security_identifier == NULL ) )
+	{
+		if( first_access_control_entry->security_identifier != NULL )
+		{
+			return( LIBFWNT_COMPARE_GREATER );
+		}
+		else if( second_access_control_entry->security_identifier != NULL )
+		{
+			return( LIBFWNT_COMPARE_LESS );
+		}
+	}
+	else
+	{
+		result = libfwnt_security_identifier_compare(
+		          first_access_control_entry->security_identifier,
+		          second_access_control_entry->security_identifier,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare security identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != LIBFWNT_COMPARE_EQUAL )
+		{
+			return( result );
+		}
+	}
+	if( first_access_control_entry->access_mask < second_access_control_entry->access_mask )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( first_access_control_entry->access_mask > second_access_control_entry->access_mask )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	if( first_access_control_entry->object_flags < second_access_control_entry->object_flags )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( first_access_control_entry->object_flags > second_access_control_entry->object_flags )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	result = 0;
+
+	/* The object types are only compared if present
+	 */
+	if( ( first_access_control_entry->object_flags & LIBFWNT_ACE_OBJECT_TYPE_PRESENT ) != 0 )
+	{
+		result = memory_compare(
+		          first_access_control_entry->object_type,
+		          second_access_control_entry->object_type,
+		          16 );
+	}
+	if( ( result == 0 )
+	 && ( ( first_access_control_entry->object_flags & LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) != 0 ) )
+	{
+		result = memory_compare(
+		          first_access_control_entry->inherited_object_type,
+		          second_access_control_entry->inherited_object_type,
+		          16 );
+	}
+	if( result < 0 )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	data_size = first_access_control_entry->application_data_size;
+
+	if( data_size > second_access_control_entry->application_data_size )
+	{
+		data_size = second_access_control_entry->application_data_size;
+	}
+	if( data_size > 0 )
+	{
+		result = memory_compare(
+		          first_access_control_entry->application_data,
+		          second_access_control_entry->application_data,
+		          data_size );
+
+		if( result < 0 )
+		{
+			return( LIBFWNT_COMPARE_LESS );
+		}
+		else if( result > 0 )
+		{
+			return( LIBFWNT_COMPARE_GREATER );
+		}
+	}
+	if( first_access_control_entry->application_data_size < second_access_control_entry->application_data_size )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( first_access_control_entry->application_data_size > second_access_control_entry->application_data_size )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	return( LIBFWNT_COMPARE_EQUAL );
+}
+
+/* Determines the size of an access control entry as stored in a byte stream
+ * Application data is padded to a multiple of 4 bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_entry_get_data_size(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwnt_internal_access_control_entry_get_data_size";
+	size_t entry_size            = 8;
+	uint8_t has_application_data = 0;
+
+	if( internal_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_access_control_entry->type )
+	{
+		/* Basic types */
+		case LIBFWNT_ACCESS_ALLOWED:
+		case LIBFWNT_ACCESS_DENIED:
+		case LIBFWNT_SYSTEM_AUDIT:
+		case LIBFWNT_SYSTEM_ALARM:
+		case LIBFWNT_SYSTEM_MANDATORY_LABEL:
+			break;
+
+		/* Callback types */
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK:
+			has_application_data = 1;
+			break;
+
+		/* Object types */
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+			entry_size += 4;
+			break;
+
+		/* Callback object types */
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			has_application_data = 1;
+			entry_size          += 4;
+			break;
+
+		/* Unknown types */
+		case LIBFWNT_ACCESS_ALLOWED_COMPOUND:
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access control entry type: 0x%02" PRIx8 ".",
+			 function,
+			 internal_access_control_entry->type );
+
+			return( -1 );
+	}
+	if( internal_access_control_entry->security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control entry - missing security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size > 8 )
+	{
+		if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_OBJECT_TYPE_PRESENT ) != 0 )
+		{
+			entry_size += 16;
+		}
+		if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) != 0 )
+		{
+			entry_size += 16;
+		}
+	}
+	entry_size += 8 + ( (size_t) ( (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier )->number_of_sub_authorities * 4 );
+
+	if( has_application_data != 0 )
+	{
+		entry_size += ( internal_access_control_entry->application_data_size + 3 ) & ~( (size_t) 3 );
+	}
+	if( entry_size > (size_t) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid access control entry size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = entry_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the access control entry as stored in a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_get_data_size(
+     libfwnt_access_control_entry_t *access_control_entry,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_entry_get_data_size";
+
+	if( libfwnt_internal_access_control_entry_get_data_size(
+	     (libfwnt_internal_access_control_entry_t *) access_control_entry,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an access control entry into a byte stream
+ * This is the inverse of libfwnt_access_control_entry_copy_from_byte_stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_entry_copy_to_byte_stream(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_access_control_entry_copy_to_byte_stream";
+	size_t byte_stream_offset                                              = 8;
+	size_t entry_size                                                      = 0;
+	size_t sid_size                                                        = 0;
+
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_entry = (libfwnt_internal_access_control_entry_t *) access_control_entry;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_control_entry_get_data_size(
+	     internal_access_control_entry,
+	     &entry_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine access control entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < entry_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream[ 0 ] = internal_access_control_entry->type;
+	byte_stream[ 1 ] = internal_access_control_entry->flags;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 (uint16_t) entry_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 internal_access_control_entry->access_mask );
+
+	switch( internal_access_control_entry->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			byte_stream_copy_from_uint32_little_endian(
+			 &( byte_stream[ 8 ] ),
+			 internal_access_control_entry->object_flags );
+
+			byte_stream_offset = 12;
+
+			if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_OBJECT_TYPE_PRESENT ) != 0 )
+			{
+				if( memory_copy(
+				     &( byte_stream[ byte_stream_offset ] ),
+				     internal_access_control_entry->object_type,
+				     16 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy object type.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_offset += 16;
+			}
+			if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) != 0 )
+			{
+				if( memory_copy(
+				     &( byte_stream[ byte_stream_offset ] ),
+				     internal_access_control_entry->inherited_object_type,
+				     16 ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy inherited object type.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_offset += 16;
+			}
+			break;
+
+		default:
+			break;
+	}
+	if( libfwnt_security_identifier_copy_to_byte_stream(
+	     internal_access_control_entry->security_identifier,
+	     &( byte_stream[ byte_stream_offset ] ),
+	     entry_size - byte_stream_offset,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier to byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	sid_size = 8 + ( (size_t) ( (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier )->number_of_sub_authorities * 4 );
+
+	byte_stream_offset += sid_size;
+
+	if( ( internal_access_control_entry->application_data_size > 0 )
+	 && ( byte_stream_offset < entry_size ) )
+	{
+		if( memory_copy(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     internal_access_control_entry->application_data,
+		     internal_access_control_entry->application_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy application data.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_offset += internal_access_control_entry->application_data_size;
+	}
+	/* Pad the application data to a multiple of 4 bytes
+	 */
+	if( byte_stream_offset < entry_size )
+	{
+		if( memory_set(
+		     &( byte_stream[ byte_stream_offset ] ),
+		     0,
+		     entry_size - byte_stream_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear padding.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
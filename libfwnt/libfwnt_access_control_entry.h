@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwnt_arena.h"
 #include "libfwnt_extern.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_security_identifier.h"
@@ -37,8 +38,47 @@ extern "C" {
 /* The Windows NT Access Control Entry is formatted as following:
  * header: type, flags, size
  * data
+ *
+ * The data of the object types consists of:
+ * access mask, object flags, object type GUID (optional),
+ * inherited object type GUID (optional), SID
+ *
+ * The data of the callback types contains application data after the SID
  */
 
+typedef struct libfwnt_access_control_entry_layout libfwnt_access_control_entry_layout_t;
+
+struct libfwnt_access_control_entry_layout
+{
+	/* The access mask offset relative to the start of the entry
+	 * 0 if the entry does not contain an access mask
+	 */
+	size_t access_mask_offset;
+
+	/* The object flags
+	 */
+	uint32_t object_flags;
+
+	/* The object type offset relative to the start of the entry
+	 * 0 if the entry does not contain an object type
+	 */
+	size_t object_type_offset;
+
+	/* The inherited object type offset relative to the start of the entry
+	 * 0 if the entry does not contain an inherited object type
+	 */
+	size_t inherited_object_type_offset;
+
+	/* The security identifier (SID) offset relative to the start of the entry
+	 * 0 if the entry does not contain a security identifier
+	 */
+	size_t security_identifier_offset;
+
+	/* Value to indicate the entry contains application data after the security identifier
+	 */
+	uint8_t has_application_data;
+};
+
 typedef struct libfwnt_internal_access_control_entry libfwnt_internal_access_control_entry_t;
 
 struct libfwnt_internal_access_control_entry
@@ -59,15 +99,48 @@ struct libfwnt_internal_access_control_entry
 	 */
 	uint32_t access_mask;
 
+	/* The object flags
+	 */
+	uint32_t object_flags;
+
+	/* The object type
+	 */
+	uint8_t object_type[ 16 ];
+
+	/* The inherited object type
+	 */
+	uint8_t inherited_object_type[ 16 ];
+
 	/* The security identifier
 	 */
 	libfwnt_security_identifier_t *security_identifier;
+
+	/* The application data
+	 */
+	uint8_t *application_data;
+
+	/* The application data size
+	 */
+	size_t application_data_size;
+
+	/* The allocated size of the application data
+	 */
+	size_t application_data_allocated_size;
+
+	/* The arena the entry was allocated from
+	 */
+	libfwnt_arena_t *arena;
 };
 
 int libfwnt_access_control_entry_initialize(
      libfwnt_access_control_entry_t **access_control_entry,
      libcerror_error_t **error );
 
+int libfwnt_access_control_entry_initialize_with_arena(
+     libfwnt_access_control_entry_t **access_control_entry,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_access_control_entry_free(
      libfwnt_access_control_entry_t **access_control_entry,
@@ -77,6 +150,12 @@ int libfwnt_internal_access_control_entry_free(
      libfwnt_internal_access_control_entry_t **internal_access_control_entry,
      libcerror_error_t **error );
 
+int libfwnt_access_control_entry_get_layout(
+     const uint8_t *byte_stream,
+     size_t entry_size,
+     libfwnt_access_control_entry_layout_t *layout,
+     libcerror_error_t **error );
+
 int libfwnt_access_control_entry_copy_from_byte_stream(
      libfwnt_access_control_entry_t *access_control_entry,
      const uint8_t *byte_stream,
@@ -108,6 +187,130 @@ int libfwnt_access_control_entry_get_security_identifier(
      libfwnt_security_identifier_t **security_identifier,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_object_flags(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint32_t *object_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_inherited_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_application_data_size(
+     libfwnt_access_control_entry_t *access_control_entry,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_application_data(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_entry_set_security_identifier(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_values(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t type,
+     uint8_t flags,
+     uint32_t access_mask,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_flags(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_access_mask(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint32_t access_mask,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_security_identifier(
+     libfwnt_access_control_entry_t *access_control_entry,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_entry_set_object_type_guid(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     uint8_t *object_type,
+     uint32_t object_flag,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_inherited_object_type(
+     libfwnt_access_control_entry_t *access_control_entry,
+     const uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_entry_set_application_data(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_set_application_data(
+     libfwnt_access_control_entry_t *access_control_entry,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_entry_compare(
+     libfwnt_internal_access_control_entry_t *first_access_control_entry,
+     libfwnt_internal_access_control_entry_t *second_access_control_entry,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_entry_get_data_size(
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_get_data_size(
+     libfwnt_access_control_entry_t *access_control_entry,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_entry_copy_to_byte_stream(
+     libfwnt_access_control_entry_t *access_control_entry,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
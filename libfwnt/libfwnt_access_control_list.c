@@ -26,10 +26,14 @@
 
 #include "libfwnt_access_control_entry.h"
 #include "libfwnt_access_control_list.h"
+#include "libfwnt_access_token.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
+#include "libfwnt_security_identifier.h"
 #include "libfwnt_types.h"
+#include "libfwnt_well_known_security_identifier.h"
 
 /* Creates an access control list
  * Make sure the value access_control_list is referencing, is set to NULL
@@ -38,9 +42,25 @@
 int libfwnt_access_control_list_initialize(
      libfwnt_access_control_list_t **access_control_list,
      libcerror_error_t **error )
+{
+	return( libfwnt_access_control_list_initialize_with_arena(
+	         access_control_list,
+	         NULL,
+	         error ) );
+}
+
+/* Creates an access control list
+ * Make sure the value access_control_list is referencing, is set to NULL
+ * If no arena is provided the access control list is allocated using the allocator
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_initialize_with_arena(
+     libfwnt_access_control_list_t **access_control_list,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_access_control_list_t *internal_access_control_list = NULL;
-	static char *function                                                = "libfwnt_access_control_list_initialize";
+	static char *function                                                = "libfwnt_access_control_list_initialize_with_arena";
 
 	if( access_control_list == NULL )
 	{
@@ -64,7 +84,8 @@ int libfwnt_access_control_list_initialize(
 
 		return( -1 );
 	}
-	internal_access_control_list = memory_allocate_structure(
+	internal_access_control_list = libfwnt_arena_allocate_structure(
+	                                arena,
 	                                libfwnt_internal_access_control_list_t );
 
 	if( internal_access_control_list == NULL )
@@ -92,6 +113,8 @@ int libfwnt_access_control_list_initialize(
 
 		goto on_error;
 	}
+	internal_access_control_list->arena = arena;
+
 	*access_control_list = (libfwnt_access_control_list_t *) internal_access_control_list;
 
 	return( 1 );
@@ -99,7 +122,8 @@ int libfwnt_access_control_list_initialize(
 on_error:
 	if( internal_access_control_list != NULL )
 	{
-		memory_free(
+		libfwnt_arena_release(
+		 arena,
 		 internal_access_control_list );
 	}
 	return( -1 );
@@ -140,6 +164,7 @@ int libfwnt_internal_access_control_list_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfwnt_internal_access_control_list_free";
+	int entry_index       = 0;
 	int result            = 1;
 
 	if( internal_access_control_list == NULL )
@@ -155,24 +180,33 @@ int libfwnt_internal_access_control_list_free(
 	}
 	if( *internal_access_control_list != NULL )
 	{
-		if( ( *internal_access_control_list )->entries_array != NULL )
+		if( ( *internal_access_control_list )->entries != NULL )
 		{
-			if( libcdata_array_free(
-			     &( ( *internal_access_control_list )->entries_array ),
-			     (int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_internal_access_control_entry_free,
-			     error ) != 1 )
+			for( entry_index = 0;
+			     entry_index < ( *internal_access_control_list )->number_of_allocated_entries;
+			     entry_index++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free entries array.",
-				 function );
+				if( libfwnt_internal_access_control_entry_free(
+				     &( ( *internal_access_control_list )->entries[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free access control entry: %d.",
+					 function,
+					 entry_index );
 
-				result = -1;
+					result = -1;
+				}
 			}
+			libfwnt_arena_release(
+			 ( *internal_access_control_list )->arena,
+			 ( *internal_access_control_list )->entries );
 		}
-		memory_free(
+		libfwnt_arena_release(
+		 ( *internal_access_control_list )->arena,
 		 *internal_access_control_list );
 
 		*internal_access_control_list = NULL;
@@ -181,6 +215,7 @@ int libfwnt_internal_access_control_list_free(
 }
 
 /* Converts an access control list stored in a byte stream into a runtime version
+ * The entries of a previously converted access control list are reused
  * Returns 1 if successful or -1 on error
  */
 int libfwnt_access_control_list_copy_from_byte_stream(
@@ -190,6 +225,7 @@ int libfwnt_access_control_list_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error )
 {
+	libfwnt_internal_access_control_entry_t **entries                      = NULL;
 	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
 	libfwnt_internal_access_control_list_t *internal_access_control_list   = NULL;
 	static char *function                                                  = "libfwnt_access_control_list_copy_from_byte_stream";
@@ -215,17 +251,6 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 	}
 	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
 
-	if( internal_access_control_list->entries_array != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid access control list - entries array value already set.",
-		 function );
-
-		return( -1 );
-	}
 	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
@@ -329,39 +354,110 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 #endif
 	byte_stream_offset = 8;
 
-/* TODO check bounds of number_of_entries */
-	if( libcdata_array_initialize(
-	     &( internal_access_control_list->entries_array ),
-	     (int) number_of_entries,
-	     error ) != 1 )
+	/* Every access control entry consists of at least a 4-byte header
+	 */
+	if( (size_t) number_of_entries > ( ( byte_stream_size - 8 ) / 4 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entries array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of entries value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	internal_access_control_list->number_of_entries = 0;
+
+	/* The entries array and the entries of a previously read list are reused
+	 */
+	if( (int) number_of_entries > internal_access_control_list->number_of_allocated_entries )
 	{
-		if( libfwnt_access_control_entry_initialize(
-		     (libfwnt_access_control_entry_t **) &internal_access_control_entry,
-		     error ) != 1 )
+		entries = (libfwnt_internal_access_control_entry_t **) libfwnt_arena_allocate(
+		           internal_access_control_list->arena,
+		           sizeof( libfwnt_internal_access_control_entry_t * ) * number_of_entries );
+
+		if( entries == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create access control entry: %" PRIu16 ".",
-			 function,
-			 entry_index );
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     entries,
+		     0,
+		     sizeof( libfwnt_internal_access_control_entry_t * ) * number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			libfwnt_arena_release(
+			 internal_access_control_list->arena,
+			 entries );
 
 			goto on_error;
 		}
+		if( internal_access_control_list->entries != NULL )
+		{
+			if( memory_copy(
+			     entries,
+			     internal_access_control_list->entries,
+			     sizeof( libfwnt_internal_access_control_entry_t * ) * internal_access_control_list->number_of_allocated_entries ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy entries.",
+				 function );
+
+				libfwnt_arena_release(
+				 internal_access_control_list->arena,
+				 entries );
+
+				goto on_error;
+			}
+			libfwnt_arena_release(
+			 internal_access_control_list->arena,
+			 internal_access_control_list->entries );
+		}
+		internal_access_control_list->entries                     = entries;
+		internal_access_control_list->number_of_allocated_entries = (int) number_of_entries;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		internal_access_control_entry = internal_access_control_list->entries[ entry_index ];
+
+		if( internal_access_control_entry == NULL )
+		{
+			if( libfwnt_access_control_entry_initialize_with_arena(
+			     (libfwnt_access_control_entry_t **) &internal_access_control_entry,
+			     internal_access_control_list->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create access control entry: %" PRIu16 ".",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			internal_access_control_list->entries[ entry_index ] = internal_access_control_entry;
+		}
 		if( libfwnt_access_control_entry_copy_from_byte_stream(
 		     (libfwnt_access_control_entry_t *) internal_access_control_entry,
 		     &( byte_stream[ byte_stream_offset ] ),
@@ -394,40 +490,30 @@ int libfwnt_access_control_list_copy_from_byte_stream(
 		}
 		byte_stream_offset += internal_access_control_entry->size;
 
-		if( libcdata_array_set_entry_by_index(
-		     internal_access_control_list->entries_array,
-		     (int) entry_index,
-		     (intptr_t *) internal_access_control_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set access control entry: %" PRIu16 ".",
-			 function,
-			 entry_index );
-
-			goto on_error;
-		}
-		internal_access_control_entry = NULL;
+		internal_access_control_list->number_of_entries += 1;
 	}
 	return( 1 );
 
 on_error:
-	if( internal_access_control_entry != NULL )
+	if( internal_access_control_list->entries != NULL )
 	{
-		libfwnt_internal_access_control_entry_free(
-		 &internal_access_control_entry,
-		 NULL );
-	}
-	if( internal_access_control_list->entries_array != NULL )
-	{
-		libcdata_array_free(
-		 &( internal_access_control_list->entries_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwnt_internal_access_control_entry_free,
-		 NULL );
+		for( entry_index = 0;
+		     entry_index < internal_access_control_list->number_of_allocated_entries;
+		     entry_index++ )
+		{
+			libfwnt_internal_access_control_entry_free(
+			 &( internal_access_control_list->entries[ entry_index ] ),
+			 NULL );
+		}
+		libfwnt_arena_release(
+		 internal_access_control_list->arena,
+		 internal_access_control_list->entries );
+
+		internal_access_control_list->entries = NULL;
 	}
+	internal_access_control_list->number_of_entries           = 0;
+	internal_access_control_list->number_of_allocated_entries = 0;
+
 	return( -1 );
 }
 
@@ -455,20 +541,19 @@ int libfwnt_access_control_list_get_number_of_entries(
 	}
 	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_access_control_list->entries_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( number_of_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of access control entries in array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_entries = internal_access_control_list->number_of_entries;
+
 	return( 1 );
 }
 
@@ -497,22 +582,966 @@ int libfwnt_access_control_list_get_entry_by_index(
 	}
 	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_access_control_list->entries_array,
-	     entry_index,
-	     (intptr_t **) access_control_entry,
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_access_control_list->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	*access_control_entry = (libfwnt_access_control_entry_t *) internal_access_control_list->entries[ entry_index ];
+
+	return( 1 );
+}
+
+/* Determines the access granted by the access control list to an access token
+ * The entries are evaluated in order, an access right is granted or denied by
+ * the first entry that applies to it. Inherit-only entries are skipped.
+ * The conditions of callback entries are not evaluated, allowed callback entries
+ * are ignored and denied callback entries are applied. Object entries are ignored.
+ * If owner_security_identifier is set and the owner is contained in the access token
+ * read control and write DAC access is implicitly granted, unless the access
+ * control list contains an owner rights entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_list_check_access(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *owner_security_identifier,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	libfwnt_internal_security_identifier_t *internal_security_identifier   = NULL;
+	static char *function                                                  = "libfwnt_internal_access_control_list_check_access";
+	uint32_t access_mask                                                   = 0;
+	uint32_t allowed_access                                                = 0;
+	uint32_t denied_access                                                 = 0;
+	uint8_t is_allowed                                                     = 0;
+	uint8_t is_owner                                                       = 0;
+	uint8_t maximum_allowed                                                = 0;
+	int entry_index                                                        = 0;
+	int result                                                             = 0;
+
+	if( internal_access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( desired_access & LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED ) != 0 )
+	{
+		maximum_allowed = 1;
+		desired_access &= ~( (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED );
+	}
+	if( owner_security_identifier != NULL )
+	{
+		is_owner = (uint8_t) libfwnt_internal_access_token_contains(
+		                      internal_access_token,
+		                      owner_security_identifier );
+	}
+	if( is_owner != 0 )
+	{
+		allowed_access = LIBFWNT_ACCESS_MASK_READ_CONTROL | LIBFWNT_ACCESS_MASK_WRITE_DAC;
+
+		for( entry_index = 0;
+		     entry_index < internal_access_control_list->number_of_entries;
+		     entry_index++ )
+		{
+			internal_access_control_entry = internal_access_control_list->entries[ entry_index ];
+
+			if( ( ( internal_access_control_entry->flags & LIBFWNT_ACE_FLAG_INHERIT_ONLY ) == 0 )
+			 && ( libfwnt_well_known_security_identifier_get_type(
+			       (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier ) == LIBFWNT_WELL_KNOWN_SID_OWNER_RIGHTS ) )
+			{
+				allowed_access = 0;
+
+				break;
+			}
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < internal_access_control_list->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( maximum_allowed == 0 )
+		 && ( ( desired_access & ~( allowed_access | denied_access ) ) == 0 ) )
+		{
+			break;
+		}
+		internal_access_control_entry = internal_access_control_list->entries[ entry_index ];
+
+		if( ( internal_access_control_entry->flags & LIBFWNT_ACE_FLAG_INHERIT_ONLY ) != 0 )
+		{
+			continue;
+		}
+		switch( internal_access_control_entry->type )
+		{
+			case LIBFWNT_ACCESS_ALLOWED:
+				is_allowed = 1;
+				break;
+
+			case LIBFWNT_ACCESS_DENIED:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK:
+				is_allowed = 0;
+				break;
+
+			default:
+				continue;
+		}
+		/* Only the access rights that have not been granted or denied by a previous entry are affected
+		 */
+		access_mask = internal_access_control_entry->access_mask & ~( allowed_access | denied_access );
+
+		if( access_mask == 0 )
+		{
+			continue;
+		}
+		internal_security_identifier = (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier;
+
+		if( libfwnt_well_known_security_identifier_get_type(
+		     internal_security_identifier ) == LIBFWNT_WELL_KNOWN_SID_OWNER_RIGHTS )
+		{
+			result = (int) is_owner;
+		}
+		else
+		{
+			result = libfwnt_internal_access_token_contains(
+			          internal_access_token,
+			          internal_security_identifier );
+		}
+		if( result == 0 )
+		{
+			continue;
+		}
+		if( is_allowed != 0 )
+		{
+			allowed_access |= access_mask;
+		}
+		else
+		{
+			denied_access |= access_mask;
+		}
+	}
+	if( maximum_allowed == 0 )
+	{
+		allowed_access &= desired_access;
+	}
+	*granted_access = allowed_access;
+
+	return( 1 );
+}
+
+/* Determines the access granted by the access control list to an access token
+ * If desired_access contains LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED all the access
+ * rights granted to the access token are returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_check_access(
+     libfwnt_access_control_list_t *access_control_list,
+     libfwnt_access_token_t *access_token,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_list_check_access";
+
+	if( libfwnt_internal_access_control_list_check_access(
+	     (libfwnt_internal_access_control_list_t *) access_control_list,
+	     (libfwnt_internal_access_token_t *) access_token,
+	     NULL,
+	     desired_access,
+	     granted_access,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve access control entry: %d from array.",
-		 function,
-		 entry_index );
+		 "%s: unable to check access.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a new empty access control entry at a specific index
+ * The entry is owned by the list and has no security identifier until its values are set
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_list_insert_entry(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     int entry_index,
+     libfwnt_internal_access_control_entry_t **internal_access_control_entry,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t **entries                  = NULL;
+	libfwnt_internal_access_control_entry_t *new_access_control_entry = NULL;
+	static char *function                                              = "libfwnt_internal_access_control_list_insert_entry";
+	int number_of_allocated_entries                                    = 0;
+	int shift_index                                                    = 0;
+
+	if( internal_access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index > internal_access_control_list->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_control_list->number_of_entries >= (int) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid access control list - number of entries value exceeds maximum.",
+		 function );
 
 		return( -1 );
 	}
+	if( internal_access_control_list->number_of_entries >= internal_access_control_list->number_of_allocated_entries )
+	{
+		if( internal_access_control_list->number_of_allocated_entries < 4 )
+		{
+			number_of_allocated_entries = 4;
+		}
+		else
+		{
+			number_of_allocated_entries = internal_access_control_list->number_of_allocated_entries * 2;
+		}
+		if( number_of_allocated_entries > (int) UINT16_MAX )
+		{
+			number_of_allocated_entries = (int) UINT16_MAX;
+		}
+		entries = (libfwnt_internal_access_control_entry_t **) libfwnt_arena_allocate(
+		           internal_access_control_list->arena,
+		           sizeof( libfwnt_internal_access_control_entry_t * ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     entries,
+		     0,
+		     sizeof( libfwnt_internal_access_control_entry_t * ) * number_of_allocated_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			libfwnt_arena_release(
+			 internal_access_control_list->arena,
+			 entries );
+
+			return( -1 );
+		}
+		if( internal_access_control_list->entries != NULL )
+		{
+			if( memory_copy(
+			     entries,
+			     internal_access_control_list->entries,
+			     sizeof( libfwnt_internal_access_control_entry_t * ) * internal_access_control_list->number_of_allocated_entries ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy entries.",
+				 function );
+
+				libfwnt_arena_release(
+				 internal_access_control_list->arena,
+				 entries );
+
+				return( -1 );
+			}
+			libfwnt_arena_release(
+			 internal_access_control_list->arena,
+			 internal_access_control_list->entries );
+		}
+		internal_access_control_list->entries                     = entries;
+		internal_access_control_list->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	/* An entry retained from a previously read list is not reused
+	 * since it still contains the values of that list
+	 */
+	if( internal_access_control_list->entries[ internal_access_control_list->number_of_entries ] != NULL )
+	{
+		if( libfwnt_internal_access_control_entry_free(
+		     &( internal_access_control_list->entries[ internal_access_control_list->number_of_entries ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free retained access control entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_access_control_entry_initialize_with_arena(
+	     (libfwnt_access_control_entry_t **) &new_access_control_entry,
+	     internal_access_control_list->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	for( shift_index = internal_access_control_list->number_of_entries;
+	     shift_index > entry_index;
+	     shift_index-- )
+	{
+		internal_access_control_list->entries[ shift_index ] = internal_access_control_list->entries[ shift_index - 1 ];
+	}
+	internal_access_control_list->entries[ entry_index ] = new_access_control_entry;
+
+	internal_access_control_list->number_of_entries += 1;
+
+	*internal_access_control_entry = new_access_control_entry;
+
+	return( 1 );
+}
+
+/* Appends a new empty access control entry
+ * The entry is owned by the list, use libfwnt_access_control_entry_set_values to set its values
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_append_entry(
+     libfwnt_access_control_list_t *access_control_list,
+     libfwnt_access_control_entry_t **access_control_entry,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_list_t *internal_access_control_list = NULL;
+	static char *function                                                = "libfwnt_access_control_list_append_entry";
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
+
+	if( libfwnt_internal_access_control_list_insert_entry(
+	     internal_access_control_list,
+	     internal_access_control_list->number_of_entries,
+	     (libfwnt_internal_access_control_entry_t **) access_control_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Inserts a new empty access control entry at a specific index
+ * The entry is owned by the list, use libfwnt_access_control_entry_set_values to set its values
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_insert_entry(
+     libfwnt_access_control_list_t *access_control_list,
+     int entry_index,
+     libfwnt_access_control_entry_t **access_control_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_list_insert_entry";
+
+	if( libfwnt_internal_access_control_list_insert_entry(
+	     (libfwnt_internal_access_control_list_t *) access_control_list,
+	     entry_index,
+	     (libfwnt_internal_access_control_entry_t **) access_control_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert access control entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a specific access control entry
+ * References to the entry are no longer valid after it is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_remove_entry(
+     libfwnt_access_control_list_t *access_control_list,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_list_t *internal_access_control_list = NULL;
+	static char *function                                                = "libfwnt_access_control_list_remove_entry";
+	int shift_index                                                      = 0;
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
+
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_access_control_list->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_control_entry_free(
+	     &( internal_access_control_list->entries[ entry_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free access control entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	for( shift_index = entry_index;
+	     shift_index < ( internal_access_control_list->number_of_entries - 1 );
+	     shift_index++ )
+	{
+		internal_access_control_list->entries[ shift_index ] = internal_access_control_list->entries[ shift_index + 1 ];
+	}
+	internal_access_control_list->number_of_entries -= 1;
+
+	internal_access_control_list->entries[ internal_access_control_list->number_of_entries ] = NULL;
+
+	return( 1 );
+}
+
+/* Normalizes an access control list
+ * Consecutive entries of the same type and inheritance are sorted and duplicate entries
+ * within them are removed, since their order does not affect the result of an access check
+ * The revision number is reset so the minimal revision is stored
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_list_normalize(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *access_control_entry = NULL;
+	libfwnt_internal_access_control_entry_t *first_entry          = NULL;
+	static char *function                                         = "libfwnt_internal_access_control_list_normalize";
+	int entry_index                                               = 0;
+	int run_end_index                                             = 0;
+	int run_start_index                                           = 0;
+	int sort_index                                                = 0;
+	int result                                                    = 0;
+
+	if( internal_access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	while( run_start_index < internal_access_control_list->number_of_entries )
+	{
+		first_entry = internal_access_control_list->entries[ run_start_index ];
+
+		for( run_end_index = run_start_index + 1;
+		     run_end_index < internal_access_control_list->number_of_entries;
+		     run_end_index++ )
+		{
+			access_control_entry = internal_access_control_list->entries[ run_end_index ];
+
+			if( ( access_control_entry->type != first_entry->type )
+			 || ( ( access_control_entry->flags & LIBFWNT_ACE_FLAG_INHERITED ) != ( first_entry->flags & LIBFWNT_ACE_FLAG_INHERITED ) ) )
+			{
+				break;
+			}
+		}
+		/* Sort the entries of the run using insertion sort since runs are typically short
+		 */
+		for( entry_index = run_start_index + 1;
+		     entry_index < run_end_index;
+		     entry_index++ )
+		{
+			access_control_entry = internal_access_control_list->entries[ entry_index ];
+
+			for( sort_index = entry_index;
+			     sort_index > run_start_index;
+			     sort_index-- )
+			{
+				result = libfwnt_internal_access_control_entry_compare(
+				          internal_access_control_list->entries[ sort_index - 1 ],
+				          access_control_entry,
+				          error );
+
+				if( result == -1 )
+				{
+					internal_access_control_list->entries[ sort_index ] = access_control_entry;
+
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare access control entries.",
+					 function );
+
+					return( -1 );
+				}
+				else if( result != LIBFWNT_COMPARE_GREATER )
+				{
+					break;
+				}
+				internal_access_control_list->entries[ sort_index ] = internal_access_control_list->entries[ sort_index - 1 ];
+			}
+			internal_access_control_list->entries[ sort_index ] = access_control_entry;
+		}
+		/* Remove duplicate entries, which are adjacent after sorting
+		 */
+		entry_index = run_start_index + 1;
+
+		while( entry_index < run_end_index )
+		{
+			result = libfwnt_internal_access_control_entry_compare(
+			          internal_access_control_list->entries[ entry_index - 1 ],
+			          internal_access_control_list->entries[ entry_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare access control entries.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != LIBFWNT_COMPARE_EQUAL )
+			{
+				entry_index++;
+
+				continue;
+			}
+			if( libfwnt_access_control_list_remove_entry(
+			     (libfwnt_access_control_list_t *) internal_access_control_list,
+			     entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove duplicate access control entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			run_end_index--;
+		}
+		run_start_index = run_end_index;
+	}
+	internal_access_control_list->revision_number = 0;
+
+	return( 1 );
+}
+
+/* Determines the size of an access control list as stored in a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_control_list_get_data_size(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_access_control_list_get_data_size";
+	size_t entry_size     = 0;
+	size_t list_size      = 8;
+	int entry_index       = 0;
+
+	if( internal_access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_access_control_list->number_of_entries;
+	     entry_index++ )
+	{
+		if( libfwnt_internal_access_control_entry_get_data_size(
+		     internal_access_control_list->entries[ entry_index ],
+		     &entry_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of access control entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		list_size += entry_size;
+
+		if( list_size > (size_t) UINT16_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid access control list size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*data_size = list_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the access control list as stored in a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_get_data_size(
+     libfwnt_access_control_list_t *access_control_list,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_control_list_get_data_size";
+
+	if( libfwnt_internal_access_control_list_get_data_size(
+	     (libfwnt_internal_access_control_list_t *) access_control_list,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts an access control list into a byte stream
+ * This is the inverse of libfwnt_access_control_list_copy_from_byte_stream
+ * A revision number of 0 is written as 2 and as 4 if the list contains object entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_control_list_copy_to_byte_stream(
+     libfwnt_access_control_list_t *access_control_list,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	libfwnt_internal_access_control_list_t *internal_access_control_list   = NULL;
+	static char *function                                                  = "libfwnt_access_control_list_copy_to_byte_stream";
+	size_t byte_stream_offset                                              = 8;
+	size_t entry_size                                                      = 0;
+	size_t list_size                                                       = 0;
+	uint8_t revision_number                                                = 0;
+	int entry_index                                                        = 0;
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_control_list = (libfwnt_internal_access_control_list_t *) access_control_list;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_control_list_get_data_size(
+	     internal_access_control_list,
+	     &list_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine access control list size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < list_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	revision_number = internal_access_control_list->revision_number;
+
+	if( revision_number == 0 )
+	{
+		revision_number = 2;
+	}
+	for( entry_index = 0;
+	     entry_index < internal_access_control_list->number_of_entries;
+	     entry_index++ )
+	{
+		internal_access_control_entry = internal_access_control_list->entries[ entry_index ];
+
+		if( libfwnt_internal_access_control_entry_get_data_size(
+		     internal_access_control_entry,
+		     &entry_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of access control entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_entry_copy_to_byte_stream(
+		     (libfwnt_access_control_entry_t *) internal_access_control_entry,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     entry_size,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy access control entry: %d to byte stream.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		byte_stream_offset += entry_size;
+
+		/* Object entries require revision 4 (ACL_REVISION_DS)
+		 */
+		switch( internal_access_control_entry->type )
+		{
+			case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_OBJECT:
+			case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+			case LIBFWNT_SYSTEM_ALARM_OBJECT:
+			case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+			case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+			case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+			case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+				if( revision_number < 4 )
+				{
+					revision_number = 4;
+				}
+				break;
+
+			default:
+				break;
+		}
+	}
+	byte_stream[ 0 ] = revision_number;
+	byte_stream[ 1 ] = 0;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 (uint16_t) list_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 (uint16_t) internal_access_control_list->number_of_entries );
+
+	byte_stream[ 6 ] = 0;
+	byte_stream[ 7 ] = 0;
+
 	return( 1 );
 }
 
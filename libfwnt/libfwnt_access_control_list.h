@@ -25,9 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwnt_access_control_entry.h"
+#include "libfwnt_access_token.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_extern.h"
-#include "libfwnt_libcdata.h"
 #include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier.h"
 #include "libfwnt_types.h"
 
 #if defined( __cplusplus )
@@ -47,15 +50,32 @@ struct libfwnt_internal_access_control_list
 	 */
 	uint8_t revision_number;
 
-	/* The (access control) entries array
+	/* The number of (access control) entries
 	 */
-	libcdata_array_t *entries_array;
+	int number_of_entries;
+
+	/* The (access control) entries
+	 */
+	libfwnt_internal_access_control_entry_t **entries;
+
+	/* The number of allocated (access control) entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The arena the list was allocated from
+	 */
+	libfwnt_arena_t *arena;
 };
 
 int libfwnt_access_control_list_initialize(
      libfwnt_access_control_list_t **access_control_list,
      libcerror_error_t **error );
 
+int libfwnt_access_control_list_initialize_with_arena(
+     libfwnt_access_control_list_t **access_control_list,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_access_control_list_free(
      libfwnt_access_control_list_t **access_control_list,
@@ -85,6 +105,70 @@ int libfwnt_access_control_list_get_entry_by_index(
      libfwnt_access_control_entry_t **access_control_entry,
      libcerror_error_t **error );
 
+int libfwnt_internal_access_control_list_check_access(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *owner_security_identifier,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_check_access(
+     libfwnt_access_control_list_t *access_control_list,
+     libfwnt_access_token_t *access_token,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_list_insert_entry(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     int entry_index,
+     libfwnt_internal_access_control_entry_t **internal_access_control_entry,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_append_entry(
+     libfwnt_access_control_list_t *access_control_list,
+     libfwnt_access_control_entry_t **access_control_entry,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_insert_entry(
+     libfwnt_access_control_list_t *access_control_list,
+     int entry_index,
+     libfwnt_access_control_entry_t **access_control_entry,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_remove_entry(
+     libfwnt_access_control_list_t *access_control_list,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_list_normalize(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_control_list_get_data_size(
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_get_data_size(
+     libfwnt_access_control_list_t *access_control_list,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_control_list_copy_to_byte_stream(
+     libfwnt_access_control_list_t *access_control_list,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,617 @@
+/*
+ * Windows NT access token functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_access_token.h"
+#include "libfwnt_allocator.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_types.h"
+
+/* Creates an access token
+ * Make sure the value access_token is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_initialize(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_initialize";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_token != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access token value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = libfwnt_allocator_allocate_structure(
+	                         libfwnt_internal_access_token_t );
+
+	if( internal_access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_access_token,
+	     0,
+	     sizeof( libfwnt_internal_access_token_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear access token.",
+		 function );
+
+		libfwnt_allocator_free(
+		 internal_access_token );
+
+		return( -1 );
+	}
+	*access_token = (libfwnt_access_token_t *) internal_access_token;
+
+	return( 1 );
+}
+
+/* Frees an access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_free(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_free";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_token != NULL )
+	{
+		internal_access_token = (libfwnt_internal_access_token_t *) *access_token;
+		*access_token         = NULL;
+
+		if( internal_access_token->security_identifiers != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_access_token->security_identifiers );
+		}
+		if( internal_access_token->hashes != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_access_token->hashes );
+		}
+		libfwnt_allocator_free(
+		 internal_access_token );
+	}
+	return( 1 );
+}
+
+/* Finds a security identifier in the access token
+ * If not NULL insert_index is set to the index where the security identifier
+ * should be inserted to keep the hashes sorted
+ * Returns the index or -1 if not available
+ */
+int libfwnt_internal_access_token_find(
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     uint64_t hash,
+     int *insert_index )
+{
+	int lower_index  = 0;
+	int middle_index = 0;
+	int upper_index  = 0;
+
+	upper_index = internal_access_token->number_of_security_identifiers;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( internal_access_token->hashes[ middle_index ] < hash )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( insert_index != NULL )
+	{
+		*insert_index = lower_index;
+	}
+	while( ( lower_index < internal_access_token->number_of_security_identifiers )
+	    && ( internal_access_token->hashes[ lower_index ] == hash ) )
+	{
+		if( libfwnt_security_identifier_is_equal(
+		     (libfwnt_security_identifier_t *) &( internal_access_token->security_identifiers[ lower_index ] ),
+		     (libfwnt_security_identifier_t *) internal_security_identifier,
+		     NULL ) == 1 )
+		{
+			return( lower_index );
+		}
+		lower_index++;
+	}
+	return( -1 );
+}
+
+/* Determines if the access token contains a specific security identifier
+ * Returns 1 if the security identifier is contained in the access token or 0 if not
+ */
+int libfwnt_internal_access_token_contains(
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *internal_security_identifier )
+{
+	uint64_t hash = 0;
+
+	if( ( internal_access_token == NULL )
+	 || ( internal_security_identifier == NULL )
+	 || ( internal_access_token->number_of_security_identifiers == 0 ) )
+	{
+		return( 0 );
+	}
+	hash = libfwnt_internal_security_identifier_get_hash(
+	        internal_security_identifier );
+
+	if( libfwnt_internal_access_token_find(
+	     internal_access_token,
+	     internal_security_identifier,
+	     hash,
+	     NULL ) == -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends a security identifier to the access token
+ * A security identifier that is already contained in the access token is not appended again
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_access_token_append(
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *security_identifiers = NULL;
+	static char *function                                        = "libfwnt_internal_access_token_append";
+	uint64_t *hashes                                             = NULL;
+	uint64_t hash                                                = 0;
+	int entry_index                                              = 0;
+	int insert_index                                             = 0;
+	int number_of_allocated_security_identifiers                 = 0;
+
+	if( internal_access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfwnt_internal_security_identifier_get_hash(
+	        internal_security_identifier );
+
+	if( libfwnt_internal_access_token_find(
+	     internal_access_token,
+	     internal_security_identifier,
+	     hash,
+	     &insert_index ) != -1 )
+	{
+		return( 1 );
+	}
+	if( internal_access_token->number_of_security_identifiers >= ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of security identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_token->number_of_security_identifiers >= internal_access_token->number_of_allocated_security_identifiers )
+	{
+		number_of_allocated_security_identifiers = internal_access_token->number_of_allocated_security_identifiers * 2;
+
+		if( number_of_allocated_security_identifiers < 16 )
+		{
+			number_of_allocated_security_identifiers = 16;
+		}
+		security_identifiers = (libfwnt_internal_security_identifier_t *) libfwnt_allocator_reallocate(
+		                                                                   internal_access_token->security_identifiers,
+		                                                                   sizeof( libfwnt_internal_security_identifier_t ) * number_of_allocated_security_identifiers );
+
+		if( security_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize security identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		internal_access_token->security_identifiers = security_identifiers;
+
+		hashes = (uint64_t *) libfwnt_allocator_reallocate(
+		                       internal_access_token->hashes,
+		                       sizeof( uint64_t ) * number_of_allocated_security_identifiers );
+
+		if( hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hashes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_access_token->hashes                                   = hashes;
+		internal_access_token->number_of_allocated_security_identifiers = number_of_allocated_security_identifiers;
+	}
+	/* Move the entries after the insert index one position to keep the hashes sorted
+	 */
+	for( entry_index = internal_access_token->number_of_security_identifiers;
+	     entry_index > insert_index;
+	     entry_index-- )
+	{
+		internal_access_token->security_identifiers[ entry_index ] = internal_access_token->security_identifiers[ entry_index - 1 ];
+		internal_access_token->hashes[ entry_index ]               = internal_access_token->hashes[ entry_index - 1 ];
+	}
+	/* Only the values are copied, the cached string is not shared with the access token
+	 */
+	if( libfwnt_internal_security_identifier_copy_values(
+	     &( internal_access_token->security_identifiers[ insert_index ] ),
+	     internal_security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token->hashes[ insert_index ] = hash;
+
+	internal_access_token->number_of_security_identifiers += 1;
+
+	return( 1 );
+}
+
+/* Appends a security identifier to the access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_append_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_token_append_security_identifier";
+
+	if( libfwnt_internal_access_token_append(
+	     (libfwnt_internal_access_token_t *) access_token,
+	     (libfwnt_internal_security_identifier_t *) security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a security identifier stored in a byte stream to the access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_append_byte_stream(
+     libfwnt_access_token_t *access_token,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t security_identifier;
+
+	static char *function = "libfwnt_access_token_append_byte_stream";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &security_identifier,
+	     0,
+	     sizeof( libfwnt_internal_security_identifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     (libfwnt_security_identifier_t *) &security_identifier,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_access_token_append(
+	     (libfwnt_internal_access_token_t *) access_token,
+	     &security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of security identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_get_number_of_security_identifiers(
+     libfwnt_access_token_t *access_token,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_token_t *internal_access_token = NULL;
+	static char *function                                  = "libfwnt_access_token_get_number_of_security_identifiers";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	internal_access_token = (libfwnt_internal_access_token_t *) access_token;
+
+	if( number_of_security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_security_identifiers = internal_access_token->number_of_security_identifiers;
+
+	return( 1 );
+}
+
+/* Determines if the access token contains a specific security identifier
+ * Returns 1 if the security identifier is contained in the access token, 0 if not or -1 on error
+ */
+int libfwnt_access_token_contains_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_access_token_contains_security_identifier";
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( libfwnt_internal_access_token_contains(
+	         (libfwnt_internal_access_token_t *) access_token,
+	         (libfwnt_internal_security_identifier_t *) security_identifier ) );
+}
+
+/* Determines the access granted to the access token by multiple security descriptors
+ * granted_access_masks must contain an access mask for every security descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_access_token_check_access_for_security_descriptors(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_descriptor_t **security_descriptors,
+     int number_of_security_descriptors,
+     uint32_t desired_access,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfwnt_access_token_check_access_for_security_descriptors";
+	int security_descriptor_index = 0;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_security_descriptors < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of security descriptors value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access_masks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access masks.",
+		 function );
+
+		return( -1 );
+	}
+	for( security_descriptor_index = 0;
+	     security_descriptor_index < number_of_security_descriptors;
+	     security_descriptor_index++ )
+	{
+		if( libfwnt_security_descriptor_check_access(
+		     security_descriptors[ security_descriptor_index ],
+		     access_token,
+		     desired_access,
+		     &( granted_access_masks[ security_descriptor_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check access of security descriptor: %d.",
+			 function,
+			 security_descriptor_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,128 @@
+/*
+ * Windows NT access token functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_ACCESS_TOKEN_H )
+#define _LIBFWNT_INTERNAL_ACCESS_TOKEN_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* An access token contains the set of security identifiers (SIDs) of a principal,
+ * such as its user and group SIDs, that is used to evaluate access checks.
+ * The security identifiers are stored by value and sorted by their hash.
+ */
+
+typedef struct libfwnt_internal_access_token libfwnt_internal_access_token_t;
+
+struct libfwnt_internal_access_token
+{
+	/* The security identifiers
+	 */
+	libfwnt_internal_security_identifier_t *security_identifiers;
+
+	/* The hashes of the security identifiers
+	 */
+	uint64_t *hashes;
+
+	/* The number of security identifiers
+	 */
+	int number_of_security_identifiers;
+
+	/* The number of allocated security identifiers
+	 */
+	int number_of_allocated_security_identifiers;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_initialize(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_free(
+     libfwnt_access_token_t **access_token,
+     libcerror_error_t **error );
+
+int libfwnt_internal_access_token_find(
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     uint64_t hash,
+     int *insert_index );
+
+int libfwnt_internal_access_token_contains(
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *internal_security_identifier );
+
+int libfwnt_internal_access_token_append(
+     libfwnt_internal_access_token_t *internal_access_token,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_append_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_append_byte_stream(
+     libfwnt_access_token_t *access_token,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_get_number_of_security_identifiers(
+     libfwnt_access_token_t *access_token,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_contains_security_identifier(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_access_token_check_access_for_security_descriptors(
+     libfwnt_access_token_t *access_token,
+     libfwnt_security_descriptor_t **security_descriptors,
+     int number_of_security_descriptors,
+     uint32_t desired_access,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_ACCESS_TOKEN_H ) */
+
@@ -0,0 +1,207 @@
+/*
+ * Memory allocator functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_allocator.h"
+#include "libfwnt_atomic.h"
+#include "libfwnt_libcerror.h"
+
+/* The allocator used for the heap allocations of the library
+ * If the functions are not set the system allocator is used
+ */
+static libfwnt_allocator_t libfwnt_allocator = {
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+/* The number of allocations made with the allocator that have not been freed
+ * or LIBFWNT_ALLOCATOR_STATE_CHANGING while the allocator functions are changed
+ */
+static libfwnt_atomic_int32_t libfwnt_allocator_state = 0;
+
+/* Sets the memory allocator functions
+ * Either all functions must be set or none to restore the system allocator
+ * The functions can only be changed when all memory allocated with the current
+ * allocator has been freed, since memory must be freed by the allocator that
+ * allocated it
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_allocator_set_functions(
+     void *(*allocate_function)(
+              void *context,
+              size_t size ),
+     void *(*reallocate_function)(
+              void *context,
+              void *memory,
+              size_t size ),
+     void (*free_function)(
+             void *context,
+             void *memory ),
+     void *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_allocator_set_functions";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		context = NULL;
+	}
+	else if( ( allocate_function == NULL )
+	      || ( reallocate_function == NULL )
+	      || ( free_function == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocator functions - all or none of the functions must be set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_atomic_compare_and_swap(
+	     &libfwnt_allocator_state,
+	     0,
+	     LIBFWNT_ALLOCATOR_STATE_CHANGING ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocator - memory allocated by the allocator has not been freed.",
+		 function );
+
+		return( -1 );
+	}
+	libfwnt_allocator.allocate   = allocate_function;
+	libfwnt_allocator.reallocate = reallocate_function;
+	libfwnt_allocator.free       = free_function;
+	libfwnt_allocator.context    = context;
+
+	libfwnt_atomic_set(
+	 &libfwnt_allocator_state,
+	 0 );
+
+	return( 1 );
+}
+
+/* Allocates memory
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libfwnt_allocator_allocate(
+       size_t size )
+{
+	void *memory  = NULL;
+	int32_t state = 0;
+
+	/* Count the allocation before the allocator functions are used,
+	 * which prevents them from being changed concurrently
+	 */
+	for( ;; )
+	{
+		state = libfwnt_atomic_get(
+		         &libfwnt_allocator_state );
+
+		if( ( state >= 0 )
+		 && ( libfwnt_atomic_compare_and_swap(
+		       &libfwnt_allocator_state,
+		       state,
+		       state + 1 ) != 0 ) )
+		{
+			break;
+		}
+	}
+	if( libfwnt_allocator.allocate != NULL )
+	{
+		memory = libfwnt_allocator.allocate(
+		          libfwnt_allocator.context,
+		          size );
+	}
+	else
+	{
+		memory = memory_allocate(
+		          size );
+	}
+	if( memory == NULL )
+	{
+		libfwnt_atomic_decrement(
+		 &libfwnt_allocator_state );
+	}
+	return( memory );
+}
+
+/* Reallocates memory
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libfwnt_allocator_reallocate(
+       void *memory,
+       size_t size )
+{
+	if( memory == NULL )
+	{
+		return( libfwnt_allocator_allocate(
+		         size ) );
+	}
+	/* The allocator functions cannot change while the memory is allocated
+	 */
+	if( libfwnt_allocator.reallocate != NULL )
+	{
+		return( libfwnt_allocator.reallocate(
+		         libfwnt_allocator.context,
+		         memory,
+		         size ) );
+	}
+	return( memory_reallocate(
+	         memory,
+	         size ) );
+}
+
+/* Frees memory
+ */
+void libfwnt_allocator_free(
+      void *memory )
+{
+	if( memory == NULL )
+	{
+		return;
+	}
+	if( libfwnt_allocator.free != NULL )
+	{
+		libfwnt_allocator.free(
+		 libfwnt_allocator.context,
+		 memory );
+	}
+	else
+	{
+		memory_free(
+		 memory );
+	}
+	libfwnt_atomic_decrement(
+	 &libfwnt_allocator_state );
+}
+
@@ -0,0 +1,100 @@
+/*
+ * Memory allocator functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ALLOCATOR_H )
+#define _LIBFWNT_ALLOCATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The allocator state while the allocator functions are changed
+ */
+#define LIBFWNT_ALLOCATOR_STATE_CHANGING	-1
+
+#define libfwnt_allocator_allocate_structure( type ) \
+	(type *) libfwnt_allocator_allocate( sizeof( type ) )
+
+typedef struct libfwnt_allocator libfwnt_allocator_t;
+
+struct libfwnt_allocator
+{
+	/* The allocate function
+	 */
+	void *(*allocate)(
+	         void *context,
+	         size_t size );
+
+	/* The reallocate function
+	 */
+	void *(*reallocate)(
+	         void *context,
+	         void *memory,
+	         size_t size );
+
+	/* The free function
+	 */
+	void (*free)(
+	        void *context,
+	        void *memory );
+
+	/* The allocator context
+	 */
+	void *context;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_allocator_set_functions(
+     void *(*allocate_function)(
+              void *context,
+              size_t size ),
+     void *(*reallocate_function)(
+              void *context,
+              void *memory,
+              size_t size ),
+     void (*free_function)(
+             void *context,
+             void *memory ),
+     void *context,
+     libcerror_error_t **error );
+
+void *libfwnt_allocator_allocate(
+       size_t size );
+
+void *libfwnt_allocator_reallocate(
+       void *memory,
+       size_t size );
+
+void libfwnt_allocator_free(
+      void *memory );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ALLOCATOR_H ) */
+
@@ -0,0 +1,305 @@
+/*
+ * Memory arena functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_allocator.h"
+#include "libfwnt_arena.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+/* The size of the block header, the block data is stored directly after it
+ */
+#define LIBFWNT_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libfwnt_arena_block_t ) + ( LIBFWNT_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWNT_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * A block size of 0 represents the default block size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_initialize(
+     libfwnt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBFWNT_ARENA_BLOCK_HEADER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid block size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = libfwnt_allocator_allocate_structure(
+	                  libfwnt_internal_arena_t );
+
+	if( internal_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_arena,
+	     0,
+	     sizeof( libfwnt_internal_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( block_size == 0 )
+	{
+		block_size = LIBFWNT_ARENA_DEFAULT_BLOCK_SIZE;
+	}
+	internal_arena->block_size = block_size;
+
+	*arena = (libfwnt_arena_t *) internal_arena;
+
+	return( 1 );
+
+on_error:
+	if( internal_arena != NULL )
+	{
+		libfwnt_allocator_free(
+		 internal_arena );
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * This releases all memory allocated from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_free(
+     libfwnt_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libfwnt_arena_block_t *arena_block       = NULL;
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		internal_arena = (libfwnt_internal_arena_t *) *arena;
+		*arena         = NULL;
+
+		while( internal_arena->first_block != NULL )
+		{
+			arena_block                 = internal_arena->first_block;
+			internal_arena->first_block = arena_block->next_block;
+
+			libfwnt_allocator_free(
+			 arena_block );
+		}
+		libfwnt_allocator_free(
+		 internal_arena );
+	}
+	return( 1 );
+}
+
+/* Clears an arena
+ * This releases all memory allocated from the arena at once, the blocks
+ * of the arena are retained to be reused by subsequent allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_arena_clear(
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libfwnt_arena_block_t *arena_block       = NULL;
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	static char *function                    = "libfwnt_arena_clear";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libfwnt_internal_arena_t *) arena;
+
+	for( arena_block = internal_arena->first_block;
+	     arena_block != NULL;
+	     arena_block = arena_block->next_block )
+	{
+		arena_block->used_size = 0;
+	}
+	internal_arena->current_block = internal_arena->first_block;
+
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * If no arena is provided the memory is allocated using the allocator
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libfwnt_arena_allocate(
+       libfwnt_arena_t *arena,
+       size_t size )
+{
+	libfwnt_arena_block_t *arena_block       = NULL;
+	libfwnt_internal_arena_t *internal_arena = NULL;
+	uint8_t *memory                          = NULL;
+	size_t block_size                        = 0;
+
+	if( arena == NULL )
+	{
+		return( libfwnt_allocator_allocate(
+		         size ) );
+	}
+	internal_arena = (libfwnt_internal_arena_t *) arena;
+
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBFWNT_ARENA_BLOCK_HEADER_SIZE - LIBFWNT_ARENA_ALIGNMENT ) ) )
+	{
+		return( NULL );
+	}
+	size = ( size + ( LIBFWNT_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWNT_ARENA_ALIGNMENT - 1 );
+
+	arena_block = internal_arena->current_block;
+
+	/* Continue with the next retained block if the current block is full
+	 */
+	while( ( arena_block != NULL )
+	    && ( size > ( arena_block->size - arena_block->used_size ) ) )
+	{
+		if( arena_block->next_block == NULL )
+		{
+			break;
+		}
+		if( size > arena_block->next_block->size )
+		{
+			break;
+		}
+		arena_block                   = arena_block->next_block;
+		internal_arena->current_block = arena_block;
+	}
+	if( ( arena_block == NULL )
+	 || ( size > ( arena_block->size - arena_block->used_size ) ) )
+	{
+		block_size = internal_arena->block_size;
+
+		if( block_size < size )
+		{
+			block_size = size;
+		}
+		arena_block = (libfwnt_arena_block_t *) libfwnt_allocator_allocate(
+		                                         LIBFWNT_ARENA_BLOCK_HEADER_SIZE + block_size );
+
+		if( arena_block == NULL )
+		{
+			return( NULL );
+		}
+		arena_block->size      = block_size;
+		arena_block->used_size = 0;
+
+		if( internal_arena->current_block == NULL )
+		{
+			arena_block->next_block     = NULL;
+			internal_arena->first_block = arena_block;
+		}
+		else
+		{
+			arena_block->next_block                   = internal_arena->current_block->next_block;
+			internal_arena->current_block->next_block = arena_block;
+		}
+		internal_arena->current_block = arena_block;
+	}
+	memory = &( ( (uint8_t *) arena_block )[ LIBFWNT_ARENA_BLOCK_HEADER_SIZE + arena_block->used_size ] );
+
+	arena_block->used_size += size;
+
+	return( memory );
+}
+
+/* Releases memory allocated from an arena
+ * Memory allocated from an arena is only released when the arena is cleared or freed
+ * If no arena is provided the memory is freed using the allocator
+ */
+void libfwnt_arena_release(
+      libfwnt_arena_t *arena,
+      void *memory )
+{
+	if( arena == NULL )
+	{
+		libfwnt_allocator_free(
+		 memory );
+	}
+}
+
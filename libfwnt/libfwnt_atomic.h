@@ -0,0 +1,101 @@
+/*
+ * Atomic operations
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_ATOMIC_H )
+#define _LIBFWNT_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* All operations are sequentially consistent
+ */
+#if defined( _MSC_VER )
+
+typedef volatile LONG libfwnt_atomic_int32_t;
+
+#define libfwnt_atomic_get( value ) \
+	(int32_t) InterlockedCompareExchange( value, 0, 0 )
+
+#define libfwnt_atomic_set( value, new_value ) \
+	InterlockedExchange( value, (LONG) ( new_value ) )
+
+#define libfwnt_atomic_compare_and_swap( value, expected_value, new_value ) \
+	( InterlockedCompareExchange( value, (LONG) ( new_value ), (LONG) ( expected_value ) ) == (LONG) ( expected_value ) )
+
+#define libfwnt_atomic_increment( value ) \
+	(int32_t) InterlockedIncrement( value )
+
+#define libfwnt_atomic_decrement( value ) \
+	(int32_t) InterlockedDecrement( value )
+
+#elif defined( __GNUC__ ) || defined( __clang__ )
+
+typedef int32_t libfwnt_atomic_int32_t;
+
+#define libfwnt_atomic_get( value ) \
+	__atomic_load_n( value, __ATOMIC_SEQ_CST )
+
+#define libfwnt_atomic_set( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_SEQ_CST )
+
+#define libfwnt_atomic_compare_and_swap( value, expected_value, new_value ) \
+	__sync_bool_compare_and_swap( value, expected_value, new_value )
+
+#define libfwnt_atomic_increment( value ) \
+	__atomic_add_fetch( value, 1, __ATOMIC_SEQ_CST )
+
+#define libfwnt_atomic_decrement( value ) \
+	__atomic_sub_fetch( value, 1, __ATOMIC_SEQ_CST )
+
+#else
+
+/* Without compiler support the operations are not atomic,
+ * which is only safe when the library is used by a single thread
+ */
+typedef volatile int32_t libfwnt_atomic_int32_t;
+
+#define libfwnt_atomic_get( value ) \
+	( *( value ) )
+
+#define libfwnt_atomic_set( value, new_value ) \
+	*( value ) = ( new_value )
+
+#define libfwnt_atomic_compare_and_swap( value, expected_value, new_value ) \
+	( ( *( value ) == ( expected_value ) ) ? ( *( value ) = ( new_value ), 1 ) : 0 )
+
+#define libfwnt_atomic_increment( value ) \
+	( ++( *( value ) ) )
+
+#define libfwnt_atomic_decrement( value ) \
+	( --( *( value ) ) )
+
+#endif /* defined( _MSC_VER ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_ATOMIC_H ) */
+
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwnt_allocator.h"
 #include "libfwnt_bit_stream.h"
 #include "libfwnt_libcerror.h"
 
@@ -82,7 +83,7 @@ int libfwnt_bit_stream_initialize(
 
 		return( -1 );
 	}
-	*bit_stream = memory_allocate_structure(
+	*bit_stream = libfwnt_allocator_allocate_structure(
 	               libfwnt_bit_stream_t );
 
 	if( *bit_stream == NULL )
@@ -118,7 +119,7 @@ int libfwnt_bit_stream_initialize(
 on_error:
 	if( *bit_stream != NULL )
 	{
-		memory_free(
+		libfwnt_allocator_free(
 		 *bit_stream );
 
 		*bit_stream = NULL;
@@ -148,7 +149,7 @@ int libfwnt_bit_stream_free(
 	}
 	if( *bit_stream != NULL )
 	{
-		memory_free(
+		libfwnt_allocator_free(
 		 *bit_stream );
 
 		*bit_stream = NULL;
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfwnt_allocator.h"
 #include "libfwnt_bit_stream.h"
 #include "libfwnt_huffman_tree.h"
 #include "libfwnt_libcerror.h"
@@ -86,7 +87,7 @@ int libfwnt_huffman_tree_initialize(
 
 		return( -1 );
 	}
-	*huffman_tree = memory_allocate_structure(
+	*huffman_tree = libfwnt_allocator_allocate_structure(
 	                 libfwnt_huffman_tree_t );
 
 	if( *huffman_tree == NULL )
@@ -112,7 +113,7 @@ int libfwnt_huffman_tree_initialize(
 		 "%s: unable to clear Huffman tree.",
 		 function );
 
-		memory_free(
+		libfwnt_allocator_free(
 		 *huffman_tree );
 
 		*huffman_tree = NULL;
@@ -121,7 +122,7 @@ int libfwnt_huffman_tree_initialize(
 	}
 	array_size = sizeof( int ) * number_of_symbols;
 
-	( *huffman_tree )->symbols = (int *) memory_allocate(
+	( *huffman_tree )->symbols = (int *) libfwnt_allocator_allocate(
 	                                      array_size );
 
 	if( ( *huffman_tree )->symbols == NULL )
@@ -151,7 +152,7 @@ int libfwnt_huffman_tree_initialize(
 	}
 	array_size = sizeof( int ) * ( maximum_code_size + 1 );
 
-	( *huffman_tree )->code_size_counts = (int *) memory_allocate(
+	( *huffman_tree )->code_size_counts = (int *) libfwnt_allocator_allocate(
 	                                               array_size );
 
 	if( ( *huffman_tree )->code_size_counts == NULL )
@@ -188,15 +189,15 @@ on_error:
 	{
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
-			memory_free(
+			libfwnt_allocator_free(
 			 ( *huffman_tree )->code_size_counts );
 		}
 		if( ( *huffman_tree )->symbols != NULL )
 		{
-			memory_free(
+			libfwnt_allocator_free(
 			 ( *huffman_tree )->symbols );
 		}
-		memory_free(
+		libfwnt_allocator_free(
 		 *huffman_tree );
 
 		*huffman_tree = NULL;
@@ -228,15 +229,15 @@ int libfwnt_huffman_tree_free(
 	{
 		if( ( *huffman_tree )->code_size_counts != NULL )
 		{
-			memory_free(
+			libfwnt_allocator_free(
 			 ( *huffman_tree )->code_size_counts );
 		}
 		if( ( *huffman_tree )->symbols != NULL )
 		{
-			memory_free(
+			libfwnt_allocator_free(
 			 ( *huffman_tree )->symbols );
 		}
-		memory_free(
+		libfwnt_allocator_free(
 		 *huffman_tree );
 
 		*huffman_tree = NULL;
@@ -376,7 +377,7 @@ int libfwnt_huffman_tree_build(
 		goto on_error;
 	}
 */
-	symbol_offsets = (int *) memory_allocate(
+	symbol_offsets = (int *) libfwnt_allocator_allocate(
 	                          array_size );
 
 	if( symbol_offsets == NULL )
@@ -433,7 +434,7 @@ int libfwnt_huffman_tree_build(
 
 		huffman_tree->symbols[ code_offset ] = symbol;
 	}
-	memory_free(
+	libfwnt_allocator_free(
 	 symbol_offsets );
 
 	return( 1 );
@@ -441,7 +442,7 @@ int libfwnt_huffman_tree_build(
 on_error:
 	if( symbol_offsets != NULL )
 	{
-		memory_free(
+		libfwnt_allocator_free(
 		 symbol_offsets );
 	}
 	return( -1 );
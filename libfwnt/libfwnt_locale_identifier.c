@@ -21,11 +21,13 @@
 
 #include <common.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libfwnt_libcerror.h"
 #include "libfwnt_locale_identifier.h"
 
-libfwnt_locale_identifier_language_tag_t libfwnt_locale_identifier_language_tags[ ] = {
+const libfwnt_locale_identifier_language_tag_t libfwnt_locale_identifier_language_tags[ LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX + 1 ] = {
 	{ 0x0001, "ar",			"Arabic" },
 	{ 0x0002, "bg",			"Bulgarian" },
 	{ 0x0003, "ca",			"Catalan" },
@@ -430,23 +432,125 @@ libfwnt_locale_identifier_language_tag_t libfwnt_locale_identifier_language_tags
 
 	{ (uint16_t) -1, "_UNKNOWN_", "Unknown" } };
 
-/* Retrieves a string containing the language tag identifier
+/* The sort identifiers per LCID language tag
  */
-const char *libfwnt_locale_identifier_language_tag_get_identifier(
-             uint16_t lcid_language_tag )
+const libfwnt_locale_identifier_sort_t libfwnt_locale_identifier_sorts[ 14 ] = {
+	{ 0x0404, 3, "pronun",	"Bopomofo" },
+	{ 0x0404, 4, "radstr",	"Radical/stroke" },
+	{ 0x0407, 1, "phoneb",	"Phone book" },
+	{ 0x040e, 1, "tchncl",	"Technical" },
+	{ 0x0411, 4, "radstr",	"Radical/stroke" },
+	{ 0x0437, 1, "modern",	"Modern" },
+	{ 0x0804, 2, "stroke",	"Stroke count" },
+	{ 0x0804, 5, "phoneb",	"Phonetic" },
+	{ 0x0c04, 4, "radstr",	"Radical/stroke" },
+	{ 0x1004, 2, "stroke",	"Stroke count" },
+	{ 0x1004, 5, "phoneb",	"Phonetic" },
+	{ 0x1404, 2, "stroke",	"Stroke count" },
+	{ 0x1404, 4, "radstr",	"Radical/stroke" },
+
+	{ (uint16_t) -1, 0, NULL, NULL } };
+
+/* The language tags table index of the first sub language of every primary language
+ * The primary language is stored in the lower 10 bits of the LCID language tag
+ */
+const uint16_t libfwnt_locale_identifier_primary_language_offsets[ 147 ] = {
+	0, 0, 17, 19, 21, 53, 55, 57, 63, 65, 84, 106, 108, 124, 126, 128,
+	130, 133, 135, 137, 140, 172, 174, 177, 179, 182, 185, 217, 219, 221, 224, 226,
+	228, 231, 233, 235, 237, 239, 241, 243, 245, 277, 279, 281, 283, 314, 316, 348,
+	350, 352, 354, 356, 358, 360, 362, 364, 366, 368, 370, 372, 404, 407, 407, 410,
+	412, 414, 416, 418, 450, 452, 455, 458, 460, 462, 464, 466, 468, 470, 472, 474,
+	476, 508, 511, 513, 515, 517, 519, 521, 523, 525, 528, 530, 532, 534, 566, 568,
+	600, 600, 603, 605, 607, 609, 611, 613, 615, 647, 649, 651, 655, 657, 659, 661,
+	663, 665, 667, 669, 672, 674, 676, 676, 678, 680, 682, 684, 684, 686, 686, 688,
+	688, 690, 692, 694, 696, 698, 700, 702, 704, 706, 706, 706, 706, 708, 710, 710,
+	710, 710, 712 };
+
+/* The language tags table index of every sub language per primary language
+ * The sub language is stored in the upper 6 bits of the LCID language tag
+ * The index of the unknown entry is used for unsupported LCID language tags
+ * This table and the offsets table need to be updated if the language tags table is changed,
+ * fwnt_test_locale_identifier_language_tag_get_values compares them with the language tags table
+ */
+const uint16_t libfwnt_locale_identifier_language_tag_indexes[ 712 ] = {
+	0, 115, 247, 278, 288, 296, 304, 310, 316, 322, 328, 333, 338, 343, 347, 351,
+	355, 1, 116, 2, 117, 3, 118, 248, 279, 289, 297, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 372, 380, 4, 119, 5, 120, 6, 121, 249, 280, 290, 298, 7,
+	122, 8, 123, 250, 281, 291, 299, 305, 311, 317, 323, 329, 334, 339, 344, 348,
+	352, 356, 358, 360, 9, 124, 251, 282, 292, 300, 306, 312, 318, 324, 330, 335,
+	340, 345, 349, 353, 357, 359, 361, 362, 363, 364, 10, 125, 11, 126, 252, 283,
+	293, 301, 307, 313, 319, 325, 331, 336, 341, 346, 350, 354, 12, 127, 13, 128,
+	14, 129, 15, 130, 253, 16, 131, 17, 132, 18, 133, 254, 19, 134, 255, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 373, 381, 20, 135, 21, 136,
+	256, 22, 137, 23, 138, 257, 24, 139, 258, 25, 140, 259, 284, 294, 302, 308,
+	314, 320, 326, 332, 337, 342, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 365, 366, 367, 368, 391, 374, 382, 26, 141, 27, 142, 28, 143, 260,
+	29, 144, 30, 145, 31, 146, 261, 32, 147, 33, 148, 34, 149, 35, 150, 36,
+	151, 37, 152, 38, 153, 39, 154, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 383, 40, 155, 41, 156, 42, 157, 43, 158, 262, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 370, 375, 44, 159, 45, 160, 263, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 384, 46, 161, 391, 162,
+	391, 163, 47, 164, 391, 165, 48, 166, 49, 167, 50, 168, 51, 169, 52, 170,
+	53, 171, 54, 172, 55, 173, 264, 285, 295, 303, 309, 315, 321, 327, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	369, 371, 376, 385, 56, 391, 265, 57, 174, 266, 58, 175, 59, 176, 60, 177,
+	61, 178, 62, 179, 267, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	377, 386, 63, 180, 64, 181, 268, 65, 182, 269, 66, 183, 67, 184, 68, 185,
+	69, 186, 70, 187, 71, 188, 72, 189, 73, 190, 74, 191, 75, 192, 270, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 378, 387, 76, 193, 271, 77,
+	194, 78, 195, 79, 196, 391, 197, 80, 198, 81, 199, 391, 200, 391, 201, 272,
+	82, 202, 83, 203, 391, 204, 84, 205, 273, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 379, 388, 85, 206, 86, 207, 274, 286, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 389, 87, 208, 275, 88, 209, 89, 210, 90,
+	211, 91, 212, 391, 213, 391, 214, 92, 215, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+	391, 391, 391, 391, 391, 391, 390, 391, 216, 93, 217, 94, 218, 276, 287, 95,
+	219, 96, 220, 97, 221, 98, 222, 99, 223, 391, 224, 391, 225, 391, 226, 277,
+	391, 227, 391, 228, 391, 229, 100, 230, 391, 231, 101, 232, 102, 233, 103, 234,
+	104, 235, 105, 236, 106, 237, 107, 238, 108, 239, 109, 240, 110, 241, 111, 242,
+	112, 243, 113, 244, 391, 245, 114, 246 };
+
+/* Retrieves the language tag values of a LCID language tag
+ * The values of the unknown entry are returned if the LCID language tag is not supported
+ */
+const libfwnt_locale_identifier_language_tag_t *libfwnt_locale_identifier_language_tag_get_values(
+                                                 uint16_t lcid_language_tag )
 {
-	int iterator = 0;
+	uint16_t primary_language = lcid_language_tag & 0x03ff;
+	uint16_t sub_language     = lcid_language_tag >> 10;
+	uint16_t table_index      = LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX;
+	uint16_t table_offset     = 0;
 
-	while( ( libfwnt_locale_identifier_language_tags[ iterator ] ).lcid_language_tag != (uint16_t) -1 )
+	if( primary_language < LIBFWNT_LOCALE_IDENTIFIER_NUMBER_OF_PRIMARY_LANGUAGES )
 	{
-		if( ( libfwnt_locale_identifier_language_tags[ iterator ] ).lcid_language_tag == lcid_language_tag )
+		table_offset = libfwnt_locale_identifier_primary_language_offsets[ primary_language ];
+
+		if( sub_language < ( libfwnt_locale_identifier_primary_language_offsets[ primary_language + 1 ] - table_offset ) )
 		{
-			break;
+			table_index = libfwnt_locale_identifier_language_tag_indexes[ table_offset + sub_language ];
 		}
-		iterator++;
 	}
 	return(
-	 ( libfwnt_locale_identifier_language_tags[ iterator ] ).identifier );
+	 &( libfwnt_locale_identifier_language_tags[ table_index ] ) );
+}
+
+/* Retrieves a string containing the language tag identifier
+ */
+const char *libfwnt_locale_identifier_language_tag_get_identifier(
+             uint16_t lcid_language_tag )
+{
+	return(
+	 libfwnt_locale_identifier_language_tag_get_values(
+	  lcid_language_tag )->identifier );
 }
 
 /* Retrieves a string containing the language tag description
@@ -454,17 +558,493 @@ const char *libfwnt_locale_identifier_language_tag_get_identifier(
 const char *libfwnt_locale_identifier_language_tag_get_description(
              uint16_t lcid_language_tag )
 {
-	int iterator = 0;
+	return(
+	 libfwnt_locale_identifier_language_tag_get_values(
+	  lcid_language_tag )->description );
+}
+
+/* Retrieves the strings containing the language tag identifier and description
+ * The strings of the unknown entry are returned if the LCID language tag is not supported
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwnt_locale_identifier_language_tag_get_strings(
+     uint16_t lcid_language_tag,
+     const char **identifier,
+     const char **description,
+     libcerror_error_t **error )
+{
+	const libfwnt_locale_identifier_language_tag_t *language_tag = NULL;
+	static char *function                                        = "libfwnt_locale_identifier_language_tag_get_strings";
+
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( description == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid description.",
+		 function );
+
+		return( -1 );
+	}
+	language_tag = libfwnt_locale_identifier_language_tag_get_values(
+	                lcid_language_tag );
+
+	*identifier  = language_tag->identifier;
+	*description = language_tag->description;
+
+	if( language_tag->lcid_language_tag == (uint16_t) -1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the LCID language tag of an UTF-8 encoded language tag identifier string, such as "en-US"
+ * The identifier is compared case-insensitive
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+     uint16_t *lcid_language_tag,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	const char *identifier = NULL;
+	static char *function  = "libfwnt_locale_identifier_language_tag_copy_from_utf8_string";
+	size_t string_index    = 0;
+	uint8_t character1     = 0;
+	uint8_t character2     = 0;
+	int table_index        = 0;
 
-	while( ( libfwnt_locale_identifier_language_tags[ iterator ] ).lcid_language_tag != (uint16_t) -1 )
+	if( lcid_language_tag == NULL )
 	{
-		if( ( libfwnt_locale_identifier_language_tags[ iterator ] ).lcid_language_tag == lcid_language_tag )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LCID language tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-8 string length exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a trailing end of string character
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length--;
+	}
+	if( utf8_string_length == 0 )
+	{
+		return( 0 );
+	}
+	for( table_index = 0;
+	     table_index < LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX;
+	     table_index++ )
+	{
+		identifier = libfwnt_locale_identifier_language_tags[ table_index ].identifier;
+
+		for( string_index = 0;
+		     string_index < utf8_string_length;
+		     string_index++ )
+		{
+			character1 = (uint8_t) identifier[ string_index ];
+			character2 = utf8_string[ string_index ];
+
+			if( character1 == 0 )
+			{
+				break;
+			}
+
+			if( ( character1 >= (uint8_t) 'A' )
+			 && ( character1 <= (uint8_t) 'Z' ) )
+			{
+				character1 += (uint8_t) 'a' - (uint8_t) 'A';
+			}
+			if( ( character2 >= (uint8_t) 'A' )
+			 && ( character2 <= (uint8_t) 'Z' ) )
+			{
+				character2 += (uint8_t) 'a' - (uint8_t) 'A';
+			}
+			if( character1 != character2 )
+			{
+				break;
+			}
+		}
+		if( ( string_index == utf8_string_length )
+		 && ( identifier[ string_index ] == 0 ) )
 		{
-			break;
+			*lcid_language_tag = libfwnt_locale_identifier_language_tags[ table_index ].lcid_language_tag;
+
+			return( 1 );
 		}
-		iterator++;
 	}
-	return(
-	 ( libfwnt_locale_identifier_language_tags[ iterator ] ).description );
+	return( 0 );
+}
+
+/* Retrieves the values of a LCID
+ * The LCID consists of the language tag (LANGID) in bits 0 - 15, the sort identifier
+ * in bits 16 - 19, the sort version in bits 20 - 23 and reserved bits 24 - 31
+ * The neutral language is the entry of the primary language without a sub language
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwnt_locale_identifier_get_values(
+     uint32_t lcid,
+     libfwnt_locale_identifier_values_t *values,
+     libcerror_error_t **error )
+{
+	const libfwnt_locale_identifier_language_tag_t *language_tag = NULL;
+	static char *function                                        = "libfwnt_locale_identifier_get_values";
+	int result                                                   = 1;
+	int sort_index                                               = 0;
+
+	if( values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
+	}
+	values->lcid             = lcid;
+	values->language_tag     = (uint16_t) ( lcid & 0x0000ffffUL );
+	values->primary_language = (uint16_t) ( lcid & 0x000003ffUL );
+	values->sub_language     = (uint8_t) ( ( lcid >> 10 ) & 0x0000003fUL );
+	values->sort_identifier  = (uint8_t) ( ( lcid >> 16 ) & 0x0000000fUL );
+	values->sort_version     = (uint8_t) ( ( lcid >> 20 ) & 0x0000000fUL );
+	values->sort_suffix      = NULL;
+	values->sort_description = NULL;
+
+	language_tag = libfwnt_locale_identifier_language_tag_get_values(
+	                values->language_tag );
+
+	values->identifier  = language_tag->identifier;
+	values->description = language_tag->description;
+
+	if( ( language_tag->lcid_language_tag == (uint16_t) -1 )
+	 || ( ( lcid & 0xff000000UL ) != 0 ) )
+	{
+		result = 0;
+	}
+	language_tag = libfwnt_locale_identifier_language_tag_get_values(
+	                values->primary_language );
+
+	if( language_tag->lcid_language_tag == (uint16_t) -1 )
+	{
+		values->neutral_language_tag = 0;
+		values->neutral_identifier   = NULL;
+	}
+	else
+	{
+		values->neutral_language_tag = language_tag->lcid_language_tag;
+		values->neutral_identifier   = language_tag->identifier;
+	}
+	if( values->sort_identifier != 0 )
+	{
+		while( libfwnt_locale_identifier_sorts[ sort_index ].lcid_language_tag != (uint16_t) -1 )
+		{
+			if( ( libfwnt_locale_identifier_sorts[ sort_index ].lcid_language_tag == values->language_tag )
+			 && ( libfwnt_locale_identifier_sorts[ sort_index ].sort_identifier == values->sort_identifier ) )
+			{
+				values->sort_suffix      = libfwnt_locale_identifier_sorts[ sort_index ].suffix;
+				values->sort_description = libfwnt_locale_identifier_sorts[ sort_index ].description;
+
+				break;
+			}
+			sort_index++;
+		}
+		if( values->sort_suffix == NULL )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the values of multiple LCIDs
+ * values_array must contain values for every LCID, the values of unsupported LCIDs
+ * contain the strings of the unknown language tag
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_locale_identifier_get_values_array(
+     const uint32_t *lcids,
+     libfwnt_locale_identifier_values_t *values_array,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_locale_identifier_get_values_array";
+	int values_index      = 0;
+
+	if( lcids == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LCIDs.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of values value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( values_index = 0;
+	     values_index < number_of_values;
+	     values_index++ )
+	{
+		if( libfwnt_locale_identifier_get_values(
+		     lcids[ values_index ],
+		     &( values_array[ values_index ] ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve values of LCID: %d.",
+			 function,
+			 values_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded locale name of a LCID
+ * The locale name consists of the language tag identifier followed by an underscore
+ * and the sort suffix if the LCID contains a sort identifier, such as "de-DE_phoneb"
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwnt_locale_identifier_get_utf8_name_size(
+     uint32_t lcid,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwnt_locale_identifier_values_t values;
+
+	static char *function = "libfwnt_locale_identifier_get_utf8_name_size";
+	int result            = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwnt_locale_identifier_get_values(
+	          lcid,
+	          &values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	*utf8_string_size = narrow_string_length(
+	                     values.identifier ) + 1;
+
+	if( values.sort_suffix != NULL )
+	{
+		*utf8_string_size += narrow_string_length(
+		                      values.sort_suffix ) + 1;
+	}
+	return( 1 );
+}
+
+/* Copies the UTF-8 encoded locale name of a LCID to a string
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int libfwnt_locale_identifier_copy_to_utf8_name(
+     uint32_t lcid,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwnt_locale_identifier_values_t values;
+
+	static char *function     = "libfwnt_locale_identifier_copy_to_utf8_name";
+	size_t identifier_length  = 0;
+	size_t sort_suffix_length = 0;
+	size_t string_size        = 0;
+	int result                = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwnt_locale_identifier_get_values(
+	          lcid,
+	          &values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	identifier_length = narrow_string_length(
+	                     values.identifier );
+
+	string_size = identifier_length + 1;
+
+	if( values.sort_suffix != NULL )
+	{
+		sort_suffix_length = narrow_string_length(
+		                      values.sort_suffix );
+
+		string_size += sort_suffix_length + 1;
+	}
+	if( utf8_string_size < string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     values.identifier,
+	     identifier_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( values.sort_suffix != NULL )
+	{
+		utf8_string[ identifier_length++ ] = (uint8_t) '_';
+
+		if( memory_copy(
+		     &( utf8_string[ identifier_length ] ),
+		     values.sort_suffix,
+		     sort_suffix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sort suffix.",
+			 function );
+
+			return( -1 );
+		}
+		identifier_length += sort_suffix_length;
+	}
+	utf8_string[ identifier_length ] = 0;
+
+	return( 1 );
 }
 
@@ -25,33 +25,95 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
-typedef struct libfwnt_locale_identifier_language_tag libfwnt_locale_identifier_language_tag_t;
+/* The index of the unknown entry in the language tags table
+ */
+#define LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX		391
+
+/* The number of primary languages in the language tags table
+ */
+#define LIBFWNT_LOCALE_IDENTIFIER_NUMBER_OF_PRIMARY_LANGUAGES		146
+
+typedef struct libfwnt_locale_identifier_sort libfwnt_locale_identifier_sort_t;
 
-struct libfwnt_locale_identifier_language_tag
+struct libfwnt_locale_identifier_sort
 {
 	/* The LCID language tag value
 	 */
 	uint16_t lcid_language_tag;
 
-	/* The identifier
+	/* The sort identifier
+	 */
+	uint8_t sort_identifier;
+
+	/* The suffix
 	 */
-	const char *identifier;
+	const char *suffix;
 
 	/* The description
 	 */
 	const char *description;
 };
 
+extern const libfwnt_locale_identifier_language_tag_t libfwnt_locale_identifier_language_tags[ LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX + 1 ];
+
+LIBFWNT_EXTERN \
+const libfwnt_locale_identifier_language_tag_t *libfwnt_locale_identifier_language_tag_get_values(
+                                                 uint16_t lcid_language_tag );
+
 const char *libfwnt_locale_identifier_language_tag_get_identifier(
              uint16_t lcid_language_tag );
 
 const char *libfwnt_locale_identifier_language_tag_get_description(
              uint16_t lcid_language_tag );
 
+LIBFWNT_EXTERN \
+int libfwnt_locale_identifier_language_tag_get_strings(
+     uint16_t lcid_language_tag,
+     const char **identifier,
+     const char **description,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+     uint16_t *lcid_language_tag,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_locale_identifier_get_values(
+     uint32_t lcid,
+     libfwnt_locale_identifier_values_t *values,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_locale_identifier_get_values_array(
+     const uint32_t *lcids,
+     libfwnt_locale_identifier_values_t *values_array,
+     int number_of_values,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_locale_identifier_get_utf8_name_size(
+     uint32_t lcid,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_locale_identifier_copy_to_utf8_name(
+     uint32_t lcid,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
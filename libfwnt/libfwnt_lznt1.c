@@ -279,9 +279,9 @@ int libfwnt_lznt1_decompress_chunk(
 					{
 						libcerror_error_set(
 						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid uncompressed data offset value out of bounds.",
+						 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+						 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+						 "%s: uncompressed data too small.",
 						 function );
 
 						return( -1 );
@@ -297,9 +297,9 @@ int libfwnt_lznt1_decompress_chunk(
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid uncompressed data offset value out of bounds.",
+					 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+					 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+					 "%s: uncompressed data too small.",
 					 function );
 
 					return( -1 );
@@ -528,8 +528,8 @@ int libfwnt_lznt1_decompress(
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
 				 "%s: uncompressed data too small.",
 				 function );
 
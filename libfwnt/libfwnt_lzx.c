@@ -625,9 +625,9 @@ int libfwnt_lzx_decode_huffman(
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: uncompressed data too small.",
 				 function );
 
 				return( -1 );
@@ -764,9 +764,9 @@ int libfwnt_lzx_decode_huffman(
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: invalid uncompressed data value too small.",
+				 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+				 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+				 "%s: uncompressed data too small.",
 				 function );
 
 				return( -1 );
@@ -1362,9 +1362,9 @@ int libfwnt_lzx_decompress(
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-					 "%s: invalid uncompressed data value too small.",
+					 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+					 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
+					 "%s: uncompressed data too small.",
 					 function );
 
 					goto on_error;
@@ -393,8 +393,8 @@ int libfwnt_lzxpress_decompress(
 					{
 						libcerror_error_set(
 						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+						 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
 						 "%s: uncompressed data too small.",
 						 function );
 
@@ -422,8 +422,8 @@ int libfwnt_lzxpress_decompress(
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 LIBCERROR_ERROR_DOMAIN_OUTPUT,
+					 LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE,
 					 "%s: uncompressed data too small.",
 					 function );
 
@@ -0,0 +1,2056 @@
+/*
+ * Security descriptor definition language (SDDL) functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libfwnt_access_control_entry.h"
+#include "libfwnt_access_control_list.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_sddl.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_well_known_security_identifier.h"
+
+/* The access control entry type aliases
+ */
+const libfwnt_sddl_alias_t libfwnt_sddl_access_control_type_aliases[ 14 ] = {
+	{ LIBFWNT_ACCESS_ALLOWED, "A" },
+	{ LIBFWNT_ACCESS_DENIED, "D" },
+	{ LIBFWNT_SYSTEM_AUDIT, "AU" },
+	{ LIBFWNT_SYSTEM_ALARM, "AL" },
+	{ LIBFWNT_ACCESS_ALLOWED_OBJECT, "OA" },
+	{ LIBFWNT_ACCESS_DENIED_OBJECT, "OD" },
+	{ LIBFWNT_SYSTEM_AUDIT_OBJECT, "OU" },
+	{ LIBFWNT_SYSTEM_ALARM_OBJECT, "OL" },
+	{ LIBFWNT_ACCESS_ALLOWED_CALLBACK, "XA" },
+	{ LIBFWNT_ACCESS_DENIED_CALLBACK, "XD" },
+	{ LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT, "ZA" },
+	{ LIBFWNT_SYSTEM_AUDIT_CALLBACK, "XU" },
+	{ LIBFWNT_SYSTEM_MANDATORY_LABEL, "ML" },
+	{ 0, NULL } };
+
+/* The access control entry flag aliases, in the order they are written
+ */
+const libfwnt_sddl_alias_t libfwnt_sddl_access_control_entry_flag_aliases[ 8 ] = {
+	{ LIBFWNT_ACE_FLAG_OBJECT_INHERIT, "OI" },
+	{ LIBFWNT_ACE_FLAG_CONTAINER_INHERIT, "CI" },
+	{ LIBFWNT_ACE_FLAG_NO_PROPAGATE_INHERIT, "NP" },
+	{ LIBFWNT_ACE_FLAG_INHERIT_ONLY, "IO" },
+	{ LIBFWNT_ACE_FLAG_INHERITED, "ID" },
+	{ LIBFWNT_ACE_FLAG_SUCCESSFUL_ACCESS, "SA" },
+	{ LIBFWNT_ACE_FLAG_FAILED_ACCESS, "FA" },
+	{ 0, NULL } };
+
+/* The access mask aliases that represent a combination of rights
+ * These are only used if they match the access mask exactly
+ */
+const libfwnt_sddl_alias_t libfwnt_sddl_access_mask_combined_aliases[ 8 ] = {
+	{ 0x001f01ffUL, "FA" },
+	{ 0x00120089UL, "FR" },
+	{ 0x00120116UL, "FW" },
+	{ 0x001200a0UL, "FX" },
+	{ 0x000f003fUL, "KA" },
+	{ 0x00020019UL, "KR" },
+	{ 0x00020006UL, "KW" },
+	{ 0, NULL } };
+
+/* The access mask aliases of individual rights, in the order they are written
+ */
+const libfwnt_sddl_alias_t libfwnt_sddl_access_mask_aliases[ 18 ] = {
+	{ 0x10000000UL, "GA" },
+	{ 0x80000000UL, "GR" },
+	{ 0x40000000UL, "GW" },
+	{ 0x20000000UL, "GX" },
+	{ 0x00000001UL, "CC" },
+	{ 0x00000002UL, "DC" },
+	{ 0x00000004UL, "LC" },
+	{ 0x00000008UL, "SW" },
+	{ 0x00000010UL, "RP" },
+	{ 0x00000020UL, "WP" },
+	{ 0x00000040UL, "DT" },
+	{ 0x00000080UL, "LO" },
+	{ 0x00000100UL, "CR" },
+	{ LIBFWNT_ACCESS_MASK_DELETE, "SD" },
+	{ LIBFWNT_ACCESS_MASK_READ_CONTROL, "RC" },
+	{ LIBFWNT_ACCESS_MASK_WRITE_DAC, "WD" },
+	{ LIBFWNT_ACCESS_MASK_WRITE_OWNER, "WO" },
+	{ 0, NULL } };
+
+/* The mandatory label access mask aliases, in the order they are written
+ */
+const libfwnt_sddl_alias_t libfwnt_sddl_mandatory_label_access_mask_aliases[ 4 ] = {
+	{ 0x00000001UL, "NW" },
+	{ 0x00000002UL, "NR" },
+	{ 0x00000004UL, "NX" },
+	{ 0, NULL } };
+
+/* Appends characters to a string
+ * If the string is NULL only the string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_characters(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     const char *characters,
+     size_t number_of_characters,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_sddl_write_characters";
+
+	if( string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( characters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid characters.",
+		 function );
+
+		return( -1 );
+	}
+	if( string != NULL )
+	{
+		if( ( *string_index >= string_size )
+		 || ( number_of_characters > ( string_size - *string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( string[ *string_index ] ),
+		     characters,
+		     number_of_characters ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy characters.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*string_index += number_of_characters;
+
+	return( 1 );
+}
+
+/* Appends a security identifier (SID) to a string
+ * The SDDL alias is used for well-known security identifiers that are not relative to a domain or computer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_security_identifier(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t identifier_string[ LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_STRING_LENGTH + 1 ];
+
+	static char *function    = "libfwnt_sddl_write_security_identifier";
+	size_t identifier_length = 0;
+	int well_known_type      = 0;
+
+	if( internal_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	well_known_type = libfwnt_well_known_security_identifier_get_type(
+	                   internal_security_identifier );
+
+	if( ( well_known_type != LIBFWNT_WELL_KNOWN_SID_UNKNOWN )
+	 && ( libfwnt_well_known_security_identifiers[ well_known_type ].sddl_alias != NULL )
+	 && ( libfwnt_well_known_security_identifiers[ well_known_type ].string != NULL ) )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     libfwnt_well_known_security_identifiers[ well_known_type ].sddl_alias,
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to write security identifier alias.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( string == NULL )
+	{
+		identifier_length = libfwnt_internal_security_identifier_get_string_length(
+		                     internal_security_identifier );
+
+		*string_index += identifier_length;
+
+		return( 1 );
+	}
+	identifier_length = libfwnt_internal_security_identifier_write_string(
+	                     internal_security_identifier,
+	                     identifier_string );
+
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     (char *) identifier_string,
+	     identifier_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to write security identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an access mask to a string
+ * The access mask is written as aliases if all its rights have an alias and as a hexadecimal value otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_access_mask(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     uint8_t access_control_type,
+     uint32_t access_mask,
+     libcerror_error_t **error )
+{
+	char hexadecimal_string[ 10 ];
+
+	const libfwnt_sddl_alias_t *aliases = NULL;
+	static char *function               = "libfwnt_sddl_write_access_mask";
+	size_t hexadecimal_string_index     = 0;
+	uint32_t remaining_access_mask      = 0;
+	uint8_t nibble                      = 0;
+	int alias_index                     = 0;
+	int bit_shift                       = 0;
+
+	if( access_control_type == LIBFWNT_SYSTEM_MANDATORY_LABEL )
+	{
+		aliases = libfwnt_sddl_mandatory_label_access_mask_aliases;
+	}
+	else
+	{
+		for( alias_index = 0;
+		     libfwnt_sddl_access_mask_combined_aliases[ alias_index ].alias != NULL;
+		     alias_index++ )
+		{
+			if( libfwnt_sddl_access_mask_combined_aliases[ alias_index ].value == access_mask )
+			{
+				return( libfwnt_sddl_write_characters(
+				         string,
+				         string_size,
+				         string_index,
+				         libfwnt_sddl_access_mask_combined_aliases[ alias_index ].alias,
+				         2,
+				         error ) );
+			}
+		}
+		aliases = libfwnt_sddl_access_mask_aliases;
+	}
+	remaining_access_mask = access_mask;
+
+	for( alias_index = 0;
+	     aliases[ alias_index ].alias != NULL;
+	     alias_index++ )
+	{
+		remaining_access_mask &= ~( aliases[ alias_index ].value );
+	}
+	if( ( access_mask != 0 )
+	 && ( remaining_access_mask == 0 ) )
+	{
+		for( alias_index = 0;
+		     aliases[ alias_index ].alias != NULL;
+		     alias_index++ )
+		{
+			if( ( access_mask & aliases[ alias_index ].value ) == 0 )
+			{
+				continue;
+			}
+			if( libfwnt_sddl_write_characters(
+			     string,
+			     string_size,
+			     string_index,
+			     aliases[ alias_index ].alias,
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to write access mask alias.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	hexadecimal_string[ hexadecimal_string_index++ ] = '0';
+	hexadecimal_string[ hexadecimal_string_index++ ] = 'x';
+
+	for( bit_shift = 28;
+	     bit_shift > 0;
+	     bit_shift -= 4 )
+	{
+		if( ( access_mask >> bit_shift ) != 0 )
+		{
+			break;
+		}
+	}
+	while( bit_shift >= 0 )
+	{
+		nibble = (uint8_t) ( ( access_mask >> bit_shift ) & 0x0f );
+
+		if( nibble < 10 )
+		{
+			hexadecimal_string[ hexadecimal_string_index++ ] = (char) ( '0' + nibble );
+		}
+		else
+		{
+			hexadecimal_string[ hexadecimal_string_index++ ] = (char) ( 'a' + nibble - 10 );
+		}
+		bit_shift -= 4;
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     hexadecimal_string,
+	     hexadecimal_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to write access mask value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a GUID to a string
+ * The GUID is written in lower case as: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_guid(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *guid_data,
+     libcerror_error_t **error )
+{
+	char guid_string[ 36 ];
+
+	/* The byte order of the GUID string, the first 3 values are stored in little-endian
+	 */
+	const uint8_t guid_byte_order[ 16 ] = {
+		3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+	static char *function    = "libfwnt_sddl_write_guid";
+	size_t guid_string_index = 0;
+	uint8_t byte_value       = 0;
+	uint8_t nibble           = 0;
+	int byte_index           = 0;
+	int nibble_index         = 0;
+
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		if( ( byte_index == 4 )
+		 || ( byte_index == 6 )
+		 || ( byte_index == 8 )
+		 || ( byte_index == 10 ) )
+		{
+			guid_string[ guid_string_index++ ] = '-';
+		}
+		byte_value = guid_data[ guid_byte_order[ byte_index ] ];
+
+		for( nibble_index = 0;
+		     nibble_index < 2;
+		     nibble_index++ )
+		{
+			if( nibble_index == 0 )
+			{
+				nibble = byte_value >> 4;
+			}
+			else
+			{
+				nibble = byte_value & 0x0f;
+			}
+			if( nibble < 10 )
+			{
+				guid_string[ guid_string_index++ ] = (char) ( '0' + nibble );
+			}
+			else
+			{
+				guid_string[ guid_string_index++ ] = (char) ( 'a' + nibble - 10 );
+			}
+		}
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     guid_string,
+	     36,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to write GUID string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an access control entry (ACE) to a string
+ * The entry is written as: (type;flags;rights;object_guid;inherit_object_guid;account_sid)
+ * The conditional expression of callback entries is not written
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_access_control_entry(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     libcerror_error_t **error )
+{
+	const char *type_alias = NULL;
+	static char *function  = "libfwnt_sddl_write_access_control_entry";
+	int alias_index        = 0;
+
+	if( internal_access_control_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_access_control_entry->security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid access control entry - missing security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	for( alias_index = 0;
+	     libfwnt_sddl_access_control_type_aliases[ alias_index ].alias != NULL;
+	     alias_index++ )
+	{
+		if( libfwnt_sddl_access_control_type_aliases[ alias_index ].value == (uint32_t) internal_access_control_entry->type )
+		{
+			type_alias = libfwnt_sddl_access_control_type_aliases[ alias_index ].alias;
+
+			break;
+		}
+	}
+	if( type_alias == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access control entry type: 0x%02" PRIx8 ".",
+		 function,
+		 internal_access_control_entry->type );
+
+		return( -1 );
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     "(",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     type_alias,
+	     narrow_string_length(
+	      type_alias ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     ";",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( alias_index = 0;
+	     libfwnt_sddl_access_control_entry_flag_aliases[ alias_index ].alias != NULL;
+	     alias_index++ )
+	{
+		if( ( internal_access_control_entry->flags & libfwnt_sddl_access_control_entry_flag_aliases[ alias_index ].value ) == 0 )
+		{
+			continue;
+		}
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     libfwnt_sddl_access_control_entry_flag_aliases[ alias_index ].alias,
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     ";",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_sddl_write_access_mask(
+	     string,
+	     string_size,
+	     string_index,
+	     internal_access_control_entry->type,
+	     internal_access_control_entry->access_mask,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     ";",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_OBJECT_TYPE_PRESENT ) != 0 )
+	{
+		if( libfwnt_sddl_write_guid(
+		     string,
+		     string_size,
+		     string_index,
+		     internal_access_control_entry->object_type,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     ";",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( internal_access_control_entry->object_flags & LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) != 0 )
+	{
+		if( libfwnt_sddl_write_guid(
+		     string,
+		     string_size,
+		     string_index,
+		     internal_access_control_entry->inherited_object_type,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     ";",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_sddl_write_security_identifier(
+	     string,
+	     string_size,
+	     string_index,
+	     (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libfwnt_sddl_write_characters(
+	     string,
+	     string_size,
+	     string_index,
+	     ")",
+	     1,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+	 "%s: unable to write access control entry.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends the flags and entries of an access control list (ACL) to a string
+ * A NULL access control list is written as NO_ACCESS_CONTROL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_access_control_list(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     uint16_t control_flags,
+     uint8_t is_system_acl,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfwnt_sddl_write_access_control_list";
+	uint16_t auto_inherit_req_flag = LIBFWNT_CONTROL_FLAG_DACL_AUTO_INHERIT_REQ;
+	uint16_t auto_inherited_flag   = LIBFWNT_CONTROL_FLAG_DACL_AUTO_INHERITED;
+	uint16_t protected_flag        = LIBFWNT_CONTROL_FLAG_DACL_PROTECTED;
+	int entry_index                = 0;
+
+	if( is_system_acl != 0 )
+	{
+		auto_inherit_req_flag = LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERIT_REQ;
+		auto_inherited_flag   = LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERITED;
+		protected_flag        = LIBFWNT_CONTROL_FLAG_SACL_PROTECTED;
+	}
+	if( ( control_flags & protected_flag ) != 0 )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "P",
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( control_flags & auto_inherit_req_flag ) != 0 )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "AR",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( control_flags & auto_inherited_flag ) != 0 )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "AI",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( internal_access_control_list == NULL )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "NO_ACCESS_CONTROL",
+		     17,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		return( 1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_access_control_list->number_of_entries;
+	     entry_index++ )
+	{
+		if( libfwnt_sddl_write_access_control_entry(
+		     string,
+		     string_size,
+		     string_index,
+		     internal_access_control_list->entries[ entry_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to write access control entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+	 "%s: unable to write access control list flags.",
+	 function );
+
+	return( -1 );
+}
+
+/* Appends a security descriptor to a string
+ * The security descriptor is written as: O:owner_sid G:group_sid D:dacl_flags(ace)... S:sacl_flags(ace)...
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_write_security_descriptor(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_sddl_write_security_descriptor";
+
+	if( internal_security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "O:",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwnt_sddl_write_security_identifier(
+		     string,
+		     string_size,
+		     string_index,
+		     (libfwnt_internal_security_identifier_t *) internal_security_descriptor->owner_sid,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "G:",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwnt_sddl_write_security_identifier(
+		     string,
+		     string_size,
+		     string_index,
+		     (libfwnt_internal_security_identifier_t *) internal_security_descriptor->group_sid,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	/* A NULL ACL is present according to the control flags but has no data
+	 */
+	if( ( internal_security_descriptor->discretionary_acl != NULL )
+	 || ( ( internal_security_descriptor->control_flags & LIBFWNT_CONTROL_FLAG_DACL_PRESENT ) != 0 ) )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "D:",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwnt_sddl_write_access_control_list(
+		     string,
+		     string_size,
+		     string_index,
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl,
+		     internal_security_descriptor->control_flags,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( internal_security_descriptor->system_acl != NULL )
+	 || ( ( internal_security_descriptor->control_flags & LIBFWNT_CONTROL_FLAG_SACL_PRESENT ) != 0 ) )
+	{
+		if( libfwnt_sddl_write_characters(
+		     string,
+		     string_size,
+		     string_index,
+		     "S:",
+		     2,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwnt_sddl_write_access_control_list(
+		     string,
+		     string_size,
+		     string_index,
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->system_acl,
+		     internal_security_descriptor->control_flags,
+		     1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+	 "%s: unable to write security descriptor.",
+	 function );
+
+	return( -1 );
+}
+
+/* Retrieves the value of an alias
+ * Returns 1 if successful, 0 if no such alias or -1 on error
+ */
+int libfwnt_sddl_get_alias_value(
+     const libfwnt_sddl_alias_t *aliases,
+     const uint8_t *string,
+     size_t string_length,
+     uint32_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_sddl_get_alias_value";
+	size_t alias_length   = 0;
+	int alias_index       = 0;
+
+	if( aliases == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid aliases.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	for( alias_index = 0;
+	     aliases[ alias_index ].alias != NULL;
+	     alias_index++ )
+	{
+		alias_length = narrow_string_length(
+		                aliases[ alias_index ].alias );
+
+		if( ( alias_length == string_length )
+		 && ( narrow_string_compare(
+		       aliases[ alias_index ].alias,
+		       (char *) string,
+		       string_length ) == 0 ) )
+		{
+			*value = aliases[ alias_index ].value;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads an access mask from a string
+ * The access mask is either a numeric value, such as 0x1f01ff, or a sequence of aliases
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_read_access_mask(
+     const uint8_t *string,
+     size_t string_length,
+     uint8_t access_control_type,
+     uint32_t *access_mask,
+     libcerror_error_t **error )
+{
+	const libfwnt_sddl_alias_t *aliases = NULL;
+	static char *function               = "libfwnt_sddl_read_access_mask";
+	size_t string_index                 = 0;
+	uint64_t value_64bit                = 0;
+	uint32_t alias_value                = 0;
+	uint8_t base                        = 10;
+	uint8_t character_value             = 0;
+	int result                          = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing access mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string[ 0 ] >= (uint8_t) '0' )
+	 && ( string[ 0 ] <= (uint8_t) '9' ) )
+	{
+		if( ( string_length > 2 )
+		 && ( string[ 0 ] == (uint8_t) '0' )
+		 && ( ( string[ 1 ] == (uint8_t) 'x' )
+		  ||  ( string[ 1 ] == (uint8_t) 'X' ) ) )
+		{
+			base         = 16;
+			string_index = 2;
+		}
+		while( string_index < string_length )
+		{
+			if( ( string[ string_index ] >= (uint8_t) '0' )
+			 && ( string[ string_index ] <= (uint8_t) '9' ) )
+			{
+				character_value = (uint8_t) ( string[ string_index ] - (uint8_t) '0' );
+			}
+			else if( ( base == 16 )
+			      && ( string[ string_index ] >= (uint8_t) 'a' )
+			      && ( string[ string_index ] <= (uint8_t) 'f' ) )
+			{
+				character_value = (uint8_t) ( string[ string_index ] - (uint8_t) 'a' + 10 );
+			}
+			else if( ( base == 16 )
+			      && ( string[ string_index ] >= (uint8_t) 'A' )
+			      && ( string[ string_index ] <= (uint8_t) 'F' ) )
+			{
+				character_value = (uint8_t) ( string[ string_index ] - (uint8_t) 'A' + 10 );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character in access mask at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			value_64bit *= base;
+			value_64bit += character_value;
+
+			if( value_64bit > (uint64_t) UINT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: access mask value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			string_index++;
+		}
+		*access_mask = (uint32_t) value_64bit;
+
+		return( 1 );
+	}
+	if( ( string_length % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access mask aliases.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_type == LIBFWNT_SYSTEM_MANDATORY_LABEL )
+	{
+		aliases = libfwnt_sddl_mandatory_label_access_mask_aliases;
+	}
+	else
+	{
+		aliases = libfwnt_sddl_access_mask_aliases;
+	}
+	*access_mask = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index += 2 )
+	{
+		result = libfwnt_sddl_get_alias_value(
+		          aliases,
+		          &( string[ string_index ] ),
+		          2,
+		          &alias_value,
+		          error );
+
+		if( ( result == 0 )
+		 && ( aliases != libfwnt_sddl_mandatory_label_access_mask_aliases ) )
+		{
+			result = libfwnt_sddl_get_alias_value(
+			          libfwnt_sddl_access_mask_combined_aliases,
+			          &( string[ string_index ] ),
+			          2,
+			          &alias_value,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access mask alias value.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access mask alias: %c%c.",
+			 function,
+			 (char) string[ string_index ],
+			 (char) string[ string_index + 1 ] );
+
+			return( -1 );
+		}
+		*access_mask |= alias_value;
+	}
+	return( 1 );
+}
+
+/* Reads a GUID from a string
+ * The GUID is formatted as: xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_read_guid(
+     const uint8_t *string,
+     size_t string_length,
+     uint8_t *guid_data,
+     libcerror_error_t **error )
+{
+	/* The byte order of the GUID string, the first 3 values are stored in little-endian
+	 */
+	const uint8_t guid_byte_order[ 16 ] = {
+		3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+	static char *function   = "libfwnt_sddl_read_guid";
+	size_t string_index     = 0;
+	uint8_t byte_value      = 0;
+	uint8_t character_value = 0;
+	int byte_index          = 0;
+	int nibble_index        = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length != 36 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported GUID string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index++ )
+	{
+		if( ( byte_index == 4 )
+		 || ( byte_index == 6 )
+		 || ( byte_index == 8 )
+		 || ( byte_index == 10 ) )
+		{
+			if( string[ string_index ] != (uint8_t) '-' )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: missing GUID separator at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			string_index++;
+		}
+		byte_value = 0;
+
+		for( nibble_index = 0;
+		     nibble_index < 2;
+		     nibble_index++ )
+		{
+			if( ( string[ string_index ] >= (uint8_t) '0' )
+			 && ( string[ string_index ] <= (uint8_t) '9' ) )
+			{
+				character_value = (uint8_t) ( string[ string_index ] - (uint8_t) '0' );
+			}
+			else if( ( string[ string_index ] >= (uint8_t) 'a' )
+			      && ( string[ string_index ] <= (uint8_t) 'f' ) )
+			{
+				character_value = (uint8_t) ( string[ string_index ] - (uint8_t) 'a' + 10 );
+			}
+			else if( ( string[ string_index ] >= (uint8_t) 'A' )
+			      && ( string[ string_index ] <= (uint8_t) 'F' ) )
+			{
+				character_value = (uint8_t) ( string[ string_index ] - (uint8_t) 'A' + 10 );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character in GUID at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				return( -1 );
+			}
+			byte_value = (uint8_t) ( ( byte_value << 4 ) | character_value );
+
+			string_index++;
+		}
+		guid_data[ guid_byte_order[ byte_index ] ] = byte_value;
+	}
+	return( 1 );
+}
+
+/* Reads an access control entry (ACE) from a string and appends it to an access control list (ACL)
+ * The string contains the fields of the entry without the enclosing parenthesis
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_read_access_control_entry(
+     const uint8_t *string,
+     size_t string_length,
+     libfwnt_access_control_list_t *access_control_list,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	uint8_t guid_data[ 16 ];
+
+	size_t field_lengths[ 6 ];
+	size_t field_offsets[ 6 ];
+
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	static char *function                                = "libfwnt_sddl_read_access_control_entry";
+	size_t string_index                                  = 0;
+	uint32_t access_mask                                 = 0;
+	uint32_t alias_value                                 = 0;
+	uint8_t flags                                        = 0;
+	uint8_t type                                         = 0;
+	int entry_index                                      = 0;
+	int field_index                                      = 0;
+	int result                                           = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry is formatted as: type;flags;rights;object_guid;inherit_object_guid;account_sid
+	 */
+	field_offsets[ 0 ] = 0;
+
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( string[ string_index ] != (uint8_t) ';' )
+		{
+			continue;
+		}
+		if( field_index >= 5 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported number of access control entry fields.",
+			 function );
+
+			return( -1 );
+		}
+		field_lengths[ field_index ] = string_index - field_offsets[ field_index ];
+
+		field_index++;
+
+		field_offsets[ field_index ] = string_index + 1;
+	}
+	if( field_index != 5 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of access control entry fields.",
+		 function );
+
+		return( -1 );
+	}
+	field_lengths[ 5 ] = string_length - field_offsets[ 5 ];
+
+	result = libfwnt_sddl_get_alias_value(
+	          libfwnt_sddl_access_control_type_aliases,
+	          &( string[ field_offsets[ 0 ] ] ),
+	          field_lengths[ 0 ],
+	          &alias_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve type alias value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access control entry type.",
+		 function );
+
+		return( -1 );
+	}
+	type = (uint8_t) alias_value;
+
+	if( ( field_lengths[ 1 ] % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access control entry flags.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < field_lengths[ 1 ];
+	     string_index += 2 )
+	{
+		result = libfwnt_sddl_get_alias_value(
+		          libfwnt_sddl_access_control_entry_flag_aliases,
+		          &( string[ field_offsets[ 1 ] + string_index ] ),
+		          2,
+		          &alias_value,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access control entry flag.",
+			 function );
+
+			return( -1 );
+		}
+		flags |= (uint8_t) alias_value;
+	}
+	if( libfwnt_sddl_read_access_mask(
+	     &( string[ field_offsets[ 2 ] ] ),
+	     field_lengths[ 2 ],
+	     type,
+	     &access_mask,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read access mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_from_utf8_string(
+	     security_identifier,
+	     &( string[ field_offsets[ 5 ] ] ),
+	     field_lengths[ 5 ],
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_list_append_entry(
+	     access_control_list,
+	     &access_control_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append access control entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_access_control_entry_set_values(
+	     access_control_entry,
+	     type,
+	     flags,
+	     access_mask,
+	     security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set access control entry values.",
+		 function );
+
+		goto on_error;
+	}
+	if( field_lengths[ 3 ] > 0 )
+	{
+		if( libfwnt_sddl_read_guid(
+		     &( string[ field_offsets[ 3 ] ] ),
+		     field_lengths[ 3 ],
+		     guid_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read object type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwnt_access_control_entry_set_object_type(
+		     access_control_entry,
+		     guid_data,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set object type.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( field_lengths[ 4 ] > 0 )
+	{
+		if( libfwnt_sddl_read_guid(
+		     &( string[ field_offsets[ 4 ] ] ),
+		     field_lengths[ 4 ],
+		     guid_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read inherited object type.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwnt_access_control_entry_set_inherited_object_type(
+		     access_control_entry,
+		     guid_data,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set inherited object type.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	/* Remove the partially set entry
+	 */
+	if( libfwnt_access_control_list_get_number_of_entries(
+	     access_control_list,
+	     &entry_index,
+	     NULL ) == 1 )
+	{
+		libfwnt_access_control_list_remove_entry(
+		 access_control_list,
+		 entry_index - 1,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the flags and entries of an access control list (ACL) from a string
+ * The control flags are updated with the presence and flags of the ACL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_read_access_control_list(
+     const uint8_t *string,
+     size_t string_length,
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t is_system_acl,
+     uint16_t *control_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_list_t *access_control_list = NULL;
+	static char *function                              = "libfwnt_sddl_read_access_control_list";
+	size_t entry_end_index                             = 0;
+	size_t string_index                                = 0;
+	uint16_t auto_inherit_req_flag                     = LIBFWNT_CONTROL_FLAG_DACL_AUTO_INHERIT_REQ;
+	uint16_t auto_inherited_flag                       = LIBFWNT_CONTROL_FLAG_DACL_AUTO_INHERITED;
+	uint16_t present_flag                              = LIBFWNT_CONTROL_FLAG_DACL_PRESENT;
+	uint16_t protected_flag                            = LIBFWNT_CONTROL_FLAG_DACL_PROTECTED;
+	int result                                         = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid control flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( is_system_acl != 0 )
+	{
+		auto_inherit_req_flag = LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERIT_REQ;
+		auto_inherited_flag   = LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERITED;
+		present_flag          = LIBFWNT_CONTROL_FLAG_SACL_PRESENT;
+		protected_flag        = LIBFWNT_CONTROL_FLAG_SACL_PROTECTED;
+	}
+	*control_flags |= present_flag;
+
+	while( ( string_index < string_length )
+	    && ( string[ string_index ] != (uint8_t) '(' ) )
+	{
+		if( string[ string_index ] == (uint8_t) 'P' )
+		{
+			*control_flags |= protected_flag;
+
+			string_index += 1;
+		}
+		else if( ( ( string_length - string_index ) >= 2 )
+		      && ( string[ string_index ] == (uint8_t) 'A' )
+		      && ( string[ string_index + 1 ] == (uint8_t) 'R' ) )
+		{
+			*control_flags |= auto_inherit_req_flag;
+
+			string_index += 2;
+		}
+		else if( ( ( string_length - string_index ) >= 2 )
+		      && ( string[ string_index ] == (uint8_t) 'A' )
+		      && ( string[ string_index + 1 ] == (uint8_t) 'I' ) )
+		{
+			*control_flags |= auto_inherited_flag;
+
+			string_index += 2;
+		}
+		else if( ( ( string_length - string_index ) == 17 )
+		      && ( narrow_string_compare(
+		            (char *) &( string[ string_index ] ),
+		            "NO_ACCESS_CONTROL",
+		            17 ) == 0 ) )
+		{
+			/* A NULL ACL is only represented by the present control flag
+			 */
+			return( 1 );
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access control list flag at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	if( is_system_acl != 0 )
+	{
+		result = libfwnt_security_descriptor_create_system_acl(
+		          security_descriptor,
+		          &access_control_list,
+		          error );
+	}
+	else
+	{
+		result = libfwnt_security_descriptor_create_discretionary_acl(
+		          security_descriptor,
+		          &access_control_list,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create access control list.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_index < string_length )
+	{
+		if( string[ string_index ] != (uint8_t) '(' )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: missing access control entry start at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		string_index++;
+
+		for( entry_end_index = string_index;
+		     entry_end_index < string_length;
+		     entry_end_index++ )
+		{
+			if( string[ entry_end_index ] == (uint8_t) ')' )
+			{
+				break;
+			}
+		}
+		if( entry_end_index >= string_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: missing access control entry end.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_sddl_read_access_control_entry(
+		     &( string[ string_index ] ),
+		     entry_end_index - string_index,
+		     access_control_list,
+		     security_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read access control entry at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		string_index = entry_end_index + 1;
+	}
+	return( 1 );
+}
+
+/* Reads a security descriptor from a string
+ * The string is formatted as: O:owner_sid G:group_sid D:dacl_flags(ace)... S:sacl_flags(ace)...
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_sddl_read_security_descriptor(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	static char *function                              = "libfwnt_sddl_read_security_descriptor";
+	size_t depth                                       = 0;
+	size_t string_index                                = 0;
+	size_t value_end_index                             = 0;
+	size_t value_start_index                           = 0;
+	uint16_t control_flags                             = 0;
+	uint8_t section_type                               = 0;
+	uint8_t sections_read                              = 0;
+	uint8_t section_flag                               = 0;
+	int result                                         = 0;
+
+	if( internal_security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_initialize(
+	     &security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security identifier.",
+		 function );
+
+		goto on_error;
+	}
+	while( string_index < string_length )
+	{
+		if( ( ( string_length - string_index ) < 2 )
+		 || ( string[ string_index + 1 ] != (uint8_t) ':' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: missing section at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			goto on_error;
+		}
+		section_type = string[ string_index ];
+
+		switch( section_type )
+		{
+			case (uint8_t) 'O':
+				section_flag = 0x01;
+				break;
+
+			case (uint8_t) 'G':
+				section_flag = 0x02;
+				break;
+
+			case (uint8_t) 'D':
+				section_flag = 0x04;
+				break;
+
+			case (uint8_t) 'S':
+				section_flag = 0x08;
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported section: %c.",
+				 function,
+				 (char) section_type );
+
+				goto on_error;
+		}
+		if( ( sections_read & section_flag ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid section: %c value already set.",
+			 function,
+			 (char) section_type );
+
+			goto on_error;
+		}
+		sections_read |= section_flag;
+
+		value_start_index = string_index + 2;
+
+		/* The section ends at the next section type outside of an entry
+		 */
+		depth = 0;
+
+		for( value_end_index = value_start_index;
+		     value_end_index < string_length;
+		     value_end_index++ )
+		{
+			if( string[ value_end_index ] == (uint8_t) '(' )
+			{
+				depth++;
+			}
+			else if( ( string[ value_end_index ] == (uint8_t) ')' )
+			      && ( depth > 0 ) )
+			{
+				depth--;
+			}
+			else if( ( depth == 0 )
+			      && ( ( value_end_index + 1 ) < string_length )
+			      && ( string[ value_end_index + 1 ] == (uint8_t) ':' ) )
+			{
+				break;
+			}
+		}
+		switch( section_type )
+		{
+			case (uint8_t) 'O':
+			case (uint8_t) 'G':
+				if( libfwnt_security_identifier_copy_from_utf8_string(
+				     security_identifier,
+				     &( string[ value_start_index ] ),
+				     value_end_index - value_start_index,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy security identifier from string.",
+					 function );
+
+					goto on_error;
+				}
+				if( section_type == (uint8_t) 'O' )
+				{
+					result = libfwnt_internal_security_descriptor_set_security_identifier(
+					          internal_security_descriptor,
+					          &( internal_security_descriptor->owner_sid ),
+					          security_identifier,
+					          error );
+				}
+				else
+				{
+					result = libfwnt_internal_security_descriptor_set_security_identifier(
+					          internal_security_descriptor,
+					          &( internal_security_descriptor->group_sid ),
+					          security_identifier,
+					          error );
+				}
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set security identifier.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			case (uint8_t) 'D':
+			case (uint8_t) 'S':
+				if( libfwnt_sddl_read_access_control_list(
+				     &( string[ value_start_index ] ),
+				     value_end_index - value_start_index,
+				     (libfwnt_security_descriptor_t *) internal_security_descriptor,
+				     security_identifier,
+				     (uint8_t) ( section_type == (uint8_t) 'S' ),
+				     &control_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to read access control list.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+		}
+		string_index = value_end_index;
+	}
+	if( libfwnt_security_identifier_free(
+	     &security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free security identifier.",
+		 function );
+
+		goto on_error;
+	}
+	internal_security_descriptor->revision_number = 1;
+	internal_security_descriptor->control_flags   = control_flags;
+
+	return( 1 );
+
+on_error:
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Security descriptor definition language (SDDL) functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_SDDL_H )
+#define _LIBFWNT_SDDL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_access_control_entry.h"
+#include "libfwnt_access_control_list.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_identifier.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The SDDL write functions append to a string at a specific index
+ * If the string is NULL only the index is advanced, which is used to determine the string size
+ */
+
+typedef struct libfwnt_sddl_alias libfwnt_sddl_alias_t;
+
+struct libfwnt_sddl_alias
+{
+	/* The value
+	 */
+	uint32_t value;
+
+	/* The alias
+	 */
+	const char *alias;
+};
+
+int libfwnt_sddl_write_characters(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     const char *characters,
+     size_t number_of_characters,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_write_security_identifier(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_write_access_mask(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     uint8_t access_control_type,
+     uint32_t access_mask,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_write_guid(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     const uint8_t *guid_data,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_write_access_control_entry(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_access_control_entry_t *internal_access_control_entry,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_write_access_control_list(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_access_control_list_t *internal_access_control_list,
+     uint16_t control_flags,
+     uint8_t is_system_acl,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_write_security_descriptor(
+     uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_get_alias_value(
+     const libfwnt_sddl_alias_t *aliases,
+     const uint8_t *string,
+     size_t string_length,
+     uint32_t *value,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_read_access_mask(
+     const uint8_t *string,
+     size_t string_length,
+     uint8_t access_control_type,
+     uint32_t *access_mask,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_read_guid(
+     const uint8_t *string,
+     size_t string_length,
+     uint8_t *guid_data,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_read_access_control_entry(
+     const uint8_t *string,
+     size_t string_length,
+     libfwnt_access_control_list_t *access_control_list,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_read_access_control_list(
+     const uint8_t *string,
+     size_t string_length,
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t is_system_acl,
+     uint16_t *control_flags,
+     libcerror_error_t **error );
+
+int libfwnt_sddl_read_security_descriptor(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_SDDL_H ) */
+
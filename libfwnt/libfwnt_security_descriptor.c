@@ -28,11 +28,16 @@
 #include <wide_string.h>
 
 #include "libfwnt_access_control_list.h"
+#include "libfwnt_access_token.h"
+#include "libfwnt_allocator.h"
+#include "libfwnt_arena.h"
 #include "libfwnt_debug.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_libcnotify.h"
+#include "libfwnt_sddl.h"
 #include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_descriptor_cache.h"
 #include "libfwnt_security_identifier.h"
 #include "libfwnt_types.h"
 
@@ -43,9 +48,27 @@
 int libfwnt_security_descriptor_initialize(
      libfwnt_security_descriptor_t **security_descriptor,
      libcerror_error_t **error )
+{
+	return( libfwnt_security_descriptor_initialize_with_arena(
+	         security_descriptor,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a security descriptor
+ * Make sure the value security_descriptor is referencing, is set to NULL
+ * If no arena is provided the security descriptor is allocated using the allocator
+ * otherwise the security descriptor and all the values it contains are allocated
+ * from the arena and are released when the arena is cleared or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_initialize_with_arena(
+     libfwnt_security_descriptor_t **security_descriptor,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
-	static char *function                                                = "libfwnt_security_descriptor_initialize";
+	static char *function                                                = "libfwnt_security_descriptor_initialize_with_arena";
 
 	if( security_descriptor == NULL )
 	{
@@ -69,7 +92,8 @@ int libfwnt_security_descriptor_initialize(
 
 		return( -1 );
 	}
-	internal_security_descriptor = memory_allocate_structure(
+	internal_security_descriptor = libfwnt_arena_allocate_structure(
+	                                arena,
 	                                libfwnt_internal_security_descriptor_t );
 
 	if( internal_security_descriptor == NULL )
@@ -97,6 +121,8 @@ int libfwnt_security_descriptor_initialize(
 
 		goto on_error;
 	}
+	internal_security_descriptor->arena = arena;
+
 	*security_descriptor = (libfwnt_security_descriptor_t *) internal_security_descriptor;
 
 	return( 1 );
@@ -104,13 +130,15 @@ int libfwnt_security_descriptor_initialize(
 on_error:
 	if( internal_security_descriptor != NULL )
 	{
-		memory_free(
+		libfwnt_arena_release(
+		 arena,
 		 internal_security_descriptor );
 	}
 	return( -1 );
 }
 
 /* Frees a security descriptor
+ * A security descriptor retrieved from a cache must be released using the cache
  * Returns 1 if successful or -1 on error
  */
 int libfwnt_security_descriptor_free(
@@ -135,7 +163,19 @@ int libfwnt_security_descriptor_free(
 	if( *security_descriptor != NULL )
 	{
 		internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) *security_descriptor;
-		*security_descriptor         = NULL;
+
+		if( internal_security_descriptor->cache_entry != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid security descriptor - shared by cache.",
+			 function );
+
+			return( -1 );
+		}
+		*security_descriptor = NULL;
 
 		if( internal_security_descriptor->owner_sid != NULL )
 		{
@@ -201,37 +241,40 @@ int libfwnt_security_descriptor_free(
 				result = -1;
 			}
 		}
-		memory_free(
+		libfwnt_arena_release(
+		 internal_security_descriptor->arena,
 		 internal_security_descriptor );
 	}
 	return( result );
 }
 
 /* Converts a security descriptor stored in a byte stream into a runtime version
+ * The values of a previously converted security descriptor are reused
+ * If header_only is set the access control lists are not read
  * Returns 1 if successful or -1 on error
  */
-int libfwnt_security_descriptor_copy_from_byte_stream(
-     libfwnt_security_descriptor_t *security_descriptor,
+int libfwnt_internal_security_descriptor_copy_from_byte_stream(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
      const uint8_t *byte_stream,
      size_t byte_stream_size,
      int byte_order,
+     uint8_t header_only,
      libcerror_error_t **error )
 {
-	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
-	static char *function                                                = "libfwnt_security_descriptor_copy_from_byte_stream";
-	uint32_t discretionary_acl_offset                                    = 0;
-	uint32_t group_sid_offset                                            = 0;
-	uint32_t owner_sid_offset                                            = 0;
-	uint32_t system_acl_offset                                           = 0;
-	uint16_t control_flags                                               = 0;
+	static char *function             = "libfwnt_internal_security_descriptor_copy_from_byte_stream";
+	uint32_t discretionary_acl_offset = 0;
+	uint32_t group_sid_offset         = 0;
+	uint32_t owner_sid_offset         = 0;
+	uint32_t system_acl_offset        = 0;
+	uint16_t control_flags            = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	system_character_t *sid_string                                       = NULL;
-	size_t sid_string_size                                               = 0;
-	int result                                                           = 0;
+	system_character_t *sid_string    = NULL;
+	size_t sid_string_size            = 0;
+	int result                        = 0;
 #endif
 
-	if( security_descriptor == NULL )
+	if( internal_security_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -242,48 +285,13 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 		return( -1 );
 	}
-	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
-
-	if( internal_security_descriptor->owner_sid != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid security descriptor - owner SID value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_security_descriptor->group_sid != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid security descriptor - group SID value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_security_descriptor->system_acl != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid security descriptor - system ACL value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( internal_security_descriptor->discretionary_acl != NULL )
+	if( internal_security_descriptor->cache_entry != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid security descriptor - discretionary ACL value already set.",
+		 "%s: invalid security descriptor - shared by cache.",
 		 function );
 
 		return( -1 );
@@ -350,6 +358,8 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 	 &( byte_stream[ 2 ] ),
 	 control_flags );
 
+	internal_security_descriptor->control_flags = control_flags;
+
 	byte_stream_copy_to_uint32_little_endian(
 	 &( byte_stream[ 4 ] ),
 	 owner_sid_offset );
@@ -413,45 +423,139 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( owner_sid_offset != 0 )
+	/* An access control list offset is ignored if the corresponding present flag is not set
+	 */
+	if( ( control_flags & LIBFWNT_CONTROL_FLAG_SACL_PRESENT ) == 0 )
 	{
-		if( ( owner_sid_offset < 20 )
-		 || ( (size_t) owner_sid_offset > byte_stream_size ) )
+		system_acl_offset = 0;
+	}
+	if( ( control_flags & LIBFWNT_CONTROL_FLAG_DACL_PRESENT ) == 0 )
+	{
+		discretionary_acl_offset = 0;
+	}
+	internal_security_descriptor->is_header_only        = header_only;
+	internal_security_descriptor->has_system_acl        = (uint8_t) ( system_acl_offset != 0 );
+	internal_security_descriptor->has_discretionary_acl = (uint8_t) ( discretionary_acl_offset != 0 );
+
+	if( header_only != 0 )
+	{
+		system_acl_offset        = 0;
+		discretionary_acl_offset = 0;
+	}
+	/* The values of a previously converted security descriptor are reused
+	 * if present in the byte stream and freed otherwise
+	 */
+	if( ( owner_sid_offset == 0 )
+	 && ( internal_security_descriptor->owner_sid != NULL ) )
+	{
+		if( libfwnt_internal_security_identifier_free(
+		     (libfwnt_internal_security_identifier_t **) &( internal_security_descriptor->owner_sid ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: owner SID offset value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free owner security identifier.",
 			 function );
 
 			goto on_error;
 		}
-		if( libfwnt_security_identifier_initialize(
-		     &( internal_security_descriptor->owner_sid ),
+	}
+	if( ( group_sid_offset == 0 )
+	 && ( internal_security_descriptor->group_sid != NULL ) )
+	{
+		if( libfwnt_internal_security_identifier_free(
+		     (libfwnt_internal_security_identifier_t **) &( internal_security_descriptor->group_sid ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create owner security identifier.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free group security identifier.",
 			 function );
 
 			goto on_error;
 		}
-		if( internal_security_descriptor->owner_sid == NULL )
+	}
+	if( ( system_acl_offset == 0 )
+	 && ( internal_security_descriptor->system_acl != NULL ) )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->system_acl ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid security descriptor - missing owner security identifier.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free system ACL.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( discretionary_acl_offset == 0 )
+	 && ( internal_security_descriptor->discretionary_acl != NULL ) )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->discretionary_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free discretionary ACL.",
 			 function );
 
 			goto on_error;
 		}
-		( (libfwnt_internal_security_identifier_t *) internal_security_descriptor->owner_sid )->is_managed = 1;
+	}
+	if( owner_sid_offset != 0 )
+	{
+		if( ( owner_sid_offset < 20 )
+		 || ( (size_t) owner_sid_offset > byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: owner SID offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_security_descriptor->owner_sid == NULL )
+		{
+			if( libfwnt_security_identifier_initialize_with_arena(
+			     &( internal_security_descriptor->owner_sid ),
+			     internal_security_descriptor->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create owner security identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( internal_security_descriptor->owner_sid == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid security descriptor - missing owner security identifier.",
+				 function );
+
+				goto on_error;
+			}
+			( (libfwnt_internal_security_identifier_t *) internal_security_descriptor->owner_sid )->is_managed = 1;
+		}
 
 		if( libfwnt_security_identifier_copy_from_byte_stream(
 		     internal_security_descriptor->owner_sid,
@@ -561,31 +665,35 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_security_identifier_initialize(
-		     &( internal_security_descriptor->group_sid ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create group security identifier.",
-			 function );
-
-			goto on_error;
-		}
 		if( internal_security_descriptor->group_sid == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid security descriptor - missing group security identifier.",
-			 function );
+			if( libfwnt_security_identifier_initialize_with_arena(
+			     &( internal_security_descriptor->group_sid ),
+			     internal_security_descriptor->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create group security identifier.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( internal_security_descriptor->group_sid == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid security descriptor - missing group security identifier.",
+				 function );
+
+				goto on_error;
+			}
+			( (libfwnt_internal_security_identifier_t *) internal_security_descriptor->group_sid )->is_managed = 1;
 		}
-		( (libfwnt_internal_security_identifier_t *) internal_security_descriptor->group_sid )->is_managed = 1;
 
 		if( libfwnt_security_identifier_copy_from_byte_stream(
 		     internal_security_descriptor->group_sid,
@@ -695,18 +803,22 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_access_control_list_initialize(
-		     &( internal_security_descriptor->system_acl ),
-		     error ) != 1 )
+		if( internal_security_descriptor->system_acl == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create system ACL.",
-			 function );
+			if( libfwnt_access_control_list_initialize_with_arena(
+			     &( internal_security_descriptor->system_acl ),
+			     internal_security_descriptor->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create system ACL.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		if( libfwnt_access_control_list_copy_from_byte_stream(
 		     internal_security_descriptor->system_acl,
@@ -739,18 +851,22 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
 
 			goto on_error;
 		}
-		if( libfwnt_access_control_list_initialize(
-		     &( internal_security_descriptor->discretionary_acl ),
-		     error ) != 1 )
+		if( internal_security_descriptor->discretionary_acl == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create discretionary ACL.",
-			 function );
+			if( libfwnt_access_control_list_initialize_with_arena(
+			     &( internal_security_descriptor->discretionary_acl ),
+			     internal_security_descriptor->arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create discretionary ACL.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
 		if( libfwnt_access_control_list_copy_from_byte_stream(
 		     internal_security_descriptor->discretionary_acl,
@@ -803,74 +919,88 @@ on_error:
 		 (libfwnt_internal_security_identifier_t **) &( internal_security_descriptor->owner_sid ),
 		 NULL );
 	}
+	internal_security_descriptor->is_header_only = 0;
+
 	return( -1 );
 }
 
-/* Retrieves the owner security identifier (SID)
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Converts a security descriptor stored in a byte stream into a runtime version
+ * The values of a previously converted security descriptor are reused
+ * Returns 1 if successful or -1 on error
  */
-int libfwnt_security_descriptor_get_owner(
+int libfwnt_security_descriptor_copy_from_byte_stream(
      libfwnt_security_descriptor_t *security_descriptor,
-     libfwnt_security_identifier_t **security_identifier,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
      libcerror_error_t **error )
 {
-	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
-	static char *function                                                = "libfwnt_security_descriptor_get_owner";
+	static char *function = "libfwnt_security_descriptor_copy_from_byte_stream";
 
-	if( security_descriptor == NULL )
+	if( libfwnt_internal_security_descriptor_copy_from_byte_stream(
+	     (libfwnt_internal_security_descriptor_t *) security_descriptor,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     0,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid security descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor from byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
-
-	if( security_identifier == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid security identifier.",
-		 function );
+	return( 1 );
+}
 
-		return( -1 );
-	}
-	if( *security_identifier != NULL )
+/* Converts the header, owner and group of a security descriptor stored in a byte stream into a runtime version
+ * The access control lists are not read, which is faster if only the control flags, owner or group are needed
+ * The access control lists, access checks and conversion functions are not available afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_copy_header_from_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_copy_header_from_byte_stream";
+
+	if( libfwnt_internal_security_descriptor_copy_from_byte_stream(
+	     (libfwnt_internal_security_descriptor_t *) security_descriptor,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     1,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid security identifier value already set.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor header from byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_security_descriptor->owner_sid == NULL )
-	{
-		return( 0 );
-	}
-	*security_identifier = internal_security_descriptor->owner_sid;
-
 	return( 1 );
 }
 
-/* Retrieves the group security identifier (SID)
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Retrieves the revision number
+ * Returns 1 if successful or -1 on error
  */
-int libfwnt_security_descriptor_get_group(
+int libfwnt_security_descriptor_get_revision_number(
      libfwnt_security_descriptor_t *security_descriptor,
-     libfwnt_security_identifier_t **security_identifier,
+     uint8_t *revision_number,
      libcerror_error_t **error )
 {
 	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
-	static char *function                                                = "libfwnt_security_descriptor_get_group";
+	static char *function                                                = "libfwnt_security_descriptor_get_revision_number";
 
 	if( security_descriptor == NULL )
 	{
@@ -885,22 +1015,157 @@ int libfwnt_security_descriptor_get_group(
 	}
 	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
 
-	if( security_identifier == NULL )
+	if( revision_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid security identifier.",
+		 "%s: invalid revision number.",
 		 function );
 
 		return( -1 );
 	}
-	if( *security_identifier != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	*revision_number = internal_security_descriptor->revision_number;
+
+	return( 1 );
+}
+
+/* Retrieves the control flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_control_flags(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint16_t *control_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_get_control_flags";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( control_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid control flags.",
+		 function );
+
+		return( -1 );
+	}
+	*control_flags = internal_security_descriptor->control_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the owner security identifier (SID)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_get_owner(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t **security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_get_owner";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security identifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->owner_sid == NULL )
+	{
+		return( 0 );
+	}
+	*security_identifier = internal_security_descriptor->owner_sid;
+
+	return( 1 );
+}
+
+/* Retrieves the group security identifier (SID)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_get_group(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t **security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_get_group";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
 		 "%s: invalid security identifier value already set.",
 		 function );
@@ -962,6 +1227,17 @@ int libfwnt_security_descriptor_get_discretionary_acl(
 
 		return( -1 );
 	}
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_security_descriptor->discretionary_acl == NULL )
 	{
 		return( 0 );
@@ -1017,6 +1293,17 @@ int libfwnt_security_descriptor_get_system_acl(
 
 		return( -1 );
 	}
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_security_descriptor->system_acl == NULL )
 	{
 		return( 0 );
@@ -1026,3 +1313,1847 @@ int libfwnt_security_descriptor_get_system_acl(
 	return( 1 );
 }
 
+/* Retrieves the discretionary access control list (ACL) state
+ * The state distinguishes a discretionary ACL that is not present from one that is present but NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_discretionary_acl_state(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *state,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_get_discretionary_acl_state";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_security_descriptor->control_flags & LIBFWNT_CONTROL_FLAG_DACL_PRESENT ) == 0 )
+	{
+		*state = LIBFWNT_ACCESS_CONTROL_LIST_STATE_NOT_PRESENT;
+	}
+	else if( ( internal_security_descriptor->discretionary_acl != NULL )
+	      || ( ( internal_security_descriptor->is_header_only != 0 )
+	       &&  ( internal_security_descriptor->has_discretionary_acl != 0 ) ) )
+	{
+		*state = LIBFWNT_ACCESS_CONTROL_LIST_STATE_PRESENT;
+	}
+	else
+	{
+		*state = LIBFWNT_ACCESS_CONTROL_LIST_STATE_NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the system access control list (ACL) state
+ * The state distinguishes a system ACL that is not present from one that is present but NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_system_acl_state(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *state,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_get_system_acl_state";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid state.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_security_descriptor->control_flags & LIBFWNT_CONTROL_FLAG_SACL_PRESENT ) == 0 )
+	{
+		*state = LIBFWNT_ACCESS_CONTROL_LIST_STATE_NOT_PRESENT;
+	}
+	else if( ( internal_security_descriptor->system_acl != NULL )
+	      || ( ( internal_security_descriptor->is_header_only != 0 )
+	       &&  ( internal_security_descriptor->has_system_acl != 0 ) ) )
+	{
+		*state = LIBFWNT_ACCESS_CONTROL_LIST_STATE_PRESENT;
+	}
+	else
+	{
+		*state = LIBFWNT_ACCESS_CONTROL_LIST_STATE_NULL;
+	}
+	return( 1 );
+}
+
+/* Determines the access granted by the security descriptor to an access token
+ * If the DACL present flag is not set or the discretionary access control list is NULL
+ * all access is granted, if the discretionary access control list is empty no access is granted
+ * If desired_access contains LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED all the access
+ * rights granted to the access token are returned
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_check_access(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_token_t *access_token,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_check_access";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( access_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access token.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( internal_security_descriptor->control_flags & LIBFWNT_CONTROL_FLAG_DACL_PRESENT ) == 0 )
+	 || ( internal_security_descriptor->discretionary_acl == NULL ) )
+	{
+		if( ( desired_access & LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED ) != 0 )
+		{
+			/* All standard and object specific access rights
+			 */
+			desired_access &= ~( (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED );
+			desired_access |= 0x001fffffUL;
+		}
+		*granted_access = desired_access;
+
+		return( 1 );
+	}
+	if( libfwnt_internal_access_control_list_check_access(
+	     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl,
+	     (libfwnt_internal_access_token_t *) access_token,
+	     (libfwnt_internal_security_identifier_t *) internal_security_descriptor->owner_sid,
+	     desired_access,
+	     granted_access,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to check access of discretionary ACL.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the access granted by the security descriptor to multiple access tokens
+ * granted_access_masks must contain an access mask for every access token
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_check_access_for_tokens(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_token_t **access_tokens,
+     int number_of_access_tokens,
+     uint32_t desired_access,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwnt_security_descriptor_check_access_for_tokens";
+	int access_token_index = 0;
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access tokens.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_access_tokens < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of access tokens value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( granted_access_masks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid granted access masks.",
+		 function );
+
+		return( -1 );
+	}
+	for( access_token_index = 0;
+	     access_token_index < number_of_access_tokens;
+	     access_token_index++ )
+	{
+		if( libfwnt_security_descriptor_check_access(
+		     security_descriptor,
+		     access_tokens[ access_token_index ],
+		     desired_access,
+		     &( granted_access_masks[ access_token_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check access of access token: %d.",
+			 function,
+			 access_token_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Removes the owner, group, access control lists and control flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_descriptor_remove_values(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_descriptor_remove_values";
+	int result            = 1;
+
+	if( internal_security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_internal_security_identifier_free(
+		     (libfwnt_internal_security_identifier_t **) &( internal_security_descriptor->owner_sid ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free owner security identifier.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_internal_security_identifier_free(
+		     (libfwnt_internal_security_identifier_t **) &( internal_security_descriptor->group_sid ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free group security identifier.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->system_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free system ACL.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->discretionary_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free discretionary ACL.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_security_descriptor->control_flags  = 0;
+	internal_security_descriptor->is_header_only = 0;
+
+	return( result );
+}
+
+/* Formats the cached UTF-8 strings of the security identifiers
+ * The strings are otherwise formatted on first use, which would modify
+ * the security identifiers while the security descriptor is shared between threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_descriptor_format_strings(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_access_control_list_t *access_control_lists[ 2 ];
+
+	libfwnt_internal_access_control_entry_t *internal_access_control_entry = NULL;
+	static char *function                                                  = "libfwnt_internal_security_descriptor_format_strings";
+	int access_control_list_index                                          = 0;
+	int entry_index                                                        = 0;
+
+	if( internal_security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_internal_security_identifier_get_cached_utf8_string(
+		     (libfwnt_internal_security_identifier_t *) internal_security_descriptor->owner_sid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to format owner security identifier string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_internal_security_identifier_get_cached_utf8_string(
+		     (libfwnt_internal_security_identifier_t *) internal_security_descriptor->group_sid,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to format group security identifier string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	access_control_lists[ 0 ] = (libfwnt_internal_access_control_list_t *) internal_security_descriptor->system_acl;
+	access_control_lists[ 1 ] = (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl;
+
+	for( access_control_list_index = 0;
+	     access_control_list_index < 2;
+	     access_control_list_index++ )
+	{
+		if( access_control_lists[ access_control_list_index ] == NULL )
+		{
+			continue;
+		}
+		for( entry_index = 0;
+		     entry_index < access_control_lists[ access_control_list_index ]->number_of_entries;
+		     entry_index++ )
+		{
+			internal_access_control_entry = access_control_lists[ access_control_list_index ]->entries[ entry_index ];
+
+			if( ( internal_access_control_entry == NULL )
+			 || ( internal_access_control_entry->security_identifier == NULL ) )
+			{
+				continue;
+			}
+			if( libfwnt_internal_security_identifier_get_cached_utf8_string(
+			     (libfwnt_internal_security_identifier_t *) internal_access_control_entry->security_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to format access control entry: %d security identifier string.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Sets a security identifier (SID) of the security descriptor
+ * The values of the security identifier are copied, a NULL security identifier removes it
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_descriptor_set_security_identifier(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libfwnt_security_identifier_t **descriptor_security_identifier,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_descriptor_set_security_identifier";
+
+	if( internal_security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier == NULL )
+	{
+		if( *descriptor_security_identifier != NULL )
+		{
+			if( libfwnt_internal_security_identifier_free(
+			     (libfwnt_internal_security_identifier_t **) descriptor_security_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free security identifier.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+	if( *descriptor_security_identifier == NULL )
+	{
+		if( libfwnt_security_identifier_initialize_with_arena(
+		     descriptor_security_identifier,
+		     internal_security_descriptor->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( *descriptor_security_identifier == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		( (libfwnt_internal_security_identifier_t *) *descriptor_security_identifier )->is_managed = 1;
+	}
+	if( libfwnt_internal_security_identifier_set_values(
+	     (libfwnt_internal_security_identifier_t *) *descriptor_security_identifier,
+	     (libfwnt_internal_security_identifier_t *) security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set security identifier values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the owner security identifier (SID)
+ * The values of the security identifier are copied, a NULL security identifier removes the owner
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_set_owner(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_set_owner";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( libfwnt_internal_security_descriptor_set_security_identifier(
+	     internal_security_descriptor,
+	     &( internal_security_descriptor->owner_sid ),
+	     security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set owner security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the group security identifier (SID)
+ * The values of the security identifier are copied, a NULL security identifier removes the group
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_set_group(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_set_group";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( libfwnt_internal_security_descriptor_set_security_identifier(
+	     internal_security_descriptor,
+	     &( internal_security_descriptor->group_sid ),
+	     security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set group security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an empty discretionary access control list (ACL)
+ * An existing discretionary ACL is replaced
+ * The ACL is owned by the security descriptor, use libfwnt_access_control_list_append_entry to add entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_create_discretionary_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_control_list_t **access_control_list,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_create_discretionary_acl";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_control_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access control list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->discretionary_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free discretionary ACL.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_access_control_list_initialize_with_arena(
+	     &( internal_security_descriptor->discretionary_acl ),
+	     internal_security_descriptor->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create discretionary ACL.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor->control_flags |= LIBFWNT_CONTROL_FLAG_DACL_PRESENT;
+
+	*access_control_list = internal_security_descriptor->discretionary_acl;
+
+	return( 1 );
+}
+
+/* Removes the discretionary access control list (ACL)
+ * References to the ACL and its entries are no longer valid after it is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_remove_discretionary_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_remove_discretionary_acl";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->discretionary_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free discretionary ACL.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_security_descriptor->control_flags &= ~( LIBFWNT_CONTROL_FLAG_DACL_PRESENT );
+
+	return( 1 );
+}
+
+/* Creates an empty system access control list (ACL)
+ * An existing system ACL is replaced
+ * The ACL is owned by the security descriptor, use libfwnt_access_control_list_append_entry to add entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_create_system_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_control_list_t **access_control_list,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_create_system_acl";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( access_control_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *access_control_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid access control list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->system_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free system ACL.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_access_control_list_initialize_with_arena(
+	     &( internal_security_descriptor->system_acl ),
+	     internal_security_descriptor->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create system ACL.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor->control_flags |= LIBFWNT_CONTROL_FLAG_SACL_PRESENT;
+
+	*access_control_list = internal_security_descriptor->system_acl;
+
+	return( 1 );
+}
+
+/* Removes the system access control list (ACL)
+ * References to the ACL and its entries are no longer valid after it is removed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_remove_system_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_remove_system_acl";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_free(
+		     (libfwnt_internal_access_control_list_t **) &( internal_security_descriptor->system_acl ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free system ACL.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_security_descriptor->control_flags &= ~( LIBFWNT_CONTROL_FLAG_SACL_PRESENT );
+
+	return( 1 );
+}
+
+/* Determines the size of a security descriptor as stored in a self-relative byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_descriptor_get_data_size(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwnt_internal_security_descriptor_get_data_size";
+	size_t descriptor_size = 20;
+	size_t value_size      = 0;
+
+	if( internal_security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_get_data_size(
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->system_acl,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of system ACL.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_size += value_size;
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_get_data_size(
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of discretionary ACL.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_size += value_size;
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_data_size(
+		     internal_security_descriptor->owner_sid,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of owner security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_size += value_size;
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_data_size(
+		     internal_security_descriptor->group_sid,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of group security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		descriptor_size += value_size;
+	}
+	*data_size = descriptor_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the security descriptor as stored in a self-relative byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_data_size(
+     libfwnt_security_descriptor_t *security_descriptor,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_get_data_size";
+
+	if( libfwnt_internal_security_descriptor_get_data_size(
+	     (libfwnt_internal_security_descriptor_t *) security_descriptor,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts a security descriptor into a self-relative byte stream
+ * The values are stored in the order: header, system ACL, discretionary ACL, owner and group
+ * The size of the byte stream is determined before any data is written
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_copy_to_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_copy_to_byte_stream";
+	size_t byte_stream_offset                                            = 20;
+	size_t descriptor_size                                               = 0;
+	size_t value_size                                                    = 0;
+	uint32_t discretionary_acl_offset                                    = 0;
+	uint32_t group_sid_offset                                            = 0;
+	uint32_t owner_sid_offset                                            = 0;
+	uint32_t system_acl_offset                                           = 0;
+	uint16_t control_flags                                               = 0;
+	uint8_t revision_number                                              = 0;
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_descriptor_get_data_size(
+	     internal_security_descriptor,
+	     &descriptor_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine security descriptor size.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < descriptor_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_get_data_size(
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->system_acl,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of system ACL.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_list_copy_to_byte_stream(
+		     internal_security_descriptor->system_acl,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     value_size,
+		     LIBFWNT_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy system ACL to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		system_acl_offset   = (uint32_t) byte_stream_offset;
+		byte_stream_offset += value_size;
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_get_data_size(
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of discretionary ACL.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_list_copy_to_byte_stream(
+		     internal_security_descriptor->discretionary_acl,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     value_size,
+		     LIBFWNT_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy discretionary ACL to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		discretionary_acl_offset = (uint32_t) byte_stream_offset;
+		byte_stream_offset      += value_size;
+	}
+	if( internal_security_descriptor->owner_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_data_size(
+		     internal_security_descriptor->owner_sid,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of owner security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_copy_to_byte_stream(
+		     internal_security_descriptor->owner_sid,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     value_size,
+		     LIBFWNT_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy owner security identifier to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		owner_sid_offset    = (uint32_t) byte_stream_offset;
+		byte_stream_offset += value_size;
+	}
+	if( internal_security_descriptor->group_sid != NULL )
+	{
+		if( libfwnt_security_identifier_get_data_size(
+		     internal_security_descriptor->group_sid,
+		     &value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of group security identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwnt_security_identifier_copy_to_byte_stream(
+		     internal_security_descriptor->group_sid,
+		     &( byte_stream[ byte_stream_offset ] ),
+		     value_size,
+		     LIBFWNT_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy group security identifier to byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		group_sid_offset    = (uint32_t) byte_stream_offset;
+		byte_stream_offset += value_size;
+	}
+	revision_number = internal_security_descriptor->revision_number;
+
+	if( revision_number == 0 )
+	{
+		revision_number = 1;
+	}
+	/* The presence flags are set for the values and retained for NULL ACLs,
+	 * the self-relative flag is always set
+	 */
+	control_flags = internal_security_descriptor->control_flags | LIBFWNT_CONTROL_FLAG_SELF_RELATIVE;
+
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		control_flags |= LIBFWNT_CONTROL_FLAG_DACL_PRESENT;
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		control_flags |= LIBFWNT_CONTROL_FLAG_SACL_PRESENT;
+	}
+	byte_stream[ 0 ] = revision_number;
+	byte_stream[ 1 ] = 0;
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 control_flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 owner_sid_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 group_sid_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 12 ] ),
+	 system_acl_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( byte_stream[ 16 ] ),
+	 discretionary_acl_offset );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded security descriptor definition language (SDDL) string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_utf8_sddl_string_size(
+     libfwnt_security_descriptor_t *security_descriptor,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_get_utf8_sddl_string_size";
+	size_t string_index   = 0;
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_sddl_write_security_descriptor(
+	     NULL,
+	     0,
+	     &string_index,
+	     (libfwnt_internal_security_descriptor_t *) security_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of SDDL string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = string_index + 1;
+
+	return( 1 );
+}
+
+/* Converts the security descriptor into an UTF-8 encoded security descriptor definition language (SDDL) string
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_copy_to_utf8_sddl_string";
+	size_t string_index   = 0;
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Reserve space for the end of string character
+	 */
+	if( libfwnt_sddl_write_security_descriptor(
+	     utf8_string,
+	     utf8_string_size - 1,
+	     &string_index,
+	     (libfwnt_internal_security_descriptor_t *) security_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor to SDDL string.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ string_index ] = 0;
+
+	return( 1 );
+}
+
+/* Converts an UTF-8 encoded security descriptor definition language (SDDL) string into a security descriptor
+ * The values of a previously converted security descriptor are replaced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+     libfwnt_security_descriptor_t *security_descriptor,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_copy_from_utf8_sddl_string";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-8 string length exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a trailing end of string character
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length--;
+	}
+	if( libfwnt_internal_security_descriptor_remove_values(
+	     internal_security_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_sddl_read_security_descriptor(
+	     internal_security_descriptor,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor from SDDL string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libfwnt_internal_security_descriptor_remove_values(
+	 internal_security_descriptor,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Normalizes a security descriptor into its canonical form
+ * The defaulted, auto inherit required and self-relative control flags are cleared,
+ * the revision is reset and both access control lists are normalized
+ * Equivalent security descriptors have identical byte streams after normalization
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_normalize(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_t *internal_security_descriptor = NULL;
+	static char *function                                                = "libfwnt_security_descriptor_normalize";
+
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor = (libfwnt_internal_security_descriptor_t *) security_descriptor;
+
+	if( internal_security_descriptor->cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor - shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->is_header_only != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor - access control lists not read.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor->discretionary_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_normalize(
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->discretionary_acl,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to normalize discretionary access control list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_security_descriptor->system_acl != NULL )
+	{
+		if( libfwnt_internal_access_control_list_normalize(
+		     (libfwnt_internal_access_control_list_t *) internal_security_descriptor->system_acl,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to normalize system access control list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_security_descriptor->control_flags &= ~( LIBFWNT_CONTROL_FLAG_OWNER_DEFAULTED
+	                                                | LIBFWNT_CONTROL_FLAG_GROUP_DEFAULTED
+	                                                | LIBFWNT_CONTROL_FLAG_DACL_DEFAULTED
+	                                                | LIBFWNT_CONTROL_FLAG_SACL_DEFAULTED
+	                                                | LIBFWNT_CONTROL_FLAG_DACL_AUTO_INHERIT_REQ
+	                                                | LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERIT_REQ
+	                                                | LIBFWNT_CONTROL_FLAG_SELF_RELATIVE );
+
+	internal_security_descriptor->revision_number = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the hash of a security descriptor
+ * The hash is calculated over the self-relative byte stream, hence equivalent
+ * security descriptors have the same hash after normalization
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_get_hash(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	uint8_t data[ LIBFWNT_SECURITY_DESCRIPTOR_HASH_DATA_SIZE ];
+
+	uint8_t *byte_stream  = NULL;
+	static char *function = "libfwnt_security_descriptor_get_hash";
+	size_t data_size      = 0;
+
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_descriptor_get_data_size(
+	     (libfwnt_internal_security_descriptor_t *) security_descriptor,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Most security descriptors fit in the data on the stack,
+	 * only larger security descriptors require an allocation
+	 */
+	if( data_size <= LIBFWNT_SECURITY_DESCRIPTOR_HASH_DATA_SIZE )
+	{
+		byte_stream = data;
+	}
+	else
+	{
+		byte_stream = (uint8_t *) libfwnt_allocator_allocate(
+		                           sizeof( uint8_t ) * data_size );
+
+		if( byte_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create byte stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwnt_security_descriptor_copy_to_byte_stream(
+	     security_descriptor,
+	     byte_stream,
+	     data_size,
+	     LIBFWNT_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor to byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	*hash = libfwnt_security_descriptor_cache_calculate_hash(
+	         byte_stream,
+	         data_size );
+
+	if( byte_stream != data )
+	{
+		libfwnt_allocator_free(
+		 byte_stream );
+	}
+	return( 1 );
+
+on_error:
+	if( ( byte_stream != NULL )
+	 && ( byte_stream != data ) )
+	{
+		libfwnt_allocator_free(
+		 byte_stream );
+	}
+	return( -1 );
+}
+
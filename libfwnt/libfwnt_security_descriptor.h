@@ -25,10 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwnt_arena.h"
 #include "libfwnt_extern.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_types.h"
 
+/* The size of the data on the stack used to calculate the hash
+ */
+#define LIBFWNT_SECURITY_DESCRIPTOR_HASH_DATA_SIZE	512
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
@@ -49,6 +54,10 @@ struct libfwnt_internal_security_descriptor
 	 */
 	uint8_t revision_number;
 
+	/* The control flags
+	 */
+	uint16_t control_flags;
+
 	/* The owner SID
 	 */
 	libfwnt_security_identifier_t *owner_sid;
@@ -64,6 +73,26 @@ struct libfwnt_internal_security_descriptor
 	/* The discretionary ACL
 	 */
 	libfwnt_access_control_list_t *discretionary_acl;
+
+	/* Value to indicate only the header, owner and group were read
+	 */
+	uint8_t is_header_only;
+
+	/* Value to indicate the system ACL is stored in the byte stream, used if header only
+	 */
+	uint8_t has_system_acl;
+
+	/* Value to indicate the discretionary ACL is stored in the byte stream, used if header only
+	 */
+	uint8_t has_discretionary_acl;
+
+	/* The arena the descriptor was allocated from
+	 */
+	libfwnt_arena_t *arena;
+
+	/* The cache entry, set if the descriptor is shared by a cache
+	 */
+	intptr_t *cache_entry;
 };
 
 LIBFWNT_EXTERN \
@@ -71,11 +100,25 @@ int libfwnt_security_descriptor_initialize(
      libfwnt_security_descriptor_t **security_descriptor,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_initialize_with_arena(
+     libfwnt_security_descriptor_t **security_descriptor,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_descriptor_free(
      libfwnt_security_descriptor_t **security_descriptor,
      libcerror_error_t **error );
 
+int libfwnt_internal_security_descriptor_copy_from_byte_stream(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     uint8_t header_only,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_descriptor_copy_from_byte_stream(
      libfwnt_security_descriptor_t *security_descriptor,
@@ -84,6 +127,26 @@ int libfwnt_security_descriptor_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_copy_header_from_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_revision_number(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *revision_number,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_control_flags(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint16_t *control_flags,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_descriptor_get_owner(
      libfwnt_security_descriptor_t *security_descriptor,
@@ -108,6 +171,133 @@ int libfwnt_security_descriptor_get_system_acl(
      libfwnt_access_control_list_t **access_control_list,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_discretionary_acl_state(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *state,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_system_acl_state(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *state,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_check_access(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_token_t *access_token,
+     uint32_t desired_access,
+     uint32_t *granted_access,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_check_access_for_tokens(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_token_t **access_tokens,
+     int number_of_access_tokens,
+     uint32_t desired_access,
+     uint32_t *granted_access_masks,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_remove_values(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_format_strings(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_set_security_identifier(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     libfwnt_security_identifier_t **descriptor_security_identifier,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_set_owner(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_set_group(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_security_identifier_t *security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_create_discretionary_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_control_list_t **access_control_list,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_remove_discretionary_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_create_system_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libfwnt_access_control_list_t **access_control_list,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_remove_system_acl(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_get_data_size(
+     libfwnt_internal_security_descriptor_t *internal_security_descriptor,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_data_size(
+     libfwnt_security_descriptor_t *security_descriptor,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_copy_to_byte_stream(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_utf8_sddl_string_size(
+     libfwnt_security_descriptor_t *security_descriptor,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+     libfwnt_security_descriptor_t *security_descriptor,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_normalize(
+     libfwnt_security_descriptor_t *security_descriptor,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_get_hash(
+     libfwnt_security_descriptor_t *security_descriptor,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
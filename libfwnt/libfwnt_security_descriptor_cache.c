@@ -0,0 +1,1271 @@
+/*
+ * Windows NT Security Descriptor cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_allocator.h"
+#include "libfwnt_atomic.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_security_descriptor.h"
+#include "libfwnt_security_descriptor_cache.h"
+#include "libfwnt_types.h"
+
+/* Creates a security descriptor cache
+ * Make sure the value security_descriptor_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_initialize(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache = NULL;
+	static char *function                                                            = "libfwnt_security_descriptor_cache_initialize";
+	size_t buckets_size                                                              = 0;
+	size_t number_of_buckets                                                         = 0;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_entries <= 0 )
+	 || ( maximum_number_of_entries > ( INT_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least twice the number of buckets as entries to keep the chains short
+	 */
+	number_of_buckets = 16;
+
+	while( number_of_buckets < ( (size_t) maximum_number_of_entries * 2 ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	buckets_size = sizeof( libfwnt_security_descriptor_cache_entry_t * ) * number_of_buckets;
+
+	internal_security_descriptor_cache = libfwnt_allocator_allocate_structure(
+	                                      libfwnt_internal_security_descriptor_cache_t );
+
+	if( internal_security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security descriptor cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_security_descriptor_cache,
+	     0,
+	     sizeof( libfwnt_internal_security_descriptor_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security descriptor cache.",
+		 function );
+
+		libfwnt_allocator_free(
+		 internal_security_descriptor_cache );
+
+		return( -1 );
+	}
+	internal_security_descriptor_cache->buckets = (libfwnt_security_descriptor_cache_entry_t **) libfwnt_allocator_allocate(
+	                                                                                               buckets_size );
+
+	if( internal_security_descriptor_cache->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_security_descriptor_cache->buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	internal_security_descriptor_cache->number_of_buckets         = number_of_buckets;
+	internal_security_descriptor_cache->maximum_number_of_entries = maximum_number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_security_descriptor_cache->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*security_descriptor_cache = (libfwnt_security_descriptor_cache_t *) internal_security_descriptor_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_security_descriptor_cache != NULL )
+	{
+		if( internal_security_descriptor_cache->buckets != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_security_descriptor_cache->buckets );
+		}
+		libfwnt_allocator_free(
+		 internal_security_descriptor_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a security descriptor cache
+ * This also frees the security descriptors stored in the cache, all security
+ * descriptors retrieved from the cache should be released before
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_free(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry                           = NULL;
+	libfwnt_security_descriptor_cache_entry_t *next_entry                            = NULL;
+	static char *function                                                            = "libfwnt_security_descriptor_cache_free";
+	int result                                                                       = 1;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_cache != NULL )
+	{
+		internal_security_descriptor_cache = (libfwnt_internal_security_descriptor_cache_t *) *security_descriptor_cache;
+		*security_descriptor_cache         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_security_descriptor_cache->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		cache_entry = internal_security_descriptor_cache->first_entry;
+
+		while( cache_entry != NULL )
+		{
+			next_entry = cache_entry->next_entry;
+
+			if( libfwnt_security_descriptor_cache_entry_free(
+			     &cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cache entry.",
+				 function );
+
+				result = -1;
+			}
+			cache_entry = next_entry;
+		}
+		cache_entry = internal_security_descriptor_cache->first_evicted_entry;
+
+		while( cache_entry != NULL )
+		{
+			next_entry = cache_entry->next_entry;
+
+			if( libfwnt_security_descriptor_cache_entry_free(
+			     &cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free evicted cache entry.",
+				 function );
+
+				result = -1;
+			}
+			cache_entry = next_entry;
+		}
+		libfwnt_allocator_free(
+		 internal_security_descriptor_cache->buckets );
+
+		libfwnt_allocator_free(
+		 internal_security_descriptor_cache );
+	}
+	return( result );
+}
+
+/* Creates a security descriptor cache entry
+ * The security descriptor is parsed from a copy of the byte stream
+ * Make sure the value cache_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_entry_initialize(
+     libfwnt_security_descriptor_cache_entry_t **cache_entry,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint64_t hash,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_security_descriptor_cache_entry_t *safe_cache_entry = NULL;
+	static char *function                                       = "libfwnt_security_descriptor_cache_entry_initialize";
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size == 0 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_cache_entry = libfwnt_allocator_allocate_structure(
+	                    libfwnt_security_descriptor_cache_entry_t );
+
+	if( safe_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_cache_entry,
+	     0,
+	     sizeof( libfwnt_security_descriptor_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache entry.",
+		 function );
+
+		libfwnt_allocator_free(
+		 safe_cache_entry );
+
+		return( -1 );
+	}
+	safe_cache_entry->data = (uint8_t *) libfwnt_allocator_allocate(
+	                                      byte_stream_size );
+
+	if( safe_cache_entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     safe_cache_entry->data,
+	     byte_stream,
+	     byte_stream_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	safe_cache_entry->data_size = byte_stream_size;
+	safe_cache_entry->hash      = hash;
+
+	if( libfwnt_security_descriptor_initialize(
+	     &( safe_cache_entry->security_descriptor ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_security_descriptor_copy_from_byte_stream(
+	     safe_cache_entry->security_descriptor,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security descriptor from byte stream.",
+		 function );
+
+		goto on_error;
+	}
+	/* The security descriptor is shared between threads and must not change
+	 * after it has been added to the cache
+	 */
+	if( libfwnt_internal_security_descriptor_format_strings(
+	     (libfwnt_internal_security_descriptor_t *) safe_cache_entry->security_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to format security descriptor strings.",
+		 function );
+
+		goto on_error;
+	}
+	( (libfwnt_internal_security_descriptor_t *) safe_cache_entry->security_descriptor )->cache_entry = (intptr_t *) safe_cache_entry;
+
+	*cache_entry = safe_cache_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_cache_entry != NULL )
+	{
+		if( safe_cache_entry->security_descriptor != NULL )
+		{
+			libfwnt_security_descriptor_free(
+			 &( safe_cache_entry->security_descriptor ),
+			 NULL );
+		}
+		if( safe_cache_entry->data != NULL )
+		{
+			libfwnt_allocator_free(
+			 safe_cache_entry->data );
+		}
+		libfwnt_allocator_free(
+		 safe_cache_entry );
+	}
+	return( -1 );
+}
+
+/* Frees a security descriptor cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_entry_free(
+     libfwnt_security_descriptor_cache_entry_t **cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_descriptor_cache_entry_free";
+	int result            = 1;
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_entry != NULL )
+	{
+		if( ( *cache_entry )->security_descriptor != NULL )
+		{
+			( (libfwnt_internal_security_descriptor_t *) ( *cache_entry )->security_descriptor )->cache_entry = NULL;
+
+			if( libfwnt_security_descriptor_free(
+			     &( ( *cache_entry )->security_descriptor ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free security descriptor.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *cache_entry )->data != NULL )
+		{
+			libfwnt_allocator_free(
+			 ( *cache_entry )->data );
+		}
+		libfwnt_allocator_free(
+		 *cache_entry );
+
+		*cache_entry = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the 64-bit hash of security descriptor data
+ * Returns the hash
+ */
+uint64_t libfwnt_security_descriptor_cache_calculate_hash(
+          const uint8_t *byte_stream,
+          size_t byte_stream_size )
+{
+	size_t byte_stream_offset = 0;
+	uint64_t hash             = 0;
+	uint64_t value_64bit      = 0;
+	uint8_t byte_index        = 0;
+
+	hash = (uint64_t) 0xcbf29ce484222325UL ^ ( (uint64_t) byte_stream_size * (uint64_t) 0xc6a4a7935bd1e995UL );
+
+	/* Mix in the data 8 bytes at a time
+	 */
+	while( ( byte_stream_offset + 8 ) <= byte_stream_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ byte_stream_offset ] ),
+		 value_64bit );
+
+		value_64bit *= (uint64_t) 0xc6a4a7935bd1e995UL;
+		value_64bit ^= value_64bit >> 47;
+		value_64bit *= (uint64_t) 0xc6a4a7935bd1e995UL;
+
+		hash ^= value_64bit;
+		hash *= (uint64_t) 0xc6a4a7935bd1e995UL;
+
+		byte_stream_offset += 8;
+	}
+	if( byte_stream_offset < byte_stream_size )
+	{
+		value_64bit = 0;
+
+		for( byte_index = 0;
+		     byte_stream_offset < byte_stream_size;
+		     byte_index++ )
+		{
+			value_64bit |= (uint64_t) byte_stream[ byte_stream_offset++ ] << ( 8 * byte_index );
+		}
+		hash ^= value_64bit;
+		hash *= (uint64_t) 0xc6a4a7935bd1e995UL;
+	}
+	/* Finalize the hash so that all bits are avalanched
+	 */
+	hash ^= hash >> 33;
+	hash *= (uint64_t) 0xff51afd7ed558ccdUL;
+	hash ^= hash >> 33;
+	hash *= (uint64_t) 0xc4ceb9fe1a85ec53UL;
+	hash ^= hash >> 33;
+
+	return( hash );
+}
+
+/* Finds the cache entry that contains specific security descriptor data
+ * Returns the cache entry or NULL if not available
+ */
+libfwnt_security_descriptor_cache_entry_t *libfwnt_internal_security_descriptor_cache_find_entry(
+                                            libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache,
+                                            const uint8_t *byte_stream,
+                                            size_t byte_stream_size,
+                                            uint64_t hash )
+{
+	libfwnt_security_descriptor_cache_entry_t *cache_entry = NULL;
+
+	cache_entry = internal_security_descriptor_cache->buckets[ hash & ( internal_security_descriptor_cache->number_of_buckets - 1 ) ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->hash == hash )
+		 && ( cache_entry->data_size == byte_stream_size )
+		 && ( memory_compare(
+		       cache_entry->data,
+		       byte_stream,
+		       byte_stream_size ) == 0 ) )
+		{
+			break;
+		}
+		cache_entry = cache_entry->next_bucket_entry;
+	}
+	return( cache_entry );
+}
+
+/* Inserts a cache entry into the hash buckets and as the most recently inserted entry
+ */
+void libfwnt_internal_security_descriptor_cache_insert_entry(
+      libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry )
+{
+	size_t bucket_index = 0;
+
+	bucket_index = (size_t) ( cache_entry->hash & ( internal_security_descriptor_cache->number_of_buckets - 1 ) );
+
+	cache_entry->next_bucket_entry                              = internal_security_descriptor_cache->buckets[ bucket_index ];
+	internal_security_descriptor_cache->buckets[ bucket_index ] = cache_entry;
+
+	libfwnt_internal_security_descriptor_cache_prepend_entry(
+	 &( internal_security_descriptor_cache->first_entry ),
+	 &( internal_security_descriptor_cache->last_entry ),
+	 cache_entry );
+
+	cache_entry->cache     = internal_security_descriptor_cache;
+	cache_entry->is_cached = 1;
+
+	internal_security_descriptor_cache->number_of_entries += 1;
+}
+
+/* Evicts an entry from the cache
+ * Entries that were retrieved since the eviction last passed them are moved
+ * to the front instead, which approximates least recently used eviction
+ * without changing the eviction order on every retrieval
+ * The cache must contain at least one entry
+ * Returns the evicted entry
+ */
+libfwnt_security_descriptor_cache_entry_t *libfwnt_internal_security_descriptor_cache_evict_entry(
+                                            libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache )
+{
+	libfwnt_security_descriptor_cache_entry_t *cache_entry = NULL;
+
+	cache_entry = internal_security_descriptor_cache->last_entry;
+
+	/* This ends after one pass over the entries at most
+	 */
+	while( libfwnt_atomic_get(
+	        &( cache_entry->is_referenced ) ) != 0 )
+	{
+		libfwnt_atomic_set(
+		 &( cache_entry->is_referenced ),
+		 0 );
+
+		libfwnt_internal_security_descriptor_cache_unlink_entry(
+		 &( internal_security_descriptor_cache->first_entry ),
+		 &( internal_security_descriptor_cache->last_entry ),
+		 cache_entry );
+
+		libfwnt_internal_security_descriptor_cache_prepend_entry(
+		 &( internal_security_descriptor_cache->first_entry ),
+		 &( internal_security_descriptor_cache->last_entry ),
+		 cache_entry );
+
+		cache_entry = internal_security_descriptor_cache->last_entry;
+	}
+	libfwnt_internal_security_descriptor_cache_remove_entry(
+	 internal_security_descriptor_cache,
+	 cache_entry );
+
+	return( cache_entry );
+}
+
+/* Removes a cache entry from the hash buckets and the eviction order
+ */
+void libfwnt_internal_security_descriptor_cache_remove_entry(
+      libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry )
+{
+	libfwnt_security_descriptor_cache_entry_t **bucket_entry = NULL;
+
+	bucket_entry = &( internal_security_descriptor_cache->buckets[ cache_entry->hash & ( internal_security_descriptor_cache->number_of_buckets - 1 ) ] );
+
+	while( *bucket_entry != NULL )
+	{
+		if( *bucket_entry == cache_entry )
+		{
+			*bucket_entry = cache_entry->next_bucket_entry;
+
+			break;
+		}
+		bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+	}
+	cache_entry->next_bucket_entry = NULL;
+
+	libfwnt_internal_security_descriptor_cache_unlink_entry(
+	 &( internal_security_descriptor_cache->first_entry ),
+	 &( internal_security_descriptor_cache->last_entry ),
+	 cache_entry );
+
+	cache_entry->is_cached = 0;
+
+	internal_security_descriptor_cache->number_of_entries -= 1;
+}
+
+/* Unlinks a cache entry from a doubly linked list
+ */
+void libfwnt_internal_security_descriptor_cache_unlink_entry(
+      libfwnt_security_descriptor_cache_entry_t **first_entry,
+      libfwnt_security_descriptor_cache_entry_t **last_entry,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry )
+{
+	if( cache_entry->previous_entry != NULL )
+	{
+		cache_entry->previous_entry->next_entry = cache_entry->next_entry;
+	}
+	else
+	{
+		*first_entry = cache_entry->next_entry;
+	}
+	if( cache_entry->next_entry != NULL )
+	{
+		cache_entry->next_entry->previous_entry = cache_entry->previous_entry;
+	}
+	else
+	{
+		*last_entry = cache_entry->previous_entry;
+	}
+	cache_entry->previous_entry = NULL;
+	cache_entry->next_entry     = NULL;
+}
+
+/* Prepends a cache entry to a doubly linked list
+ */
+void libfwnt_internal_security_descriptor_cache_prepend_entry(
+      libfwnt_security_descriptor_cache_entry_t **first_entry,
+      libfwnt_security_descriptor_cache_entry_t **last_entry,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry )
+{
+	cache_entry->previous_entry = NULL;
+	cache_entry->next_entry     = *first_entry;
+
+	if( *first_entry != NULL )
+	{
+		( *first_entry )->previous_entry = cache_entry;
+	}
+	else
+	{
+		*last_entry = cache_entry;
+	}
+	*first_entry = cache_entry;
+}
+
+/* Retrieves the security descriptor of specific security descriptor data
+ * Identical data returns the same shared security descriptor, which must not be
+ * modified or freed and must be released using
+ * libfwnt_security_descriptor_cache_release_security_descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_security_descriptor(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry                           = NULL;
+	libfwnt_security_descriptor_cache_entry_t *evicted_entry                         = NULL;
+	libfwnt_security_descriptor_cache_entry_t *new_cache_entry                       = NULL;
+	static char *function                                                            = "libfwnt_security_descriptor_cache_get_security_descriptor";
+	uint64_t hash                                                                    = 0;
+	int result                                                                       = 1;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream_size == 0 )
+	 || ( byte_stream_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid byte stream size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfwnt_security_descriptor_cache_calculate_hash(
+	        byte_stream,
+	        byte_stream_size );
+
+	/* Entries are only inserted and evicted while holding the lock for writing,
+	 * hence a retrieval only needs the lock for reading
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_entry = libfwnt_internal_security_descriptor_cache_find_entry(
+	               internal_security_descriptor_cache,
+	               byte_stream,
+	               byte_stream_size,
+	               hash );
+
+	if( cache_entry != NULL )
+	{
+		libfwnt_atomic_increment(
+		 &( cache_entry->reference_count ) );
+
+		/* Only write the value when it changes to prevent contention on the entry
+		 */
+		if( libfwnt_atomic_get(
+		     &( cache_entry->is_referenced ) ) == 0 )
+		{
+			libfwnt_atomic_set(
+			 &( cache_entry->is_referenced ),
+			 1 );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( cache_entry != NULL )
+	{
+		*security_descriptor = cache_entry->security_descriptor;
+
+		return( 1 );
+	}
+	/* Parse the security descriptor without holding the lock
+	 */
+	if( libfwnt_security_descriptor_cache_entry_initialize(
+	     &new_cache_entry,
+	     byte_stream,
+	     byte_stream_size,
+	     hash,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libfwnt_security_descriptor_cache_entry_free(
+		 &new_cache_entry,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have added the same data in the mean time
+	 */
+	cache_entry = libfwnt_internal_security_descriptor_cache_find_entry(
+	               internal_security_descriptor_cache,
+	               byte_stream,
+	               byte_stream_size,
+	               hash );
+
+	if( cache_entry == NULL )
+	{
+		if( internal_security_descriptor_cache->number_of_entries >= internal_security_descriptor_cache->maximum_number_of_entries )
+		{
+			evicted_entry = libfwnt_internal_security_descriptor_cache_evict_entry(
+			                 internal_security_descriptor_cache );
+
+			/* An evicted entry that is still referenced is freed on its last release
+			 */
+			if( libfwnt_atomic_get(
+			     &( evicted_entry->reference_count ) ) > 0 )
+			{
+				libfwnt_internal_security_descriptor_cache_prepend_entry(
+				 &( internal_security_descriptor_cache->first_evicted_entry ),
+				 &( internal_security_descriptor_cache->last_evicted_entry ),
+				 evicted_entry );
+
+				evicted_entry = NULL;
+			}
+		}
+		libfwnt_internal_security_descriptor_cache_insert_entry(
+		 internal_security_descriptor_cache,
+		 new_cache_entry );
+
+		cache_entry     = new_cache_entry;
+		new_cache_entry = NULL;
+	}
+	else
+	{
+		libfwnt_atomic_set(
+		 &( cache_entry->is_referenced ),
+		 1 );
+	}
+	libfwnt_atomic_increment(
+	 &( cache_entry->reference_count ) );
+
+	*security_descriptor = cache_entry->security_descriptor;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( new_cache_entry != NULL )
+	{
+		if( libfwnt_security_descriptor_cache_entry_free(
+		     &new_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cache entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( evicted_entry != NULL )
+	{
+		if( libfwnt_security_descriptor_cache_entry_free(
+		     &evicted_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free evicted cache entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Releases a security descriptor retrieved from the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_release_security_descriptor(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry                           = NULL;
+	static char *function                                                            = "libfwnt_security_descriptor_cache_release_security_descriptor";
+	int32_t reference_count                                                          = 0;
+	int result                                                                       = 1;
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( ( security_descriptor == NULL )
+	 || ( *security_descriptor == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	cache_entry = (libfwnt_security_descriptor_cache_entry_t *) ( (libfwnt_internal_security_descriptor_t *) *security_descriptor )->cache_entry;
+
+	if( ( cache_entry == NULL )
+	 || ( cache_entry->cache != internal_security_descriptor_cache ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor - not shared by cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lock for reading prevents the entry from being evicted while
+	 * the reference count is decremented
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	reference_count = libfwnt_atomic_decrement(
+	                   &( cache_entry->reference_count ) );
+
+	if( reference_count < 0 )
+	{
+		libfwnt_atomic_increment(
+		 &( cache_entry->reference_count ) );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid cache entry - reference count value out of bounds.",
+		 function );
+
+		result      = -1;
+		cache_entry = NULL;
+	}
+	/* An evicted entry can no longer be retrieved, hence the last release frees it
+	 */
+	else if( ( reference_count > 0 )
+	      || ( cache_entry->is_cached != 0 ) )
+	{
+		cache_entry = NULL;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( cache_entry != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_security_descriptor_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		libfwnt_internal_security_descriptor_cache_unlink_entry(
+		 &( internal_security_descriptor_cache->first_evicted_entry ),
+		 &( internal_security_descriptor_cache->last_evicted_entry ),
+		 cache_entry );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_security_descriptor_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			result = -1;
+		}
+#endif
+	}
+	if( result == 1 )
+	{
+		*security_descriptor = NULL;
+	}
+	if( cache_entry != NULL )
+	{
+		if( libfwnt_security_descriptor_cache_entry_free(
+		     &cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free evicted cache entry.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of entries stored in the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_cache_get_number_of_entries(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache = NULL;
+	static char *function                                                            = "libfwnt_security_descriptor_cache_get_number_of_entries";
+
+	if( security_descriptor_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_entries = internal_security_descriptor_cache->number_of_entries;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_descriptor_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
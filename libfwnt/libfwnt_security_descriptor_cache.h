@@ -0,0 +1,214 @@
+/*
+ * Windows NT Security Descriptor cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_SECURITY_DESCRIPTOR_CACHE_H )
+#define _LIBFWNT_INTERNAL_SECURITY_DESCRIPTOR_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_atomic.h"
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A security descriptor cache shares a single immutable security descriptor
+ * between all callers that provide identical security descriptor data
+ */
+
+typedef struct libfwnt_internal_security_descriptor_cache libfwnt_internal_security_descriptor_cache_t;
+
+typedef struct libfwnt_security_descriptor_cache_entry libfwnt_security_descriptor_cache_entry_t;
+
+struct libfwnt_security_descriptor_cache_entry
+{
+	/* The cache
+	 */
+	libfwnt_internal_security_descriptor_cache_t *cache;
+
+	/* The hash of the data
+	 */
+	uint64_t hash;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The security descriptor
+	 */
+	libfwnt_security_descriptor_t *security_descriptor;
+
+	/* The reference count
+	 */
+	libfwnt_atomic_int32_t reference_count;
+
+	/* Value to indicate the entry was retrieved since the eviction last passed it
+	 */
+	libfwnt_atomic_int32_t is_referenced;
+
+	/* Value to indicate the entry is stored in the cache
+	 */
+	uint8_t is_cached;
+
+	/* The next entry in the same hash bucket
+	 */
+	libfwnt_security_descriptor_cache_entry_t *next_bucket_entry;
+
+	/* The previous entry in the eviction order or evicted list
+	 */
+	libfwnt_security_descriptor_cache_entry_t *previous_entry;
+
+	/* The next entry in the eviction order or evicted list
+	 */
+	libfwnt_security_descriptor_cache_entry_t *next_entry;
+};
+
+struct libfwnt_internal_security_descriptor_cache
+{
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The hash buckets
+	 */
+	libfwnt_security_descriptor_cache_entry_t **buckets;
+
+	/* The number of hash buckets, this is a power of 2
+	 */
+	size_t number_of_buckets;
+
+	/* The most recently inserted entry
+	 */
+	libfwnt_security_descriptor_cache_entry_t *first_entry;
+
+	/* The next entry to consider for eviction
+	 */
+	libfwnt_security_descriptor_cache_entry_t *last_entry;
+
+	/* The first evicted entry that is still referenced
+	 */
+	libfwnt_security_descriptor_cache_entry_t *first_evicted_entry;
+
+	/* The last evicted entry that is still referenced
+	 */
+	libfwnt_security_descriptor_cache_entry_t *last_evicted_entry;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_initialize(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_free(
+     libfwnt_security_descriptor_cache_t **security_descriptor_cache,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_cache_entry_initialize(
+     libfwnt_security_descriptor_cache_entry_t **cache_entry,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint64_t hash,
+     int byte_order,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_cache_entry_free(
+     libfwnt_security_descriptor_cache_entry_t **cache_entry,
+     libcerror_error_t **error );
+
+uint64_t libfwnt_security_descriptor_cache_calculate_hash(
+          const uint8_t *byte_stream,
+          size_t byte_stream_size );
+
+libfwnt_security_descriptor_cache_entry_t *libfwnt_internal_security_descriptor_cache_find_entry(
+                                            libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache,
+                                            const uint8_t *byte_stream,
+                                            size_t byte_stream_size,
+                                            uint64_t hash );
+
+void libfwnt_internal_security_descriptor_cache_insert_entry(
+      libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry );
+
+libfwnt_security_descriptor_cache_entry_t *libfwnt_internal_security_descriptor_cache_evict_entry(
+                                            libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache );
+
+void libfwnt_internal_security_descriptor_cache_remove_entry(
+      libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry );
+
+void libfwnt_internal_security_descriptor_cache_unlink_entry(
+      libfwnt_security_descriptor_cache_entry_t **first_entry,
+      libfwnt_security_descriptor_cache_entry_t **last_entry,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry );
+
+void libfwnt_internal_security_descriptor_cache_prepend_entry(
+      libfwnt_security_descriptor_cache_entry_t **first_entry,
+      libfwnt_security_descriptor_cache_entry_t **last_entry,
+      libfwnt_security_descriptor_cache_entry_t *cache_entry );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_security_descriptor(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_release_security_descriptor(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     libfwnt_security_descriptor_t **security_descriptor,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_cache_get_number_of_entries(
+     libfwnt_security_descriptor_cache_t *security_descriptor_cache,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_SECURITY_DESCRIPTOR_CACHE_H ) */
+
@@ -0,0 +1,1746 @@
+/*
+ * Windows NT Security Descriptor view functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_access_control_entry.h"
+#include "libfwnt_allocator.h"
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_descriptor_view.h"
+#include "libfwnt_types.h"
+
+/* Creates a security descriptor view
+ * Make sure the value security_descriptor_view is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_initialize(
+     libfwnt_security_descriptor_view_t **security_descriptor_view,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_initialize";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security descriptor view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = libfwnt_allocator_allocate_structure(
+	                                     libfwnt_internal_security_descriptor_view_t );
+
+	if( internal_security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security descriptor view.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_security_descriptor_view,
+	     0,
+	     sizeof( libfwnt_internal_security_descriptor_view_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security descriptor view.",
+		 function );
+
+		goto on_error;
+	}
+	*security_descriptor_view = (libfwnt_security_descriptor_view_t *) internal_security_descriptor_view;
+
+	return( 1 );
+
+on_error:
+	if( internal_security_descriptor_view != NULL )
+	{
+		libfwnt_allocator_free(
+		 internal_security_descriptor_view );
+	}
+	return( -1 );
+}
+
+/* Frees a security descriptor view
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_free(
+     libfwnt_security_descriptor_view_t **security_descriptor_view,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_free";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_descriptor_view != NULL )
+	{
+		internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) *security_descriptor_view;
+		*security_descriptor_view         = NULL;
+
+		if( internal_security_descriptor_view->entries != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_security_descriptor_view->entries );
+		}
+		libfwnt_allocator_free(
+		 internal_security_descriptor_view );
+	}
+	return( 1 );
+}
+
+/* Determines the size of a security identifier (SID) stored in a byte stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_security_identifier_size(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint16_t *security_identifier_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfwnt_security_descriptor_view_get_security_identifier_size";
+	uint8_t number_of_sub_authorities = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_identifier_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier size.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sub_authorities = byte_stream[ 1 ];
+
+	if( number_of_sub_authorities > 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+		 function );
+
+		return( -1 );
+	}
+	*security_identifier_size = 8 + ( (uint16_t) number_of_sub_authorities * 4 );
+
+	if( (size_t) *security_identifier_size > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads an access control list (ACL) of the security descriptor view
+ * The entries are appended to the entries array of the view
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_read_access_control_list(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     uint32_t access_control_list_offset,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_layout_t layout;
+
+	libfwnt_access_control_entry_view_values_t *entry_values = NULL;
+	void *reallocation                                       = NULL;
+	static char *function                                    = "libfwnt_security_descriptor_view_read_access_control_list";
+	size_t application_data_offset                           = 0;
+	size_t byte_stream_offset                                = 0;
+	size_t byte_stream_size                                  = 0;
+	size_t sid_offset                                        = 0;
+	uint16_t entry_index                                     = 0;
+	uint16_t number_of_entries                               = 0;
+	int number_of_allocated_entries                          = 0;
+
+	if( internal_security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list values.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_size = internal_security_descriptor_view->byte_stream_size;
+
+	if( ( access_control_list_offset < 20 )
+	 || ( (size_t) access_control_list_offset > byte_stream_size )
+	 || ( ( byte_stream_size - access_control_list_offset ) < 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: access control list offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_offset = (size_t) access_control_list_offset;
+
+	access_control_list_values->offset          = access_control_list_offset;
+	access_control_list_values->revision_number = internal_security_descriptor_view->byte_stream[ byte_stream_offset ];
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( internal_security_descriptor_view->byte_stream[ byte_stream_offset + 2 ] ),
+	 access_control_list_values->size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( internal_security_descriptor_view->byte_stream[ byte_stream_offset + 4 ] ),
+	 number_of_entries );
+
+	byte_stream_offset += 8;
+
+	/* Every access control entry consists of at least a 4-byte header
+	 */
+	if( (size_t) number_of_entries > ( ( byte_stream_size - byte_stream_offset ) / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_allocated_entries = internal_security_descriptor_view->number_of_entries + (int) number_of_entries;
+
+	/* The entries array is retained between descriptors and only grows when needed
+	 */
+	if( number_of_allocated_entries > internal_security_descriptor_view->number_of_allocated_entries )
+	{
+		reallocation = libfwnt_allocator_reallocate(
+		                internal_security_descriptor_view->entries,
+		                sizeof( libfwnt_access_control_entry_view_values_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_security_descriptor_view->entries                     = (libfwnt_access_control_entry_view_values_t *) reallocation;
+		internal_security_descriptor_view->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	access_control_list_values->first_entry_index = internal_security_descriptor_view->number_of_entries;
+	access_control_list_values->number_of_entries = 0;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry_values = &( internal_security_descriptor_view->entries[ internal_security_descriptor_view->number_of_entries ] );
+
+		if( ( byte_stream_size - byte_stream_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %" PRIu16 " offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entry_values->type                         = internal_security_descriptor_view->byte_stream[ byte_stream_offset ];
+		entry_values->flags                        = internal_security_descriptor_view->byte_stream[ byte_stream_offset + 1 ];
+		entry_values->access_mask                  = 0;
+		entry_values->object_flags                 = 0;
+		entry_values->object_type_offset           = 0;
+		entry_values->inherited_object_type_offset = 0;
+		entry_values->security_identifier_offset   = 0;
+		entry_values->security_identifier_size     = 0;
+		entry_values->application_data_offset      = 0;
+		entry_values->application_data_size        = 0;
+
+		byte_stream_copy_to_uint16_little_endian(
+		 &( internal_security_descriptor_view->byte_stream[ byte_stream_offset + 2 ] ),
+		 entry_values->size );
+
+		if( ( entry_values->size < 4 )
+		 || ( (size_t) entry_values->size > ( byte_stream_size - byte_stream_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: access control entry: %" PRIu16 " size value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( libfwnt_access_control_entry_get_layout(
+		     &( internal_security_descriptor_view->byte_stream[ byte_stream_offset ] ),
+		     (size_t) entry_values->size,
+		     &layout,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine access control entry: %" PRIu16 " layout.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( layout.access_mask_offset > 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( internal_security_descriptor_view->byte_stream[ byte_stream_offset + layout.access_mask_offset ] ),
+			 entry_values->access_mask );
+		}
+		entry_values->object_flags = layout.object_flags;
+
+		if( layout.object_type_offset > 0 )
+		{
+			entry_values->object_type_offset = (uint32_t) ( byte_stream_offset + layout.object_type_offset );
+		}
+		if( layout.inherited_object_type_offset > 0 )
+		{
+			entry_values->inherited_object_type_offset = (uint32_t) ( byte_stream_offset + layout.inherited_object_type_offset );
+		}
+		sid_offset = layout.security_identifier_offset;
+
+		if( sid_offset > 0 )
+		{
+			/* The security identifier is stored within the entry
+			 */
+			if( libfwnt_security_descriptor_view_get_security_identifier_size(
+			     &( internal_security_descriptor_view->byte_stream[ byte_stream_offset + sid_offset ] ),
+			     (size_t) entry_values->size - sid_offset,
+			     &( entry_values->security_identifier_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine access control entry: %" PRIu16 " security identifier size.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			entry_values->security_identifier_offset = (uint32_t) ( byte_stream_offset + sid_offset );
+
+			application_data_offset = sid_offset + entry_values->security_identifier_size;
+
+			if( ( layout.has_application_data != 0 )
+			 && ( application_data_offset < (size_t) entry_values->size ) )
+			{
+				entry_values->application_data_offset = (uint32_t) ( byte_stream_offset + application_data_offset );
+				entry_values->application_data_size   = (uint16_t) ( entry_values->size - application_data_offset );
+			}
+		}
+		byte_stream_offset += entry_values->size;
+
+		internal_security_descriptor_view->number_of_entries += 1;
+		access_control_list_values->number_of_entries        += 1;
+	}
+	return( 1 );
+}
+
+/* Sets the data of the security descriptor view
+ * The structure of the security descriptor is validated once, the view references
+ * the byte stream directly and the byte stream must remain valid and unchanged
+ * while the view is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_set_data(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_set_data";
+	uint32_t discretionary_acl_offset                                              = 0;
+	uint32_t system_acl_offset                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 20 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view->byte_stream       = byte_stream;
+	internal_security_descriptor_view->byte_stream_size  = byte_stream_size;
+	internal_security_descriptor_view->owner_sid_size    = 0;
+	internal_security_descriptor_view->group_sid_size    = 0;
+	internal_security_descriptor_view->number_of_entries = 0;
+
+	internal_security_descriptor_view->system_acl.offset            = 0;
+	internal_security_descriptor_view->system_acl.number_of_entries = 0;
+
+	internal_security_descriptor_view->discretionary_acl.offset            = 0;
+	internal_security_descriptor_view->discretionary_acl.number_of_entries = 0;
+
+	internal_security_descriptor_view->revision_number = byte_stream[ 0 ];
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( byte_stream[ 2 ] ),
+	 internal_security_descriptor_view->control_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 4 ] ),
+	 internal_security_descriptor_view->owner_sid_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 8 ] ),
+	 internal_security_descriptor_view->group_sid_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 12 ] ),
+	 system_acl_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( byte_stream[ 16 ] ),
+	 discretionary_acl_offset );
+
+	/* An access control list offset is ignored if the corresponding present flag is not set
+	 */
+	if( ( internal_security_descriptor_view->control_flags & LIBFWNT_CONTROL_FLAG_SACL_PRESENT ) == 0 )
+	{
+		system_acl_offset = 0;
+	}
+	if( ( internal_security_descriptor_view->control_flags & LIBFWNT_CONTROL_FLAG_DACL_PRESENT ) == 0 )
+	{
+		discretionary_acl_offset = 0;
+	}
+	if( internal_security_descriptor_view->owner_sid_offset != 0 )
+	{
+		if( ( internal_security_descriptor_view->owner_sid_offset < 20 )
+		 || ( (size_t) internal_security_descriptor_view->owner_sid_offset > byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: owner SID offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwnt_security_descriptor_view_get_security_identifier_size(
+		     &( byte_stream[ internal_security_descriptor_view->owner_sid_offset ] ),
+		     byte_stream_size - internal_security_descriptor_view->owner_sid_offset,
+		     &( internal_security_descriptor_view->owner_sid_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine owner SID size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_security_descriptor_view->group_sid_offset != 0 )
+	{
+		if( ( internal_security_descriptor_view->group_sid_offset < 20 )
+		 || ( (size_t) internal_security_descriptor_view->group_sid_offset > byte_stream_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: group SID offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwnt_security_descriptor_view_get_security_identifier_size(
+		     &( byte_stream[ internal_security_descriptor_view->group_sid_offset ] ),
+		     byte_stream_size - internal_security_descriptor_view->group_sid_offset,
+		     &( internal_security_descriptor_view->group_sid_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine group SID size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( system_acl_offset != 0 )
+	{
+		if( libfwnt_security_descriptor_view_read_access_control_list(
+		     internal_security_descriptor_view,
+		     &( internal_security_descriptor_view->system_acl ),
+		     system_acl_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read system ACL.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( discretionary_acl_offset != 0 )
+	{
+		if( libfwnt_security_descriptor_view_read_access_control_list(
+		     internal_security_descriptor_view,
+		     &( internal_security_descriptor_view->discretionary_acl ),
+		     discretionary_acl_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read discretionary ACL.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	internal_security_descriptor_view->byte_stream       = NULL;
+	internal_security_descriptor_view->byte_stream_size  = 0;
+	internal_security_descriptor_view->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the control flags
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_control_flags(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint16_t *control_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_control_flags";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( control_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid control flags.",
+		 function );
+
+		return( -1 );
+	}
+	*control_flags = internal_security_descriptor_view->control_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the owner security identifier (SID) data
+ * The SID data references the byte stream of the view
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_owner(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_owner";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->owner_sid_offset == 0 )
+	{
+		return( 0 );
+	}
+	*sid_data      = &( internal_security_descriptor_view->byte_stream[ internal_security_descriptor_view->owner_sid_offset ] );
+	*sid_data_size = (size_t) internal_security_descriptor_view->owner_sid_size;
+
+	return( 1 );
+}
+
+/* Retrieves the group security identifier (SID) data
+ * The SID data references the byte stream of the view
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_group(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_group";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->group_sid_offset == 0 )
+	{
+		return( 0 );
+	}
+	*sid_data      = &( internal_security_descriptor_view->byte_stream[ internal_security_descriptor_view->group_sid_offset ] );
+	*sid_data_size = (size_t) internal_security_descriptor_view->group_sid_size;
+
+	return( 1 );
+}
+
+/* Retrieves the header values of an access control list (ACL)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_internal_security_descriptor_view_get_access_control_list(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     uint8_t *revision_number,
+     uint16_t *size,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_descriptor_view_get_access_control_list";
+
+	if( internal_security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list values.",
+		 function );
+
+		return( -1 );
+	}
+	if( revision_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid revision number.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_values->offset == 0 )
+	{
+		return( 0 );
+	}
+	*revision_number   = access_control_list_values->revision_number;
+	*size              = access_control_list_values->size;
+	*number_of_entries = access_control_list_values->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the values of a specific access control entry (ACE) of an access control list (ACL)
+ * The SID data references the byte stream of the view, if the entry does not contain
+ * a security identifier (SID) the SID data is set to NULL and the SID data size to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_descriptor_view_get_access_control_entry(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     int entry_index,
+     uint8_t *type,
+     uint8_t *flags,
+     uint32_t *access_mask,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_view_values_t *entry_values = NULL;
+	static char *function                                    = "libfwnt_internal_security_descriptor_view_get_access_control_entry";
+
+	if( internal_security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= access_control_list_values->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( sid_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid SID data size.",
+		 function );
+
+		return( -1 );
+	}
+	entry_values = &( internal_security_descriptor_view->entries[ access_control_list_values->first_entry_index + entry_index ] );
+
+	*type        = entry_values->type;
+	*flags       = entry_values->flags;
+	*access_mask = entry_values->access_mask;
+
+	if( entry_values->security_identifier_offset == 0 )
+	{
+		*sid_data      = NULL;
+		*sid_data_size = 0;
+	}
+	else
+	{
+		*sid_data      = &( internal_security_descriptor_view->byte_stream[ entry_values->security_identifier_offset ] );
+		*sid_data_size = (size_t) entry_values->security_identifier_size;
+	}
+	return( 1 );
+}
+
+/* Retrieves the object values of a specific access control entry (ACE) of an access control list (ACL)
+ * The object type data and inherited object type data reference the byte stream of the view
+ * and are set to NULL if the corresponding GUID is not present
+ * Returns 1 if successful, 0 if the entry is not an object entry or -1 on error
+ */
+int libfwnt_internal_security_descriptor_view_get_access_control_entry_object_types(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     int entry_index,
+     uint32_t *object_flags,
+     const uint8_t **object_type_data,
+     const uint8_t **inherited_object_type_data,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_view_values_t *entry_values = NULL;
+	static char *function                                    = "libfwnt_internal_security_descriptor_view_get_access_control_entry_object_types";
+
+	if( internal_security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= access_control_list_values->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_type_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object type data.",
+		 function );
+
+		return( -1 );
+	}
+	if( inherited_object_type_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inherited object type data.",
+		 function );
+
+		return( -1 );
+	}
+	entry_values = &( internal_security_descriptor_view->entries[ access_control_list_values->first_entry_index + entry_index ] );
+
+	switch( entry_values->type )
+	{
+		case LIBFWNT_ACCESS_ALLOWED_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_OBJECT:
+		case LIBFWNT_ACCESS_ALLOWED_CALLBACK_OBJECT:
+		case LIBFWNT_ACCESS_DENIED_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_AUDIT_CALLBACK_OBJECT:
+		case LIBFWNT_SYSTEM_ALARM_CALLBACK_OBJECT:
+			break;
+
+		default:
+			return( 0 );
+	}
+	*object_flags = entry_values->object_flags;
+
+	if( entry_values->object_type_offset == 0 )
+	{
+		*object_type_data = NULL;
+	}
+	else
+	{
+		*object_type_data = &( internal_security_descriptor_view->byte_stream[ entry_values->object_type_offset ] );
+	}
+	if( entry_values->inherited_object_type_offset == 0 )
+	{
+		*inherited_object_type_data = NULL;
+	}
+	else
+	{
+		*inherited_object_type_data = &( internal_security_descriptor_view->byte_stream[ entry_values->inherited_object_type_offset ] );
+	}
+	return( 1 );
+}
+
+/* Retrieves the application data of a specific access control entry (ACE) of an access control list (ACL)
+ * The data references the byte stream of the view
+ * Returns 1 if successful, 0 if the entry does not contain application data or -1 on error
+ */
+int libfwnt_internal_security_descriptor_view_get_access_control_entry_application_data(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     int entry_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_access_control_entry_view_values_t *entry_values = NULL;
+	static char *function                                    = "libfwnt_internal_security_descriptor_view_get_access_control_entry_application_data";
+
+	if( internal_security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_descriptor_view->byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid security descriptor view - missing byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_control_list_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access control list values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= access_control_list_values->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	entry_values = &( internal_security_descriptor_view->entries[ access_control_list_values->first_entry_index + entry_index ] );
+
+	if( entry_values->application_data_offset == 0 )
+	{
+		return( 0 );
+	}
+	*data      = &( internal_security_descriptor_view->byte_stream[ entry_values->application_data_offset ] );
+	*data_size = (size_t) entry_values->application_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the discretionary access control list (ACL) header values
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_discretionary_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint8_t *revision_number,
+     uint16_t *size,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_discretionary_acl";
+	int result                                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	result = libfwnt_internal_security_descriptor_view_get_access_control_list(
+	          internal_security_descriptor_view,
+	          &( internal_security_descriptor_view->discretionary_acl ),
+	          revision_number,
+	          size,
+	          number_of_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve discretionary ACL.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the values of a specific access control entry (ACE) of the discretionary access control list (ACL)
+ * The SID data references the byte stream of the view
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint8_t *type,
+     uint8_t *flags,
+     uint32_t *access_mask,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_discretionary_acl_entry";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	if( libfwnt_internal_security_descriptor_view_get_access_control_entry(
+	     internal_security_descriptor_view,
+	     &( internal_security_descriptor_view->discretionary_acl ),
+	     entry_index,
+	     type,
+	     flags,
+	     access_mask,
+	     sid_data,
+	     sid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve discretionary ACL entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the object values of a specific access control entry (ACE) of the discretionary access control list (ACL)
+ * The object type data and inherited object type data reference the byte stream of the view
+ * Returns 1 if successful, 0 if the entry is not an object entry or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint32_t *object_flags,
+     const uint8_t **object_type_data,
+     const uint8_t **inherited_object_type_data,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types";
+	int result                                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	result = libfwnt_internal_security_descriptor_view_get_access_control_entry_object_types(
+	          internal_security_descriptor_view,
+	          &( internal_security_descriptor_view->discretionary_acl ),
+	          entry_index,
+	          object_flags,
+	          object_type_data,
+	          inherited_object_type_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve discretionary ACL entry: %d object values.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the application data of a specific access control entry (ACE) of the discretionary access control list (ACL)
+ * The data references the byte stream of the view
+ * Returns 1 if successful, 0 if the entry does not contain application data or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data";
+	int result                                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	result = libfwnt_internal_security_descriptor_view_get_access_control_entry_application_data(
+	          internal_security_descriptor_view,
+	          &( internal_security_descriptor_view->discretionary_acl ),
+	          entry_index,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve discretionary ACL entry: %d application data.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the system access control list (ACL) header values
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_system_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint8_t *revision_number,
+     uint16_t *size,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_system_acl";
+	int result                                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	result = libfwnt_internal_security_descriptor_view_get_access_control_list(
+	          internal_security_descriptor_view,
+	          &( internal_security_descriptor_view->system_acl ),
+	          revision_number,
+	          size,
+	          number_of_entries,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system ACL.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the values of a specific access control entry (ACE) of the system access control list (ACL)
+ * The SID data references the byte stream of the view
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_system_acl_entry(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint8_t *type,
+     uint8_t *flags,
+     uint32_t *access_mask,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_system_acl_entry";
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	if( libfwnt_internal_security_descriptor_view_get_access_control_entry(
+	     internal_security_descriptor_view,
+	     &( internal_security_descriptor_view->system_acl ),
+	     entry_index,
+	     type,
+	     flags,
+	     access_mask,
+	     sid_data,
+	     sid_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system ACL entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the object values of a specific access control entry (ACE) of the system access control list (ACL)
+ * The object type data and inherited object type data reference the byte stream of the view
+ * Returns 1 if successful, 0 if the entry is not an object entry or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_system_acl_entry_object_types(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint32_t *object_flags,
+     const uint8_t **object_type_data,
+     const uint8_t **inherited_object_type_data,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_system_acl_entry_object_types";
+	int result                                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	result = libfwnt_internal_security_descriptor_view_get_access_control_entry_object_types(
+	          internal_security_descriptor_view,
+	          &( internal_security_descriptor_view->system_acl ),
+	          entry_index,
+	          object_flags,
+	          object_type_data,
+	          inherited_object_type_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system ACL entry: %d object values.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the application data of a specific access control entry (ACE) of the system access control list (ACL)
+ * The data references the byte stream of the view
+ * Returns 1 if successful, 0 if the entry does not contain application data or -1 on error
+ */
+int libfwnt_security_descriptor_view_get_system_acl_entry_application_data(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view = NULL;
+	static char *function                                                          = "libfwnt_security_descriptor_view_get_system_acl_entry_application_data";
+	int result                                                                     = 0;
+
+	if( security_descriptor_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security descriptor view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_descriptor_view = (libfwnt_internal_security_descriptor_view_t *) security_descriptor_view;
+
+	result = libfwnt_internal_security_descriptor_view_get_access_control_entry_application_data(
+	          internal_security_descriptor_view,
+	          &( internal_security_descriptor_view->system_acl ),
+	          entry_index,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system ACL entry: %d application data.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
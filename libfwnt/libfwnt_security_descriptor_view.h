@@ -0,0 +1,339 @@
+/*
+ * Windows NT Security Descriptor view functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_SECURITY_DESCRIPTOR_VIEW_H )
+#define _LIBFWNT_INTERNAL_SECURITY_DESCRIPTOR_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A security descriptor view provides read-only access to a self-relative
+ * security descriptor stored in a byte stream without copying its values
+ */
+
+typedef struct libfwnt_access_control_entry_view_values libfwnt_access_control_entry_view_values_t;
+
+struct libfwnt_access_control_entry_view_values
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The flags
+	 */
+	uint8_t flags;
+
+	/* The size
+	 */
+	uint16_t size;
+
+	/* The access mask
+	 */
+	uint32_t access_mask;
+
+	/* The object flags
+	 */
+	uint32_t object_flags;
+
+	/* The object type offset relative to the start of the byte stream
+	 * 0 if the entry does not contain an object type
+	 */
+	uint32_t object_type_offset;
+
+	/* The inherited object type offset relative to the start of the byte stream
+	 * 0 if the entry does not contain an inherited object type
+	 */
+	uint32_t inherited_object_type_offset;
+
+	/* The security identifier (SID) offset relative to the start of the byte stream
+	 * 0 if the entry does not contain a security identifier
+	 */
+	uint32_t security_identifier_offset;
+
+	/* The security identifier (SID) size
+	 */
+	uint16_t security_identifier_size;
+
+	/* The application data offset relative to the start of the byte stream
+	 * 0 if the entry does not contain application data
+	 */
+	uint32_t application_data_offset;
+
+	/* The application data size
+	 */
+	uint16_t application_data_size;
+};
+
+typedef struct libfwnt_access_control_list_view_values libfwnt_access_control_list_view_values_t;
+
+struct libfwnt_access_control_list_view_values
+{
+	/* The offset relative to the start of the byte stream
+	 * 0 if the access control list is not present
+	 */
+	uint32_t offset;
+
+	/* The revision number
+	 */
+	uint8_t revision_number;
+
+	/* The size
+	 */
+	uint16_t size;
+
+	/* The index of the first entry in the entries array of the view
+	 */
+	int first_entry_index;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+typedef struct libfwnt_internal_security_descriptor_view libfwnt_internal_security_descriptor_view_t;
+
+struct libfwnt_internal_security_descriptor_view
+{
+	/* The byte stream
+	 */
+	const uint8_t *byte_stream;
+
+	/* The byte stream size
+	 */
+	size_t byte_stream_size;
+
+	/* The revision number
+	 */
+	uint8_t revision_number;
+
+	/* The control flags
+	 */
+	uint16_t control_flags;
+
+	/* The owner SID offset
+	 */
+	uint32_t owner_sid_offset;
+
+	/* The owner SID size
+	 */
+	uint16_t owner_sid_size;
+
+	/* The group SID offset
+	 */
+	uint32_t group_sid_offset;
+
+	/* The group SID size
+	 */
+	uint16_t group_sid_size;
+
+	/* The system ACL
+	 */
+	libfwnt_access_control_list_view_values_t system_acl;
+
+	/* The discretionary ACL
+	 */
+	libfwnt_access_control_list_view_values_t discretionary_acl;
+
+	/* The entries of both access control lists
+	 */
+	libfwnt_access_control_entry_view_values_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_initialize(
+     libfwnt_security_descriptor_view_t **security_descriptor_view,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_free(
+     libfwnt_security_descriptor_view_t **security_descriptor_view,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_view_get_security_identifier_size(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     uint16_t *security_identifier_size,
+     libcerror_error_t **error );
+
+int libfwnt_security_descriptor_view_read_access_control_list(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     uint32_t access_control_list_offset,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_set_data(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_control_flags(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint16_t *control_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_owner(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_group(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_view_get_access_control_list(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     uint8_t *revision_number,
+     uint16_t *size,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_view_get_access_control_entry(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     int entry_index,
+     uint8_t *type,
+     uint8_t *flags,
+     uint32_t *access_mask,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_view_get_access_control_entry_object_types(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     int entry_index,
+     uint32_t *object_flags,
+     const uint8_t **object_type_data,
+     const uint8_t **inherited_object_type_data,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_descriptor_view_get_access_control_entry_application_data(
+     libfwnt_internal_security_descriptor_view_t *internal_security_descriptor_view,
+     libfwnt_access_control_list_view_values_t *access_control_list_values,
+     int entry_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_discretionary_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint8_t *revision_number,
+     uint16_t *size,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint8_t *type,
+     uint8_t *flags,
+     uint32_t *access_mask,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint32_t *object_flags,
+     const uint8_t **object_type_data,
+     const uint8_t **inherited_object_type_data,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_system_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     uint8_t *revision_number,
+     uint16_t *size,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_system_acl_entry(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint8_t *type,
+     uint8_t *flags,
+     uint32_t *access_mask,
+     const uint8_t **sid_data,
+     size_t *sid_data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_system_acl_entry_object_types(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     uint32_t *object_flags,
+     const uint8_t **object_type_data,
+     const uint8_t **inherited_object_type_data,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_descriptor_view_get_system_acl_entry_application_data(
+     libfwnt_security_descriptor_view_t *security_descriptor_view,
+     int entry_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_SECURITY_DESCRIPTOR_VIEW_H ) */
+
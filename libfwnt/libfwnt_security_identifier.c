@@ -22,12 +22,15 @@
 #include <common.h>
 #include <byte_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#include "libfwnt_arena.h"
 #include "libfwnt_definitions.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_security_identifier.h"
 #include "libfwnt_types.h"
+#include "libfwnt_well_known_security_identifier.h"
 
 /* Creates a security identifier
  * Make sure the value security_identifier is referencing, is set to NULL
@@ -36,9 +39,25 @@
 int libfwnt_security_identifier_initialize(
      libfwnt_security_identifier_t **security_identifier,
      libcerror_error_t **error )
+{
+	return( libfwnt_security_identifier_initialize_with_arena(
+	         security_identifier,
+	         NULL,
+	         error ) );
+}
+
+/* Creates a security identifier
+ * Make sure the value security_identifier is referencing, is set to NULL
+ * If no arena is provided the security identifier is allocated using the allocator
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_initialize_with_arena(
+     libfwnt_security_identifier_t **security_identifier,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
-	static char *function                                                = "libfwnt_security_identifier_initialize";
+	static char *function                                                = "libfwnt_security_identifier_initialize_with_arena";
 
 	if( security_identifier == NULL )
 	{
@@ -62,7 +81,8 @@ int libfwnt_security_identifier_initialize(
 
 		return( -1 );
 	}
-	internal_security_identifier = memory_allocate_structure(
+	internal_security_identifier = libfwnt_arena_allocate_structure(
+	                                arena,
 	                                libfwnt_internal_security_identifier_t );
 
 	if( internal_security_identifier == NULL )
@@ -90,6 +110,8 @@ int libfwnt_security_identifier_initialize(
 
 		goto on_error;
 	}
+	internal_security_identifier->arena = arena;
+
 	*security_identifier = (libfwnt_security_identifier_t *) internal_security_identifier;
 
 	return( 1 );
@@ -97,7 +119,8 @@ int libfwnt_security_identifier_initialize(
 on_error:
 	if( internal_security_identifier != NULL )
 	{
-		memory_free(
+		libfwnt_arena_release(
+		 arena,
 		 internal_security_identifier );
 	}
 	return( -1 );
@@ -172,7 +195,14 @@ int libfwnt_internal_security_identifier_free(
 	}
 	if( *internal_security_identifier != NULL )
 	{
-		memory_free(
+		if( ( *internal_security_identifier )->utf8_string != NULL )
+		{
+			libfwnt_arena_release(
+			 ( *internal_security_identifier )->arena,
+			 ( *internal_security_identifier )->utf8_string );
+		}
+		libfwnt_arena_release(
+		 ( *internal_security_identifier )->arena,
 		 *internal_security_identifier );
 
 		*internal_security_identifier = NULL;
@@ -252,6 +282,10 @@ int libfwnt_security_identifier_copy_from_byte_stream(
 
 		return( -1 );
 	}
+	/* The cached UTF-8 string no longer matches the values
+	 */
+	internal_security_identifier->utf8_string_length = 0;
+
 	internal_security_identifier->revision_number           = byte_stream[ 0 ];
 	internal_security_identifier->number_of_sub_authorities = byte_stream[ 1 ];
 
@@ -302,21 +336,16 @@ int libfwnt_security_identifier_copy_from_byte_stream(
 	return( 1 );
 }
 
-/* Deterimes the size of the string for the security identifier
- * The string size includes the end of string character
+/* Retrieves the size of the security identifier as stored in a byte stream
  * Returns 1 if successful or -1 on error
  */
-int libfwnt_security_identifier_get_string_size(
+int libfwnt_security_identifier_get_data_size(
      libfwnt_security_identifier_t *security_identifier,
-     size_t *string_size,
-     uint32_t string_format_flags,
+     size_t *data_size,
      libcerror_error_t **error )
 {
 	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
-	static char *function                                                = "libfwnt_security_identifier_get_string_size";
-	size_t value_string_index                                            = 0;
-	uint64_t value_64bit                                                 = 0;
-	uint8_t sub_authority_index                                          = 0;
+	static char *function                                                = "libfwnt_security_identifier_get_data_size";
 
 	if( security_identifier == NULL )
 	{
@@ -331,127 +360,35 @@ int libfwnt_security_identifier_get_string_size(
 	}
 	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
 
-	if( string_size == NULL )
+	if( data_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid string size.",
-		 function );
-
-		return( -1 );
-	}
-	if( string_format_flags != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags.",
+		 "%s: invalid data size.",
 		 function );
 
 		return( -1 );
 	}
-	value_string_index = 2;
-
-	value_64bit = internal_security_identifier->revision_number;
-
-	do
-	{
-		value_string_index++;
-
-		value_64bit /= 10;
-	}
-	while( value_64bit > 0 );
-
-	value_string_index++;
-
-	value_64bit = internal_security_identifier->authority;
-
-	do
-	{
-		value_string_index++;
-
-		value_64bit /= 10;
-	}
-	while( value_64bit > 0 );
-
-	for( sub_authority_index = 0;
-	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
-	     sub_authority_index++ )
-	{
-		value_string_index++;
-
-		value_64bit = internal_security_identifier->sub_authority[ sub_authority_index ];
-
-		do
-		{
-			value_string_index++;
-
-			value_64bit /= 10;
-		}
-		while( value_64bit > 0 );
-	}
-	value_string_index++;
-
-	*string_size = value_string_index;
-
-	return( 1 );
-}
-
-/* Converts the security identifier into an UTF-8 string
- * The string size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfwnt_security_identifier_copy_to_utf8_string(
-     libfwnt_security_identifier_t *security_identifier,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
-	static char *function    = "libfwnt_security_identifier_copy_to_utf8_string";
-	size_t utf8_string_index = 0;
-
-	if( libfwnt_security_identifier_copy_to_utf8_string_with_index(
-	     security_identifier,
-	     utf8_string,
-	     utf8_string_size,
-	     &utf8_string_index,
-	     string_format_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy security identifier to UTF-8 string.",
-		 function );
+	*data_size = 8 + ( (size_t) internal_security_identifier->number_of_sub_authorities * 4 );
 
-		return( -1 );
-	}
 	return( 1 );
 }
 
-/* Converts the security identifier into an UTF-8 string
- * The string size should include the end of string character
+/* Converts a security identifier into a byte stream
  * Returns 1 if successful or -1 on error
  */
-int libfwnt_security_identifier_copy_to_utf8_string_with_index(
+int libfwnt_security_identifier_copy_to_byte_stream(
      libfwnt_security_identifier_t *security_identifier,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
-     size_t *utf8_string_index,
-     uint32_t string_format_flags,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
      libcerror_error_t **error )
 {
 	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
-	static char *function                                                = "libfwnt_security_identifier_copy_to_utf8_string";
-	size_t string_index                                                  = 0;
-	size_t value_string_index                                            = 0;
-	size_t value_string_length                                           = 0;
-	uint64_t value_64bit                                                 = 0;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_byte_stream";
+	size_t security_identifier_size                                      = 0;
 	uint8_t sub_authority_index                                          = 0;
 
 	if( security_identifier == NULL )
@@ -467,250 +404,202 @@ int libfwnt_security_identifier_copy_to_utf8_string_with_index(
 	}
 	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
 
-	if( utf8_string == NULL )
+	if( byte_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 size.",
+		 "%s: invalid byte stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_size > (size_t) SSIZE_MAX )
+	if( byte_stream_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: UTF-8 string size exceeds maximum.",
-		 function );
-
-		return( -1 );
-	}
-	if( utf8_string_index == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string index.",
+		 "%s: byte stream size exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( string_format_flags != 0 )
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported string format flags.",
+		 "%s: unsupported byte order.",
 		 function );
 
 		return( -1 );
 	}
-	string_index = *utf8_string_index;
-
-	if( ( string_index + 2 ) >= utf8_string_size )
+	if( internal_security_identifier->number_of_sub_authorities > 15 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string is too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier contains more than 15 sub authoritites.",
 		 function );
 
 		return( -1 );
 	}
-	utf8_string[ string_index++ ] = (uint8_t) 'S';
-	utf8_string[ string_index++ ] = (uint8_t) '-';
-
-	value_64bit         = internal_security_identifier->revision_number;
-	value_string_length = 0;
-
-	do
-	{
-		value_string_length++;
-
-		value_64bit /= 10;
-	}
-	while( value_64bit > 0 );
+	security_identifier_size = 8 + ( (size_t) internal_security_identifier->number_of_sub_authorities * 4 );
 
-	if( ( string_index + value_string_length + 1 ) >= utf8_string_size )
+	if( byte_stream_size < security_identifier_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string is too small.",
+		 "%s: byte stream too small.",
 		 function );
 
 		return( -1 );
 	}
-	value_64bit        = internal_security_identifier->revision_number;
-	value_string_index = value_string_length;
+	byte_stream[ 0 ] = internal_security_identifier->revision_number;
+	byte_stream[ 1 ] = internal_security_identifier->number_of_sub_authorities;
 
-	while( value_string_index > 0 )
-	{
-		value_string_index--;
-
-		utf8_string[ string_index + value_string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
-
-		value_64bit /= 10;
-	}
-	string_index += value_string_length;
+	byte_stream += 2;
 
-	utf8_string[ string_index++ ] = (uint8_t) '-';
+	/* The authority is stored as a 48-bit value
+	 */
+	byte_stream_copy_from_uint48_big_endian(
+	 byte_stream,
+	 internal_security_identifier->authority );
 
-	value_64bit         = internal_security_identifier->authority;
-	value_string_length = 0;
+	byte_stream += 6;
 
-	do
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
 	{
-		value_string_length++;
+		byte_stream_copy_from_uint32_little_endian(
+		 byte_stream,
+		 internal_security_identifier->sub_authority[ sub_authority_index ] );
 
-		value_64bit /= 10;
+		byte_stream += 4;
 	}
-	while( value_64bit > 0 );
+	return( 1 );
+}
 
-	if( ( string_index + value_string_length ) >= utf8_string_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string is too small.",
-		 function );
+/* Reads a decimal or hexadecimal value from an UTF-8 string
+ * Hexadecimal values are prefixed with "0x"
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_read_utf8_string_value(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t *utf8_string_index,
+     uint64_t maximum_value,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfwnt_security_identifier_read_utf8_string_value";
+	size_t number_of_digits   = 0;
+	size_t string_index       = 0;
+	uint64_t base             = 10;
+	uint64_t digit_value      = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t character_value   = 0;
 
-		return( -1 );
-	}
-	value_64bit        = internal_security_identifier->authority;
-	value_string_index = value_string_length;
+	string_index = *utf8_string_index;
 
-	while( value_string_index > 0 )
+	if( ( ( string_index + 2 ) < utf8_string_length )
+	 && ( utf8_string[ string_index ] == (uint8_t) '0' )
+	 && ( ( utf8_string[ string_index + 1 ] == (uint8_t) 'x' )
+	  ||  ( utf8_string[ string_index + 1 ] == (uint8_t) 'X' ) ) )
 	{
-		value_string_index--;
-
-		utf8_string[ string_index + value_string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
-
-		value_64bit /= 10;
+		base          = 16;
+		string_index += 2;
 	}
-	string_index += value_string_length;
-
-	for( sub_authority_index = 0;
-	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
-	     sub_authority_index++ )
+	while( string_index < utf8_string_length )
 	{
-		value_64bit         = internal_security_identifier->sub_authority[ sub_authority_index ];
-		value_string_length = 0;
+		character_value = utf8_string[ string_index ];
 
-		do
+		if( ( character_value >= (uint8_t) '0' )
+		 && ( character_value <= (uint8_t) '9' ) )
 		{
-			value_string_length++;
-
-			value_64bit /= 10;
+			digit_value = (uint64_t) ( character_value - (uint8_t) '0' );
 		}
-		while( value_64bit > 0 );
-
-		if( ( string_index + value_string_length + 1 ) >= utf8_string_size )
+		else if( ( base == 16 )
+		      && ( character_value >= (uint8_t) 'a' )
+		      && ( character_value <= (uint8_t) 'f' ) )
+		{
+			digit_value = (uint64_t) ( character_value - (uint8_t) 'a' + 10 );
+		}
+		else if( ( base == 16 )
+		      && ( character_value >= (uint8_t) 'A' )
+		      && ( character_value <= (uint8_t) 'F' ) )
+		{
+			digit_value = (uint64_t) ( character_value - (uint8_t) 'A' + 10 );
+		}
+		else
+		{
+			break;
+		}
+		if( safe_value_64bit > ( ( maximum_value - digit_value ) / base ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string is too small.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value at index: %" PRIzd " out of bounds.",
+			 function,
+			 *utf8_string_index );
 
 			return( -1 );
 		}
-		utf8_string[ string_index++ ] = (uint8_t) '-';
-
-		value_64bit        = internal_security_identifier->sub_authority[ sub_authority_index ];
-		value_string_index = value_string_length;
-
-		while( value_string_index > 0 )
-		{
-			value_string_index--;
+		safe_value_64bit *= base;
+		safe_value_64bit += digit_value;
 
-			utf8_string[ string_index + value_string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
-
-			value_64bit /= 10;
-		}
-		string_index += value_string_length;
+		number_of_digits++;
+		string_index++;
 	}
-	if( string_index >= utf8_string_size )
+	if( number_of_digits == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-8 string is too small.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing value at index: %" PRIzd ".",
+		 function,
+		 *utf8_string_index );
 
 		return( -1 );
 	}
-	utf8_string[ string_index++ ] = 0;
-
 	*utf8_string_index = string_index;
+	*value_64bit       = safe_value_64bit;
 
 	return( 1 );
 }
 
-/* Converts the security identifier into an UTF-16 string
- * The string size should include the end of string character
+/* Converts an UTF-8 string into a security identifier
+ * The string is either formatted as "S-1-5-32-544" or a security descriptor
+ * definition language (SDDL) alias such as "BA"
  * Returns 1 if successful or -1 on error
  */
-int libfwnt_security_identifier_copy_to_utf16_string(
+int libfwnt_security_identifier_copy_from_utf8_string(
      libfwnt_security_identifier_t *security_identifier,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
-	static char *function    = "libfwnt_security_identifier_copy_to_utf16_string";
-	size_t utf16_string_index = 0;
-
-	if( libfwnt_security_identifier_copy_to_utf16_string_with_index(
-	     security_identifier,
-	     utf16_string,
-	     utf16_string_size,
-	     &utf16_string_index,
-	     string_format_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy security identifier to UTF-16 string.",
-		 function );
+	uint32_t sub_authority[ 15 ];
 
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Converts the security identifier into an UTF-16 string
- * The string size should include the end of string character
- * Returns 1 if successful or -1 on error
- */
-int libfwnt_security_identifier_copy_to_utf16_string_with_index(
-     libfwnt_security_identifier_t *security_identifier,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
-     size_t *utf16_string_index,
-     uint32_t string_format_flags,
-     libcerror_error_t **error )
-{
 	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
-	static char *function                                                = "libfwnt_security_identifier_copy_to_utf16_string";
+	const char *alias_string                                             = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_from_utf8_string";
 	size_t string_index                                                  = 0;
-	size_t value_string_index                                            = 0;
-	size_t value_string_length                                           = 0;
+	uint64_t authority                                                   = 0;
 	uint64_t value_64bit                                                 = 0;
-	uint8_t sub_authority_index                                          = 0;
+	uint8_t number_of_sub_authorities                                    = 0;
+	uint8_t revision_number                                              = 0;
 
 	if( security_identifier == NULL )
 	{
@@ -725,35 +614,1372 @@ int libfwnt_security_identifier_copy_to_utf16_string_with_index(
 	}
 	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
 
-	if( utf16_string == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_size > (size_t) SSIZE_MAX )
+	if( utf8_string_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: UTF-16 string size exceeds maximum.",
+		 "%s: UTF-8 string length exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf16_string_index == NULL )
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a trailing end of string character
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ utf8_string_length - 1 ] == 0 ) )
+	{
+		utf8_string_length--;
+	}
+	if( utf8_string_length == 2 )
+	{
+		alias_string = libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+		                utf8_string );
+
+		if( alias_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported security identifier alias: %c%c.",
+			 function,
+			 (char) utf8_string[ 0 ],
+			 (char) utf8_string[ 1 ] );
+
+			return( -1 );
+		}
+		utf8_string        = (const uint8_t *) alias_string;
+		utf8_string_length = narrow_string_length(
+		                      alias_string );
+	}
+	if( ( utf8_string_length < 2 )
+	 || ( ( utf8_string[ 0 ] != (uint8_t) 'S' )
+	  &&  ( utf8_string[ 0 ] != (uint8_t) 's' ) )
+	 || ( utf8_string[ 1 ] != (uint8_t) '-' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = 2;
+
+	if( libfwnt_security_identifier_read_utf8_string_value(
+	     utf8_string,
+	     utf8_string_length,
+	     &string_index,
+	     (uint64_t) 0xffUL,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read revision number.",
+		 function );
+
+		return( -1 );
+	}
+	revision_number = (uint8_t) value_64bit;
+
+	if( ( string_index >= utf8_string_length )
+	 || ( utf8_string[ string_index ] != (uint8_t) '-' ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: missing authority.",
+		 function );
+
+		return( -1 );
+	}
+	string_index++;
+
+	/* The authority is stored as a 48-bit value
+	 */
+	if( libfwnt_security_identifier_read_utf8_string_value(
+	     utf8_string,
+	     utf8_string_length,
+	     &string_index,
+	     (uint64_t) 0xffffffffffffUL,
+	     &authority,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read authority.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_index < utf8_string_length )
+	{
+		if( utf8_string[ string_index ] != (uint8_t) '-' )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+		if( number_of_sub_authorities >= 15 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+			 function );
+
+			return( -1 );
+		}
+		string_index++;
+
+		if( libfwnt_security_identifier_read_utf8_string_value(
+		     utf8_string,
+		     utf8_string_length,
+		     &string_index,
+		     (uint64_t) 0xffffffffUL,
+		     &value_64bit,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read sub authority: %" PRIu8 ".",
+			 function,
+			 number_of_sub_authorities );
+
+			return( -1 );
+		}
+		sub_authority[ number_of_sub_authorities++ ] = (uint32_t) value_64bit;
+	}
+	/* Only change the security identifier when the whole string was valid
+	 */
+	internal_security_identifier->utf8_string_length        = 0;
+	internal_security_identifier->revision_number           = revision_number;
+	internal_security_identifier->authority                 = authority;
+	internal_security_identifier->number_of_sub_authorities = number_of_sub_authorities;
+
+	if( number_of_sub_authorities > 0 )
+	{
+		if( memory_copy(
+		     internal_security_identifier->sub_authority,
+		     sub_authority,
+		     sizeof( uint32_t ) * number_of_sub_authorities ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sub authorities.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares the security identifier with a security identifier stored in a byte stream
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libfwnt_security_identifier_compare_with_byte_stream(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_compare_with_byte_stream";
+	size_t security_identifier_size                                      = 0;
+	uint64_t authority                                                   = 0;
+	uint32_t sub_authority                                               = 0;
+	uint8_t sub_authority_index                                          = 0;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size < 8 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: byte stream size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_order != LIBFWNT_ENDIAN_LITTLE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported byte order.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream[ 1 ] > 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported security identifier contains more than 15 sub authoritites.",
+		 function );
+
+		return( -1 );
+	}
+	security_identifier_size = 8 + ( (size_t) byte_stream[ 1 ] * 4 );
+
+	if( security_identifier_size > byte_stream_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: byte stream too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( byte_stream[ 0 ] != internal_security_identifier->revision_number )
+	 || ( byte_stream[ 1 ] != internal_security_identifier->number_of_sub_authorities ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint48_big_endian(
+	 &( byte_stream[ 2 ] ),
+	 authority );
+
+	if( authority != internal_security_identifier->authority )
+	{
+		return( 0 );
+	}
+	byte_stream += 8;
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 byte_stream,
+		 sub_authority );
+
+		if( sub_authority != internal_security_identifier->sub_authority[ sub_authority_index ] )
+		{
+			return( 0 );
+		}
+		byte_stream += 4;
+	}
+	return( 1 );
+}
+
+/* Compares two security identifiers
+ * Security identifiers are ordered by revision number, authority and sub authorities,
+ * where a security identifier that is a prefix of another is ordered first
+ * Returns LIBFWNT_COMPARE_LESS, LIBFWNT_COMPARE_EQUAL, LIBFWNT_COMPARE_GREATER if successful or -1 on error
+ */
+int libfwnt_security_identifier_compare(
+     libfwnt_security_identifier_t *first_security_identifier,
+     libfwnt_security_identifier_t *second_security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_first_security_identifier  = NULL;
+	libfwnt_internal_security_identifier_t *internal_second_security_identifier = NULL;
+	static char *function                                                       = "libfwnt_security_identifier_compare";
+	uint8_t number_of_sub_authorities                                           = 0;
+	uint8_t sub_authority_index                                                 = 0;
+
+	if( first_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_security_identifier  = (libfwnt_internal_security_identifier_t *) first_security_identifier;
+	internal_second_security_identifier = (libfwnt_internal_security_identifier_t *) second_security_identifier;
+
+	if( internal_first_security_identifier->revision_number < internal_second_security_identifier->revision_number )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( internal_first_security_identifier->revision_number > internal_second_security_identifier->revision_number )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	if( internal_first_security_identifier->authority < internal_second_security_identifier->authority )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( internal_first_security_identifier->authority > internal_second_security_identifier->authority )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	number_of_sub_authorities = internal_first_security_identifier->number_of_sub_authorities;
+
+	if( number_of_sub_authorities > internal_second_security_identifier->number_of_sub_authorities )
+	{
+		number_of_sub_authorities = internal_second_security_identifier->number_of_sub_authorities;
+	}
+	for( sub_authority_index = 0;
+	     sub_authority_index < number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		if( internal_first_security_identifier->sub_authority[ sub_authority_index ] < internal_second_security_identifier->sub_authority[ sub_authority_index ] )
+		{
+			return( LIBFWNT_COMPARE_LESS );
+		}
+		else if( internal_first_security_identifier->sub_authority[ sub_authority_index ] > internal_second_security_identifier->sub_authority[ sub_authority_index ] )
+		{
+			return( LIBFWNT_COMPARE_GREATER );
+		}
+	}
+	if( internal_first_security_identifier->number_of_sub_authorities < internal_second_security_identifier->number_of_sub_authorities )
+	{
+		return( LIBFWNT_COMPARE_LESS );
+	}
+	else if( internal_first_security_identifier->number_of_sub_authorities > internal_second_security_identifier->number_of_sub_authorities )
+	{
+		return( LIBFWNT_COMPARE_GREATER );
+	}
+	return( LIBFWNT_COMPARE_EQUAL );
+}
+
+/* Determines if two security identifiers are equal
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libfwnt_security_identifier_is_equal(
+     libfwnt_security_identifier_t *first_security_identifier,
+     libfwnt_security_identifier_t *second_security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_first_security_identifier  = NULL;
+	libfwnt_internal_security_identifier_t *internal_second_security_identifier = NULL;
+	static char *function                                                       = "libfwnt_security_identifier_is_equal";
+	uint8_t sub_authority_index                                                 = 0;
+
+	if( first_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_first_security_identifier  = (libfwnt_internal_security_identifier_t *) first_security_identifier;
+	internal_second_security_identifier = (libfwnt_internal_security_identifier_t *) second_security_identifier;
+
+	if( ( internal_first_security_identifier->revision_number != internal_second_security_identifier->revision_number )
+	 || ( internal_first_security_identifier->number_of_sub_authorities != internal_second_security_identifier->number_of_sub_authorities )
+	 || ( internal_first_security_identifier->authority != internal_second_security_identifier->authority ) )
+	{
+		return( 0 );
+	}
+	/* Compare the last sub authority first since that is the one most likely to differ
+	 */
+	for( sub_authority_index = internal_first_security_identifier->number_of_sub_authorities;
+	     sub_authority_index > 0;
+	     sub_authority_index-- )
+	{
+		if( internal_first_security_identifier->sub_authority[ sub_authority_index - 1 ] != internal_second_security_identifier->sub_authority[ sub_authority_index - 1 ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Copies the values of a security identifier
+ * Only the values are copied, the cached string and arena are not shared with the destination
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_copy_values(
+     libfwnt_internal_security_identifier_t *destination_security_identifier,
+     libfwnt_internal_security_identifier_t *source_security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfwnt_internal_security_identifier_copy_values";
+	uint8_t sub_authority_index = 0;
+
+	if( destination_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     destination_security_identifier,
+	     0,
+	     sizeof( libfwnt_internal_security_identifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	destination_security_identifier->revision_number           = source_security_identifier->revision_number;
+	destination_security_identifier->authority                 = source_security_identifier->authority;
+	destination_security_identifier->number_of_sub_authorities = source_security_identifier->number_of_sub_authorities;
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < source_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		destination_security_identifier->sub_authority[ sub_authority_index ] = source_security_identifier->sub_authority[ sub_authority_index ];
+	}
+	return( 1 );
+}
+
+/* Sets the values of a security identifier from another security identifier
+ * Unlike libfwnt_internal_security_identifier_copy_values the arena, managed state
+ * and cached UTF-8 string buffer of the destination are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_set_values(
+     libfwnt_internal_security_identifier_t *destination_security_identifier,
+     libfwnt_internal_security_identifier_t *source_security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfwnt_internal_security_identifier_set_values";
+	uint8_t sub_authority_index = 0;
+
+	if( destination_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_security_identifier->number_of_sub_authorities > 15 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported source security identifier contains more than 15 sub authoritites.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_security_identifier == source_security_identifier )
+	{
+		return( 1 );
+	}
+	/* The cached UTF-8 string no longer matches the values
+	 */
+	destination_security_identifier->utf8_string_length = 0;
+
+	destination_security_identifier->revision_number           = source_security_identifier->revision_number;
+	destination_security_identifier->authority                 = source_security_identifier->authority;
+	destination_security_identifier->number_of_sub_authorities = source_security_identifier->number_of_sub_authorities;
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < source_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		destination_security_identifier->sub_authority[ sub_authority_index ] = source_security_identifier->sub_authority[ sub_authority_index ];
+	}
+	return( 1 );
+}
+
+/* Calculates a 64-bit hash of the security identifier
+ * Returns the hash
+ */
+uint64_t libfwnt_internal_security_identifier_get_hash(
+          libfwnt_internal_security_identifier_t *internal_security_identifier )
+{
+	uint64_t hash               = 0;
+	uint64_t value_64bit        = 0;
+	uint8_t sub_authority_index = 0;
+
+	/* The revision number, number of sub authorities and 48-bit authority
+	 * are combined into a single 64-bit value
+	 */
+	value_64bit = ( (uint64_t) internal_security_identifier->revision_number << 56 )
+	            | ( (uint64_t) internal_security_identifier->number_of_sub_authorities << 48 )
+	            | ( internal_security_identifier->authority & (uint64_t) 0xffffffffffffUL );
+
+	hash = (uint64_t) 0xcbf29ce484222325UL;
+
+	do
+	{
+		value_64bit *= (uint64_t) 0xc6a4a7935bd1e995UL;
+		value_64bit ^= value_64bit >> 47;
+		value_64bit *= (uint64_t) 0xc6a4a7935bd1e995UL;
+
+		hash ^= value_64bit;
+		hash *= (uint64_t) 0xc6a4a7935bd1e995UL;
+
+		if( sub_authority_index >= internal_security_identifier->number_of_sub_authorities )
+		{
+			break;
+		}
+		/* Mix in the sub authorities 2 at a time
+		 */
+		value_64bit = internal_security_identifier->sub_authority[ sub_authority_index++ ];
+
+		if( sub_authority_index < internal_security_identifier->number_of_sub_authorities )
+		{
+			value_64bit |= (uint64_t) internal_security_identifier->sub_authority[ sub_authority_index++ ] << 32;
+		}
+	}
+	while( 1 );
+
+	/* Finalize the hash so that all bits are avalanched
+	 */
+	hash ^= hash >> 33;
+	hash *= (uint64_t) 0xff51afd7ed558ccdUL;
+	hash ^= hash >> 33;
+	hash *= (uint64_t) 0xc4ceb9fe1a85ec53UL;
+	hash ^= hash >> 33;
+
+	return( hash );
+}
+
+/* Retrieves a 64-bit hash of the security identifier
+ * The hash only depends on the revision number, authority and sub authorities
+ * and is the same on every platform
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_get_hash(
+     libfwnt_security_identifier_t *security_identifier,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_identifier_get_hash";
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	*hash = libfwnt_internal_security_identifier_get_hash(
+	         (libfwnt_internal_security_identifier_t *) security_identifier );
+
+	return( 1 );
+}
+
+/* Copies the security identifier to a fixed-size key
+ * The key is LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE bytes and consists of:
+ * the revision number, the 48-bit authority and 15 sub authorities,
+ * all stored in big-endian and unused sub authorities set to 0,
+ * followed by the number of sub authorities.
+ * Comparing keys with memcmp() results in the same order as libfwnt_security_identifier_compare
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_key(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_key";
+	size_t key_offset                                                    = 0;
+	uint8_t sub_authority_index                                          = 0;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size < LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: key too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: key size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	key[ 0 ] = internal_security_identifier->revision_number;
+
+	byte_stream_copy_from_uint48_big_endian(
+	 &( key[ 1 ] ),
+	 internal_security_identifier->authority );
+
+	key_offset = 7;
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( key[ key_offset ] ),
+		 internal_security_identifier->sub_authority[ sub_authority_index ] );
+
+		key_offset += 4;
+	}
+	if( key_offset < ( LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE - 1 ) )
+	{
+		if( memory_set(
+		     &( key[ key_offset ] ),
+		     0,
+		     LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE - 1 - key_offset ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear key.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	key[ LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE - 1 ] = internal_security_identifier->number_of_sub_authorities;
+
+	return( 1 );
+}
+
+/* Retrieves the well-known type
+ * Returns 1 if successful, 0 if the security identifier is not well-known or -1 on error
+ */
+int libfwnt_security_identifier_get_well_known_type(
+     libfwnt_security_identifier_t *security_identifier,
+     int *well_known_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_identifier_get_well_known_type";
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( well_known_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid well-known type.",
+		 function );
+
+		return( -1 );
+	}
+	*well_known_type = libfwnt_well_known_security_identifier_get_type(
+	                    (libfwnt_internal_security_identifier_t *) security_identifier );
+
+	if( *well_known_type == LIBFWNT_WELL_KNOWN_SID_UNKNOWN )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Two digit decimal strings used to format two digits at a time
+ */
+static const char libfwnt_security_identifier_decimal_digit_pairs[ 201 ] = \
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* Powers of 10 used to determine the number of decimal digits
+ */
+static const uint64_t libfwnt_security_identifier_powers_of_10[ 20 ] = {
+	1UL,
+	10UL,
+	100UL,
+	1000UL,
+	10000UL,
+	100000UL,
+	1000000UL,
+	10000000UL,
+	100000000UL,
+	1000000000UL,
+	10000000000UL,
+	100000000000UL,
+	1000000000000UL,
+	10000000000000UL,
+	100000000000000UL,
+	1000000000000000UL,
+	10000000000000000UL,
+	100000000000000000UL,
+	1000000000000000000UL,
+	10000000000000000000UL };
+
+/* Determines the number of decimal digits of a value
+ * Returns the number of digits
+ */
+size_t libfwnt_security_identifier_get_number_of_decimal_digits(
+        uint64_t value_64bit )
+{
+	uint64_t bits_value_64bit = value_64bit;
+	size_t number_of_bits     = 1;
+	size_t number_of_digits   = 0;
+
+	if( value_64bit == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the number of bits of the value
+	 */
+	if( bits_value_64bit >= ( (uint64_t) 1 << 32 ) )
+	{
+		bits_value_64bit >>= 32;
+		number_of_bits    += 32;
+	}
+	if( bits_value_64bit >= ( (uint64_t) 1 << 16 ) )
+	{
+		bits_value_64bit >>= 16;
+		number_of_bits    += 16;
+	}
+	if( bits_value_64bit >= ( (uint64_t) 1 << 8 ) )
+	{
+		bits_value_64bit >>= 8;
+		number_of_bits    += 8;
+	}
+	if( bits_value_64bit >= ( (uint64_t) 1 << 4 ) )
+	{
+		bits_value_64bit >>= 4;
+		number_of_bits    += 4;
+	}
+	if( bits_value_64bit >= ( (uint64_t) 1 << 2 ) )
+	{
+		bits_value_64bit >>= 2;
+		number_of_bits    += 2;
+	}
+	if( bits_value_64bit >= ( (uint64_t) 1 << 1 ) )
+	{
+		number_of_bits += 1;
+	}
+	/* log10( 2 ) is approximately 1233 / 4096, this estimate is either exact
+	 * or one digit short, which is corrected using the powers of 10
+	 */
+	number_of_digits = ( number_of_bits * 1233 ) >> 12;
+
+	if( value_64bit >= libfwnt_security_identifier_powers_of_10[ number_of_digits ] )
+	{
+		number_of_digits++;
+	}
+	return( number_of_digits );
+}
+
+/* Determines the length of the string for the security identifier
+ * The string length does not include the end of string character
+ * Returns the string length
+ */
+size_t libfwnt_internal_security_identifier_get_string_length(
+        libfwnt_internal_security_identifier_t *internal_security_identifier )
+{
+	size_t string_length        = 0;
+	uint8_t sub_authority_index = 0;
+
+	if( internal_security_identifier->utf8_string_length != 0 )
+	{
+		return( internal_security_identifier->utf8_string_length );
+	}
+	/* The "S-", revision number, "-" and authority
+	 */
+	string_length = 3
+	              + libfwnt_security_identifier_get_number_of_decimal_digits(
+	                 (uint64_t) internal_security_identifier->revision_number )
+	              + libfwnt_security_identifier_get_number_of_decimal_digits(
+	                 internal_security_identifier->authority );
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		string_length += 1 + libfwnt_security_identifier_get_number_of_decimal_digits(
+		                      (uint64_t) internal_security_identifier->sub_authority[ sub_authority_index ] );
+	}
+	return( string_length );
+}
+
+/* Writes a decimal value to a string
+ * The string must have space for the number of digits of the value
+ * Returns the number of characters written
+ */
+size_t libfwnt_security_identifier_write_decimal_value(
+        uint8_t *string,
+        uint64_t value_64bit )
+{
+	size_t digit_pair_index = 0;
+	size_t number_of_digits = 0;
+	size_t string_index     = 0;
+
+	number_of_digits = libfwnt_security_identifier_get_number_of_decimal_digits(
+	                    value_64bit );
+
+	string_index = number_of_digits;
+
+	while( value_64bit >= 100 )
+	{
+		digit_pair_index = (size_t) ( value_64bit % 100 ) * 2;
+		value_64bit     /= 100;
+
+		string_index -= 2;
+
+		string[ string_index ]     = (uint8_t) libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index ];
+		string[ string_index + 1 ] = (uint8_t) libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index + 1 ];
+	}
+	if( value_64bit >= 10 )
+	{
+		digit_pair_index = (size_t) value_64bit * 2;
+
+		string[ 0 ] = (uint8_t) libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index ];
+		string[ 1 ] = (uint8_t) libfwnt_security_identifier_decimal_digit_pairs[ digit_pair_index + 1 ];
+	}
+	else
+	{
+		string[ 0 ] = (uint8_t) '0' + (uint8_t) value_64bit;
+	}
+	return( number_of_digits );
+}
+
+/* Writes the security identifier to a string
+ * The string must have space for the string length of the security identifier
+ * Returns the number of characters written, without an end of string character
+ */
+size_t libfwnt_internal_security_identifier_write_string(
+        libfwnt_internal_security_identifier_t *internal_security_identifier,
+        uint8_t *string )
+{
+	size_t string_index         = 0;
+	uint8_t sub_authority_index = 0;
+
+	string[ string_index++ ] = (uint8_t) 'S';
+	string[ string_index++ ] = (uint8_t) '-';
+
+	string_index += libfwnt_security_identifier_write_decimal_value(
+	                 &( string[ string_index ] ),
+	                 (uint64_t) internal_security_identifier->revision_number );
+
+	string[ string_index++ ] = (uint8_t) '-';
+
+	string_index += libfwnt_security_identifier_write_decimal_value(
+	                 &( string[ string_index ] ),
+	                 internal_security_identifier->authority );
+
+	for( sub_authority_index = 0;
+	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
+	     sub_authority_index++ )
+	{
+		string[ string_index++ ] = (uint8_t) '-';
+
+		string_index += libfwnt_security_identifier_write_decimal_value(
+		                 &( string[ string_index ] ),
+		                 (uint64_t) internal_security_identifier->sub_authority[ sub_authority_index ] );
+	}
+	return( string_index );
+}
+
+/* Retrieves the cached UTF-8 string, the string is created if not set
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_get_cached_utf8_string(
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_identifier_get_cached_utf8_string";
+
+	if( internal_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier->utf8_string_length != 0 )
+	{
+		return( 1 );
+	}
+	/* The buffer is sized for the longest possible string so that it can be
+	 * reused when the security identifier is changed
+	 */
+	if( internal_security_identifier->utf8_string == NULL )
+	{
+		internal_security_identifier->utf8_string = (uint8_t *) libfwnt_arena_allocate(
+		                                                         internal_security_identifier->arena,
+		                                                         LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_STRING_LENGTH + 1 );
+
+		if( internal_security_identifier->utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_security_identifier->utf8_string_length = libfwnt_internal_security_identifier_write_string(
+	                                                    internal_security_identifier,
+	                                                    internal_security_identifier->utf8_string );
+
+	internal_security_identifier->utf8_string[ internal_security_identifier->utf8_string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Deterimes the size of the string for the security identifier
+ * The string size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_get_string_size(
+     libfwnt_security_identifier_t *security_identifier,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_get_string_size";
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	*string_size = libfwnt_internal_security_identifier_get_string_length(
+	                internal_security_identifier ) + 1;
+
+	return( 1 );
+}
+
+/* Converts the security identifier into an UTF-8 string
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_utf8_string(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwnt_security_identifier_copy_to_utf8_string";
+	size_t utf8_string_index = 0;
+
+	if( libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	     security_identifier,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     string_format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Converts the security identifier into an UTF-8 string
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_utf8_string_with_index(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_utf8_string";
+	size_t string_index                                                  = 0;
+	size_t string_length                                                 = 0;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 size.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-8 string size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = *utf8_string_index;
+
+	string_length = libfwnt_internal_security_identifier_get_string_length(
+	                 internal_security_identifier );
+
+	if( ( string_index >= utf8_string_size )
+	 || ( string_length >= ( utf8_string_size - string_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string is too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier->utf8_string_length != 0 )
+	{
+		if( memory_copy(
+		     &( utf8_string[ string_index ] ),
+		     internal_security_identifier->utf8_string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		string_index += string_length;
+	}
+	else
+	{
+		string_index += libfwnt_internal_security_identifier_write_string(
+		                 internal_security_identifier,
+		                 &( utf8_string[ string_index ] ) );
+	}
+	utf8_string[ string_index++ ] = 0;
+
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Converts the security identifier into an UTF-8 string and retrieves its size
+ * This determines the string size and writes the string in a single call
+ * The string size includes the end of string character and is set when the
+ * UTF-8 string is too small or not provided
+ * Returns 1 if successful, 0 if the UTF-8 string is too small or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_utf8_string_with_size(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_utf8_string_with_size";
+	size_t string_length                                                 = 0;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
+
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-8 string size exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-16 string index.",
+		 "%s: invalid string size.",
 		 function );
 
 		return( -1 );
@@ -769,136 +1995,234 @@ int libfwnt_security_identifier_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
-	string_index = *utf16_string_index;
+	string_length = libfwnt_internal_security_identifier_get_string_length(
+	                 internal_security_identifier );
+
+	*string_size = string_length + 1;
+
+	if( ( utf8_string == NULL )
+	 || ( string_length >= utf8_string_size ) )
+	{
+		return( 0 );
+	}
+	if( internal_security_identifier->utf8_string_length != 0 )
+	{
+		if( memory_copy(
+		     utf8_string,
+		     internal_security_identifier->utf8_string,
+		     string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		libfwnt_internal_security_identifier_write_string(
+		 internal_security_identifier,
+		 utf8_string );
+	}
+	utf8_string[ string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a reference to the UTF-8 string of the security identifier
+ * The UTF-8 string is created on first use and cached by the security identifier.
+ * The strings of security identifiers shared by a security descriptor cache or
+ * a security identifier pool are created before they are shared.
+ * The reference is valid until the security identifier is changed or freed.
+ * The string length does not include the end of string character, which is set.
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_get_utf8_string_reference(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_get_utf8_string_reference";
 
-	if( ( string_index + 2 ) >= utf16_string_size )
+	if( security_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-16 string is too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
 		 function );
 
 		return( -1 );
 	}
-	utf16_string[ string_index++ ] = (uint16_t) 'S';
-	utf16_string[ string_index++ ] = (uint16_t) '-';
-
-	value_64bit         = internal_security_identifier->revision_number;
-	value_string_length = 0;
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
 
-	do
+	if( utf8_string == NULL )
 	{
-		value_string_length++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
 
-		value_64bit /= 10;
+		return( -1 );
 	}
-	while( value_64bit > 0 );
-
-	if( ( string_index + value_string_length + 1 ) >= utf16_string_size )
+	if( utf8_string_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-16 string is too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
 		 function );
 
 		return( -1 );
 	}
-	value_64bit        = internal_security_identifier->revision_number;
-	value_string_index = value_string_length;
-
-	while( value_string_index > 0 )
+	if( libfwnt_internal_security_identifier_get_cached_utf8_string(
+	     internal_security_identifier,
+	     error ) != 1 )
 	{
-		value_string_index--;
-
-		utf16_string[ string_index + value_string_index ] = (uint16_t) '0' + (uint16_t) ( value_64bit % 10 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
 
-		value_64bit /= 10;
+		return( -1 );
 	}
-	string_index += value_string_length;
+	*utf8_string        = internal_security_identifier->utf8_string;
+	*utf8_string_length = internal_security_identifier->utf8_string_length;
 
-	utf16_string[ string_index++ ] = (uint16_t) '-';
+	return( 1 );
+}
 
-	value_64bit         = internal_security_identifier->authority;
-	value_string_length = 0;
+/* Converts the security identifier into an UTF-16 string
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_utf16_string(
+     libfwnt_security_identifier_t *security_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwnt_security_identifier_copy_to_utf16_string";
+	size_t utf16_string_index = 0;
 
-	do
+	if( libfwnt_security_identifier_copy_to_utf16_string_with_index(
+	     security_identifier,
+	     utf16_string,
+	     utf16_string_size,
+	     &utf16_string_index,
+	     string_format_flags,
+	     error ) != 1 )
 	{
-		value_string_length++;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier to UTF-16 string.",
+		 function );
 
-		value_64bit /= 10;
+		return( -1 );
 	}
-	while( value_64bit > 0 );
+	return( 1 );
+}
+
+/* Converts the security identifier into an UTF-16 string
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_copy_to_utf16_string_with_index(
+     libfwnt_security_identifier_t *security_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     uint32_t string_format_flags,
+     libcerror_error_t **error )
+{
+	uint8_t string[ LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_STRING_LENGTH ];
+
+	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
+	static char *function                                                = "libfwnt_security_identifier_copy_to_utf16_string";
+	uint8_t *string_characters                                           = NULL;
+	size_t character_index                                               = 0;
+	size_t string_index                                                  = 0;
+	size_t string_length                                                 = 0;
 
-	if( ( string_index + value_string_length ) >= utf16_string_size )
+	if( security_identifier == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-16 string is too small.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
 		 function );
 
 		return( -1 );
 	}
-	value_64bit        = internal_security_identifier->authority;
-	value_string_index = value_string_length;
+	internal_security_identifier = (libfwnt_internal_security_identifier_t *) security_identifier;
 
-	while( value_string_index > 0 )
+	if( utf16_string == NULL )
 	{
-		value_string_index--;
-
-		utf16_string[ string_index + value_string_index ] = (uint16_t) '0' + (uint16_t) ( value_64bit % 10 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
 
-		value_64bit /= 10;
+		return( -1 );
 	}
-	string_index += value_string_length;
-
-	for( sub_authority_index = 0;
-	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
-	     sub_authority_index++ )
+	if( utf16_string_size > (size_t) SSIZE_MAX )
 	{
-		value_64bit         = internal_security_identifier->sub_authority[ sub_authority_index ];
-		value_string_length = 0;
-
-		do
-		{
-			value_64bit /= 10;
-
-			value_string_length++;
-		}
-		while( value_64bit > 0 );
-
-		if( ( string_index + value_string_length + 1 ) >= utf16_string_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-16 string is too small.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: UTF-16 string size exceeds maximum.",
+		 function );
 
-			return( -1 );
-		}
-		utf16_string[ string_index++ ] = (uint16_t) '-';
+		return( -1 );
+	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
 
-		value_64bit        = internal_security_identifier->sub_authority[ sub_authority_index ];
-		value_string_index = value_string_length;
+		return( -1 );
+	}
+	if( string_format_flags != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format flags.",
+		 function );
 
-		while( value_string_index > 0 )
-		{
-			value_string_index--;
+		return( -1 );
+	}
+	string_index = *utf16_string_index;
 
-			utf16_string[ string_index + value_string_index ] = (uint16_t) '0' + (uint16_t) ( value_64bit % 10 );
+	string_length = libfwnt_internal_security_identifier_get_string_length(
+	                 internal_security_identifier );
 
-			value_64bit /= 10;
-		}
-		string_index += value_string_length;
-	}
-	if( string_index >= utf16_string_size )
+	if( ( string_index >= utf16_string_size )
+	 || ( string_length >= ( utf16_string_size - string_index ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -909,6 +2233,24 @@ int libfwnt_security_identifier_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
+	if( internal_security_identifier->utf8_string_length != 0 )
+	{
+		string_characters = internal_security_identifier->utf8_string;
+	}
+	else
+	{
+		libfwnt_internal_security_identifier_write_string(
+		 internal_security_identifier,
+		 string );
+
+		string_characters = string;
+	}
+	for( character_index = 0;
+	     character_index < string_length;
+	     character_index++ )
+	{
+		utf16_string[ string_index++ ] = (uint16_t) string_characters[ character_index ];
+	}
 	utf16_string[ string_index++ ] = 0;
 
 	*utf16_string_index = string_index;
@@ -962,13 +2304,14 @@ int libfwnt_security_identifier_copy_to_utf32_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error )
 {
+	uint8_t string[ LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_STRING_LENGTH ];
+
 	libfwnt_internal_security_identifier_t *internal_security_identifier = NULL;
-	static char *function                                                = "libfwnt_security_identifier_copy_to_utf32_string_with_index";
+	static char *function                                                = "libfwnt_security_identifier_copy_to_utf32_string";
+	uint8_t *string_characters                                           = NULL;
+	size_t character_index                                               = 0;
 	size_t string_index                                                  = 0;
-	size_t value_string_index                                            = 0;
-	size_t value_string_length                                           = 0;
-	uint64_t value_64bit                                                 = 0;
-	uint8_t sub_authority_index                                          = 0;
+	size_t string_length                                                 = 0;
 
 	if( security_identifier == NULL )
 	{
@@ -1029,69 +2372,11 @@ int libfwnt_security_identifier_copy_to_utf32_string_with_index(
 	}
 	string_index = *utf32_string_index;
 
-	if( ( string_index + 2 ) > utf32_string_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-32 string is too small.",
-		 function );
-
-		return( -1 );
-	}
-	utf32_string[ string_index++ ] = (uint32_t) 'S';
-	utf32_string[ string_index++ ] = (uint32_t) '-';
-
-	value_64bit         = internal_security_identifier->revision_number;
-	value_string_length = 0;
-
-	do
-	{
-		value_64bit /= 10;
-
-		value_string_length++;
-	}
-	while( value_64bit > 0 );
-
-	if( ( string_index + value_string_length + 1 ) >= utf32_string_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-32 string is too small.",
-		 function );
-
-		return( -1 );
-	}
-	value_64bit        = internal_security_identifier->revision_number;
-	value_string_index = value_string_length;
-
-	while( value_string_index > 0 )
-	{
-		value_string_index--;
-
-		utf32_string[ string_index + value_string_index ] = (uint32_t) '0' + (uint32_t) ( value_64bit % 10 );
-
-		value_64bit /= 10;
-	}
-	string_index += value_string_length;
-
-	utf32_string[ string_index++ ] = (uint32_t) '-';
-
-	value_64bit         = internal_security_identifier->authority;
-	value_string_length = 0;
-
-	do
-	{
-		value_string_length++;
-
-		value_64bit /= 10;
-	}
-	while( value_64bit > 0 );
+	string_length = libfwnt_internal_security_identifier_get_string_length(
+	                 internal_security_identifier );
 
-	if( ( string_index + value_string_length ) >= utf32_string_size )
+	if( ( string_index >= utf32_string_size )
+	 || ( string_length >= ( utf32_string_size - string_index ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -1102,70 +2387,23 @@ int libfwnt_security_identifier_copy_to_utf32_string_with_index(
 
 		return( -1 );
 	}
-	value_64bit        = internal_security_identifier->authority;
-	value_string_index = value_string_length;
-
-	while( value_string_index > 0 )
+	if( internal_security_identifier->utf8_string_length != 0 )
 	{
-		value_string_index--;
-
-		utf32_string[ string_index + value_string_index ] = (uint32_t) '0' + (uint32_t) ( value_64bit % 10 );
-
-		value_64bit /= 10;
+		string_characters = internal_security_identifier->utf8_string;
 	}
-	string_index += value_string_length;
-
-	for( sub_authority_index = 0;
-	     sub_authority_index < internal_security_identifier->number_of_sub_authorities;
-	     sub_authority_index++ )
+	else
 	{
-		value_64bit         = internal_security_identifier->sub_authority[ sub_authority_index ];
-		value_string_length = 0;
-
-		do
-		{
-			value_string_length++;
-
-			value_64bit /= 10;
-		}
-		while( value_64bit > 0 );
-
-		if( ( string_index + value_string_length + 1 ) >= utf32_string_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-32 string is too small.",
-			 function );
+		libfwnt_internal_security_identifier_write_string(
+		 internal_security_identifier,
+		 string );
 
-			return( -1 );
-		}
-		utf32_string[ string_index++ ] = (uint32_t) '-';
-
-		value_64bit        = internal_security_identifier->sub_authority[ sub_authority_index ];
-		value_string_index = value_string_length;
-
-		while( value_string_index > 0 )
-		{
-			value_string_index--;
-
-			utf32_string[ string_index + value_string_index ] = (uint32_t) '0' + (uint32_t) ( value_64bit % 10 );
-
-			value_64bit /= 10;
-		}
-		string_index += value_string_length;
+		string_characters = string;
 	}
-	if( string_index >= utf32_string_size )
+	for( character_index = 0;
+	     character_index < string_length;
+	     character_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: UTF-32 string is too small.",
-		 function );
-
-		return( -1 );
+		utf32_string[ string_index++ ] = (uint32_t) string_characters[ character_index ];
 	}
 	utf32_string[ string_index++ ] = 0;
 
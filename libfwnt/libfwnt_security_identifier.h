@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwnt_arena.h"
 #include "libfwnt_extern.h"
 #include "libfwnt_libcerror.h"
 #include "libfwnt_types.h"
@@ -53,6 +54,11 @@ extern "C" {
  * The maximum number of sub authorities seems to be 15.
  */
 
+/* The maximum string length of a security identifier without the end of string character
+ * "S-" + 3 revision digits + "-" + 15 authority digits + 15 x ( "-" + 10 sub authority digits )
+ */
+#define LIBFWNT_SECURITY_IDENTIFIER_MAXIMUM_STRING_LENGTH	186
+
 typedef struct libfwnt_internal_security_identifier libfwnt_internal_security_identifier_t;
 
 struct libfwnt_internal_security_identifier
@@ -76,6 +82,20 @@ struct libfwnt_internal_security_identifier
 	/* Value to indicate if the identifier is managed by the descriptor
 	 */
 	uint8_t is_managed;
+
+	/* The arena the identifier was allocated from
+	 */
+	libfwnt_arena_t *arena;
+
+	/* The cached UTF-8 string
+	 */
+	uint8_t *utf8_string;
+
+	/* The cached UTF-8 string length without the end of string character
+	 * 0 if the cached UTF-8 string is not set. The string is set before
+	 * the identifier is shared between threads and not changed afterwards
+	 */
+	size_t utf8_string_length;
 };
 
 LIBFWNT_EXTERN \
@@ -83,6 +103,11 @@ int libfwnt_security_identifier_initialize(
      libfwnt_security_identifier_t **security_identifier,
      libcerror_error_t **error );
 
+int libfwnt_security_identifier_initialize_with_arena(
+     libfwnt_security_identifier_t **security_identifier,
+     libfwnt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_identifier_free(
      libfwnt_security_identifier_t **security_identifier,
@@ -100,6 +125,106 @@ int libfwnt_security_identifier_copy_from_byte_stream(
      int byte_order,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_get_data_size(
+     libfwnt_security_identifier_t *security_identifier,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_to_byte_stream(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+int libfwnt_security_identifier_read_utf8_string_value(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     size_t *utf8_string_index,
+     uint64_t maximum_value,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_from_utf8_string(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_compare_with_byte_stream(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_compare(
+     libfwnt_security_identifier_t *first_security_identifier,
+     libfwnt_security_identifier_t *second_security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_is_equal(
+     libfwnt_security_identifier_t *first_security_identifier,
+     libfwnt_security_identifier_t *second_security_identifier,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_copy_values(
+     libfwnt_internal_security_identifier_t *destination_security_identifier,
+     libfwnt_internal_security_identifier_t *source_security_identifier,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_set_values(
+     libfwnt_internal_security_identifier_t *destination_security_identifier,
+     libfwnt_internal_security_identifier_t *source_security_identifier,
+     libcerror_error_t **error );
+
+uint64_t libfwnt_internal_security_identifier_get_hash(
+          libfwnt_internal_security_identifier_t *internal_security_identifier );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_get_hash(
+     libfwnt_security_identifier_t *security_identifier,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_to_key(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_get_well_known_type(
+     libfwnt_security_identifier_t *security_identifier,
+     int *well_known_type,
+     libcerror_error_t **error );
+
+size_t libfwnt_security_identifier_get_number_of_decimal_digits(
+        uint64_t value_64bit );
+
+size_t libfwnt_internal_security_identifier_get_string_length(
+        libfwnt_internal_security_identifier_t *internal_security_identifier );
+
+size_t libfwnt_security_identifier_write_decimal_value(
+        uint8_t *string,
+        uint64_t value_64bit );
+
+size_t libfwnt_internal_security_identifier_write_string(
+        libfwnt_internal_security_identifier_t *internal_security_identifier,
+        uint8_t *string );
+
+int libfwnt_internal_security_identifier_get_cached_utf8_string(
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_identifier_get_string_size(
      libfwnt_security_identifier_t *security_identifier,
@@ -124,6 +249,22 @@ int libfwnt_security_identifier_copy_to_utf8_string_with_index(
      uint32_t string_format_flags,
      libcerror_error_t **error );
 
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_copy_to_utf8_string_with_size(
+     libfwnt_security_identifier_t *security_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *string_size,
+     uint32_t string_format_flags,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_get_utf8_string_reference(
+     libfwnt_security_identifier_t *security_identifier,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
 LIBFWNT_EXTERN \
 int libfwnt_security_identifier_copy_to_utf16_string(
      libfwnt_security_identifier_t *security_identifier,
@@ -0,0 +1,1115 @@
+/*
+ * Windows NT Security Identifier pool functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_allocator.h"
+#include "libfwnt_arena.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_security_identifier_pool.h"
+#include "libfwnt_types.h"
+
+/* Creates a security identifier pool
+ * Make sure the value security_identifier_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_initialize(
+     libfwnt_security_identifier_pool_t **security_identifier_pool,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool = NULL;
+	static char *function                                                          = "libfwnt_security_identifier_pool_initialize";
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security identifier pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_pool = libfwnt_allocator_allocate_structure(
+	                                     libfwnt_internal_security_identifier_pool_t );
+
+	if( internal_security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security identifier pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_security_identifier_pool,
+	     0,
+	     sizeof( libfwnt_internal_security_identifier_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security identifier pool.",
+		 function );
+
+		libfwnt_allocator_free(
+		 internal_security_identifier_pool );
+
+		return( -1 );
+	}
+	if( libfwnt_arena_initialize(
+	     &( internal_security_identifier_pool->arena ),
+	     LIBFWNT_ARENA_DEFAULT_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwnt_internal_security_identifier_pool_resize_buckets(
+	     internal_security_identifier_pool,
+	     64,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_security_identifier_pool->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*security_identifier_pool = (libfwnt_security_identifier_pool_t *) internal_security_identifier_pool;
+
+	return( 1 );
+
+on_error:
+	if( internal_security_identifier_pool != NULL )
+	{
+		if( internal_security_identifier_pool->buckets != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_security_identifier_pool->buckets );
+		}
+		if( internal_security_identifier_pool->arena != NULL )
+		{
+			libfwnt_arena_free(
+			 &( internal_security_identifier_pool->arena ),
+			 NULL );
+		}
+		libfwnt_allocator_free(
+		 internal_security_identifier_pool );
+	}
+	return( -1 );
+}
+
+/* Frees a security identifier pool
+ * This also frees the security identifiers stored in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_free(
+     libfwnt_security_identifier_pool_t **security_identifier_pool,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool = NULL;
+	static char *function                                                          = "libfwnt_security_identifier_pool_free";
+	int result                                                                     = 1;
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_identifier_pool != NULL )
+	{
+		internal_security_identifier_pool = (libfwnt_internal_security_identifier_pool_t *) *security_identifier_pool;
+		*security_identifier_pool         = NULL;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_security_identifier_pool->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The security identifiers and their strings are allocated from
+		 * the arena and are freed with it
+		 */
+		if( libfwnt_arena_free(
+		     &( internal_security_identifier_pool->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_security_identifier_pool->security_identifiers != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_security_identifier_pool->security_identifiers );
+		}
+		if( internal_security_identifier_pool->hashes != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_security_identifier_pool->hashes );
+		}
+		if( internal_security_identifier_pool->buckets != NULL )
+		{
+			libfwnt_allocator_free(
+			 internal_security_identifier_pool->buckets );
+		}
+		libfwnt_allocator_free(
+		 internal_security_identifier_pool );
+	}
+	return( result );
+}
+
+/* Finds a security identifier in the pool
+ * Returns the handle or -1 if not available
+ */
+int libfwnt_internal_security_identifier_pool_find(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     uint64_t hash )
+{
+	size_t bucket_index = 0;
+	size_t bucket_mask  = 0;
+	int handle          = 0;
+
+	bucket_mask  = internal_security_identifier_pool->number_of_buckets - 1;
+	bucket_index = (size_t) hash & bucket_mask;
+
+	while( internal_security_identifier_pool->buckets[ bucket_index ] != 0 )
+	{
+		handle = internal_security_identifier_pool->buckets[ bucket_index ] - 1;
+
+		if( ( internal_security_identifier_pool->hashes[ handle ] == hash )
+		 && ( libfwnt_security_identifier_is_equal(
+		       (libfwnt_security_identifier_t *) internal_security_identifier_pool->security_identifiers[ handle ],
+		       (libfwnt_security_identifier_t *) internal_security_identifier,
+		       NULL ) == 1 ) )
+		{
+			return( handle );
+		}
+		bucket_index = ( bucket_index + 1 ) & bucket_mask;
+	}
+	return( -1 );
+}
+
+/* Resizes the hash buckets
+ * The number of buckets must be a power of 2 and larger than the number of security identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_pool_resize_buckets(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     size_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	int *buckets          = NULL;
+	static char *function = "libfwnt_internal_security_identifier_pool_resize_buckets";
+	size_t bucket_index   = 0;
+	size_t bucket_mask    = 0;
+	size_t buckets_size   = 0;
+	int handle            = 0;
+
+	if( internal_security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= (size_t) internal_security_identifier_pool->number_of_security_identifiers )
+	 || ( number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets_size = sizeof( int ) * number_of_buckets;
+
+	buckets = (int *) libfwnt_allocator_allocate(
+	                   buckets_size );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		libfwnt_allocator_free(
+		 buckets );
+
+		return( -1 );
+	}
+	bucket_mask = number_of_buckets - 1;
+
+	for( handle = 0;
+	     handle < internal_security_identifier_pool->number_of_security_identifiers;
+	     handle++ )
+	{
+		bucket_index = (size_t) internal_security_identifier_pool->hashes[ handle ] & bucket_mask;
+
+		while( buckets[ bucket_index ] != 0 )
+		{
+			bucket_index = ( bucket_index + 1 ) & bucket_mask;
+		}
+		buckets[ bucket_index ] = handle + 1;
+	}
+	if( internal_security_identifier_pool->buckets != NULL )
+	{
+		libfwnt_allocator_free(
+		 internal_security_identifier_pool->buckets );
+	}
+	internal_security_identifier_pool->buckets           = buckets;
+	internal_security_identifier_pool->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Appends a copy of a security identifier to the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_pool_append(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     uint64_t hash,
+     int *handle,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t **security_identifiers   = NULL;
+	libfwnt_internal_security_identifier_t *new_security_identifier = NULL;
+	static char *function                                           = "libfwnt_internal_security_identifier_pool_append";
+	size_t bucket_index                                             = 0;
+	size_t bucket_mask                                              = 0;
+	uint64_t *hashes                                                = NULL;
+	int number_of_allocated_security_identifiers                    = 0;
+	int safe_handle                                                 = 0;
+
+	if( internal_security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	safe_handle = internal_security_identifier_pool->number_of_security_identifiers;
+
+	if( safe_handle >= ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of security identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_handle >= internal_security_identifier_pool->number_of_allocated_security_identifiers )
+	{
+		number_of_allocated_security_identifiers = internal_security_identifier_pool->number_of_allocated_security_identifiers * 2;
+
+		if( number_of_allocated_security_identifiers < 32 )
+		{
+			number_of_allocated_security_identifiers = 32;
+		}
+		security_identifiers = (libfwnt_internal_security_identifier_t **) libfwnt_allocator_reallocate(
+		                                                                    internal_security_identifier_pool->security_identifiers,
+		                                                                    sizeof( libfwnt_internal_security_identifier_t * ) * number_of_allocated_security_identifiers );
+
+		if( security_identifiers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize security identifiers.",
+			 function );
+
+			return( -1 );
+		}
+		internal_security_identifier_pool->security_identifiers = security_identifiers;
+
+		hashes = (uint64_t *) libfwnt_allocator_reallocate(
+		                       internal_security_identifier_pool->hashes,
+		                       sizeof( uint64_t ) * number_of_allocated_security_identifiers );
+
+		if( hashes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize hashes.",
+			 function );
+
+			return( -1 );
+		}
+		internal_security_identifier_pool->hashes                                   = hashes;
+		internal_security_identifier_pool->number_of_allocated_security_identifiers = number_of_allocated_security_identifiers;
+	}
+	/* Keep the buckets at most half full to keep the probe sequences short
+	 */
+	if( ( (size_t) safe_handle + 1 ) > ( internal_security_identifier_pool->number_of_buckets / 2 ) )
+	{
+		if( libfwnt_internal_security_identifier_pool_resize_buckets(
+		     internal_security_identifier_pool,
+		     internal_security_identifier_pool->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwnt_security_identifier_initialize_with_arena(
+	     (libfwnt_security_identifier_t **) &new_security_identifier,
+	     internal_security_identifier_pool->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	new_security_identifier->revision_number           = internal_security_identifier->revision_number;
+	new_security_identifier->authority                 = internal_security_identifier->authority;
+	new_security_identifier->number_of_sub_authorities = internal_security_identifier->number_of_sub_authorities;
+	new_security_identifier->is_managed                = 1;
+
+	if( new_security_identifier->number_of_sub_authorities > 0 )
+	{
+		if( memory_copy(
+		     new_security_identifier->sub_authority,
+		     internal_security_identifier->sub_authority,
+		     sizeof( uint32_t ) * new_security_identifier->number_of_sub_authorities ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy sub authorities.",
+			 function );
+
+			libfwnt_internal_security_identifier_free(
+			 &new_security_identifier,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	/* The security identifiers are shared between threads, hence the string
+	 * is formatted before the security identifier is added
+	 */
+	if( libfwnt_internal_security_identifier_get_cached_utf8_string(
+	     new_security_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached UTF-8 string.",
+		 function );
+
+		libfwnt_internal_security_identifier_free(
+		 &new_security_identifier,
+		 NULL );
+
+		return( -1 );
+	}
+	internal_security_identifier_pool->security_identifiers[ safe_handle ] = new_security_identifier;
+	internal_security_identifier_pool->hashes[ safe_handle ]               = hash;
+
+	bucket_mask  = internal_security_identifier_pool->number_of_buckets - 1;
+	bucket_index = (size_t) hash & bucket_mask;
+
+	while( internal_security_identifier_pool->buckets[ bucket_index ] != 0 )
+	{
+		bucket_index = ( bucket_index + 1 ) & bucket_mask;
+	}
+	internal_security_identifier_pool->buckets[ bucket_index ] = safe_handle + 1;
+
+	internal_security_identifier_pool->number_of_security_identifiers += 1;
+
+	*handle = safe_handle;
+
+	return( 1 );
+}
+
+/* Retrieves the handle of a security identifier and adds it to the pool if needed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_internal_security_identifier_pool_intern(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     int *handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_internal_security_identifier_pool_intern";
+	uint64_t hash         = 0;
+	int result            = 1;
+	int safe_handle       = 0;
+
+	if( internal_security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	hash = libfwnt_internal_security_identifier_get_hash(
+	        internal_security_identifier );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* Most security identifiers are already in the pool, hence look them up
+	 * while allowing other readers
+	 */
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	safe_handle = libfwnt_internal_security_identifier_pool_find(
+	               internal_security_identifier_pool,
+	               internal_security_identifier,
+	               hash );
+
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_handle != -1 )
+	{
+		*handle = safe_handle;
+
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have added the same security identifier in the mean time
+	 */
+	safe_handle = libfwnt_internal_security_identifier_pool_find(
+	               internal_security_identifier_pool,
+	               internal_security_identifier,
+	               hash );
+
+	if( safe_handle == -1 )
+	{
+		result = libfwnt_internal_security_identifier_pool_append(
+		          internal_security_identifier_pool,
+		          internal_security_identifier,
+		          hash,
+		          &safe_handle,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append security identifier.",
+			 function );
+		}
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*handle = safe_handle;
+	}
+	return( result );
+}
+
+/* Retrieves the handle of a security identifier stored in a byte stream
+ * The security identifier is added to the pool if it is not stored yet
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_intern_byte_stream(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     int *handle,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t security_identifier;
+
+	static char *function = "libfwnt_security_identifier_pool_intern_byte_stream";
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* The security identifier is read into a temporary value so that
+	 * no allocation is needed when it is already stored in the pool
+	 */
+	if( memory_set(
+	     &security_identifier,
+	     0,
+	     sizeof( libfwnt_internal_security_identifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     (libfwnt_security_identifier_t *) &security_identifier,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_identifier_pool_intern(
+	     (libfwnt_internal_security_identifier_pool_t *) security_identifier_pool,
+	     &security_identifier,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the handle of a security identifier
+ * A copy of the security identifier is added to the pool if it is not stored yet
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_intern_security_identifier(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     libfwnt_security_identifier_t *security_identifier,
+     int *handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwnt_security_identifier_pool_intern_security_identifier";
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_internal_security_identifier_pool_intern(
+	     (libfwnt_internal_security_identifier_pool_t *) security_identifier_pool,
+	     (libfwnt_internal_security_identifier_t *) security_identifier,
+	     handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security identifier handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of security identifiers stored in the pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool = NULL;
+	static char *function                                                          = "libfwnt_security_identifier_pool_get_number_of_security_identifiers";
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_pool = (libfwnt_internal_security_identifier_pool_t *) security_identifier_pool;
+
+	if( number_of_security_identifiers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of security identifiers.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_security_identifiers = internal_security_identifier_pool->number_of_security_identifiers;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the security identifier of a specific handle
+ * The security identifier is owned by the pool and must not be modified,
+ * freeing it only clears the reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_get_security_identifier(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     int handle,
+     libfwnt_security_identifier_t **security_identifier,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool = NULL;
+	static char *function                                                          = "libfwnt_security_identifier_pool_get_security_identifier";
+	int result                                                                     = 1;
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_pool = (libfwnt_internal_security_identifier_pool_t *) security_identifier_pool;
+
+	if( security_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( handle < 0 )
+	 || ( handle >= internal_security_identifier_pool->number_of_security_identifiers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*security_identifier = (libfwnt_security_identifier_t *) internal_security_identifier_pool->security_identifiers[ handle ];
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the UTF-8 formatted string of the security identifier of a specific handle
+ * The string is formatted when the security identifier is added to the pool
+ * and remains valid until the pool is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwnt_security_identifier_pool_get_utf8_string(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     int handle,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool = NULL;
+	libfwnt_internal_security_identifier_t *internal_security_identifier           = NULL;
+	static char *function                                                          = "libfwnt_security_identifier_pool_get_utf8_string";
+	int result                                                                     = 1;
+
+	if( security_identifier_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security identifier pool.",
+		 function );
+
+		return( -1 );
+	}
+	internal_security_identifier_pool = (libfwnt_internal_security_identifier_pool_t *) security_identifier_pool;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( handle < 0 )
+	 || ( handle >= internal_security_identifier_pool->number_of_security_identifiers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		internal_security_identifier = internal_security_identifier_pool->security_identifiers[ handle ];
+
+		*utf8_string        = internal_security_identifier->utf8_string;
+		*utf8_string_length = internal_security_identifier->utf8_string_length;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_security_identifier_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
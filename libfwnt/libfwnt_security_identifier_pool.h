@@ -0,0 +1,157 @@
+/*
+ * Windows NT Security Identifier pool functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_INTERNAL_SECURITY_IDENTIFIER_POOL_H )
+#define _LIBFWNT_INTERNAL_SECURITY_IDENTIFIER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_libcthreads.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A security identifier pool stores every distinct security identifier once
+ * and refers to it by a handle, which is the index of the security identifier
+ * in the pool. Handles remain valid until the pool is freed.
+ */
+
+typedef struct libfwnt_internal_security_identifier_pool libfwnt_internal_security_identifier_pool_t;
+
+struct libfwnt_internal_security_identifier_pool
+{
+	/* The arena the security identifiers are allocated from
+	 */
+	libfwnt_arena_t *arena;
+
+	/* The security identifiers
+	 */
+	libfwnt_internal_security_identifier_t **security_identifiers;
+
+	/* The hashes of the security identifiers
+	 */
+	uint64_t *hashes;
+
+	/* The number of security identifiers
+	 */
+	int number_of_security_identifiers;
+
+	/* The number of allocated security identifiers
+	 */
+	int number_of_allocated_security_identifiers;
+
+	/* The hash buckets, which contain the handle + 1 or 0 if not set
+	 */
+	int *buckets;
+
+	/* The number of hash buckets, this is a power of 2
+	 */
+	size_t number_of_buckets;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_initialize(
+     libfwnt_security_identifier_pool_t **security_identifier_pool,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_free(
+     libfwnt_security_identifier_pool_t **security_identifier_pool,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_pool_find(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     uint64_t hash );
+
+int libfwnt_internal_security_identifier_pool_resize_buckets(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     size_t number_of_buckets,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_pool_append(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     uint64_t hash,
+     int *handle,
+     libcerror_error_t **error );
+
+int libfwnt_internal_security_identifier_pool_intern(
+     libfwnt_internal_security_identifier_pool_t *internal_security_identifier_pool,
+     libfwnt_internal_security_identifier_t *internal_security_identifier,
+     int *handle,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_intern_byte_stream(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     int *handle,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_intern_security_identifier(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     libfwnt_security_identifier_t *security_identifier,
+     int *handle,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     int *number_of_security_identifiers,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_get_security_identifier(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     int handle,
+     libfwnt_security_identifier_t **security_identifier,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+int libfwnt_security_identifier_pool_get_utf8_string(
+     libfwnt_security_identifier_pool_t *security_identifier_pool,
+     int handle,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_INTERNAL_SECURITY_IDENTIFIER_POOL_H ) */
+
@@ -34,19 +34,105 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfwnt_access_check_plan {}	libfwnt_access_check_plan_t;
 typedef struct libfwnt_access_control_entry {}	libfwnt_access_control_entry_t;
 typedef struct libfwnt_access_control_list {}	libfwnt_access_control_list_t;
+typedef struct libfwnt_access_token {}		libfwnt_access_token_t;
+typedef struct libfwnt_arena {}			libfwnt_arena_t;
 typedef struct libfwnt_security_descriptor {}	libfwnt_security_descriptor_t;
+typedef struct libfwnt_security_descriptor_cache {}	libfwnt_security_descriptor_cache_t;
+typedef struct libfwnt_security_descriptor_view {}	libfwnt_security_descriptor_view_t;
 typedef struct libfwnt_security_identifier {}	libfwnt_security_identifier_t;
+typedef struct libfwnt_security_identifier_pool {}	libfwnt_security_identifier_pool_t;
 
 #else
+typedef intptr_t libfwnt_access_check_plan_t;
 typedef intptr_t libfwnt_access_control_entry_t;
 typedef intptr_t libfwnt_access_control_list_t;
+typedef intptr_t libfwnt_access_token_t;
+typedef intptr_t libfwnt_arena_t;
 typedef intptr_t libfwnt_security_descriptor_t;
+typedef intptr_t libfwnt_security_descriptor_cache_t;
+typedef intptr_t libfwnt_security_descriptor_view_t;
 typedef intptr_t libfwnt_security_identifier_t;
+typedef intptr_t libfwnt_security_identifier_pool_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The locale identifier (LCID) language tag values
+ */
+typedef struct libfwnt_locale_identifier_language_tag libfwnt_locale_identifier_language_tag_t;
+
+struct libfwnt_locale_identifier_language_tag
+{
+	/* The LCID language tag value
+	 */
+	uint16_t lcid_language_tag;
+
+	/* The identifier
+	 */
+	const char *identifier;
+
+	/* The description
+	 */
+	const char *description;
+};
+
+/* The locale identifier (LCID) values
+ */
+typedef struct libfwnt_locale_identifier_values libfwnt_locale_identifier_values_t;
+
+struct libfwnt_locale_identifier_values
+{
+	/* The LCID
+	 */
+	uint32_t lcid;
+
+	/* The language tag (LANGID)
+	 */
+	uint16_t language_tag;
+
+	/* The primary language
+	 */
+	uint16_t primary_language;
+
+	/* The sub language
+	 */
+	uint8_t sub_language;
+
+	/* The sort identifier
+	 */
+	uint8_t sort_identifier;
+
+	/* The sort version
+	 */
+	uint8_t sort_version;
+
+	/* The language tag identifier
+	 */
+	const char *identifier;
+
+	/* The language tag description
+	 */
+	const char *description;
+
+	/* The neutral language tag or 0 if not available
+	 */
+	uint16_t neutral_language_tag;
+
+	/* The neutral language tag identifier or NULL if not available
+	 */
+	const char *neutral_identifier;
+
+	/* The sort suffix or NULL if not available
+	 */
+	const char *sort_suffix;
+
+	/* The sort description or NULL if not available
+	 */
+	const char *sort_description;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBFWNT ) */
 
 #endif /* !defined( _LIBFWNT_INTERNAL_TYPES_H ) */
@@ -0,0 +1,669 @@
+/*
+ * Well-known security identifier (SID) functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier.h"
+#include "libfwnt_well_known_security_identifier.h"
+
+/* The well-known security identifiers, indexed by type
+ */
+const libfwnt_well_known_security_identifier_t libfwnt_well_known_security_identifiers[ LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_NUMBER_OF_TYPES ] = {
+	{ LIBFWNT_WELL_KNOWN_SID_UNKNOWN, NULL, NULL, NULL },
+	{ LIBFWNT_WELL_KNOWN_SID_NULL, NULL, "S-1-0-0", "Null SID" },
+	{ LIBFWNT_WELL_KNOWN_SID_WORLD, "WD", "S-1-1-0", "Everyone" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOCAL, NULL, "S-1-2-0", "Local" },
+	{ LIBFWNT_WELL_KNOWN_SID_CONSOLE_LOGON, NULL, "S-1-2-1", "Console Logon" },
+	{ LIBFWNT_WELL_KNOWN_SID_CREATOR_OWNER, "CO", "S-1-3-0", "Creator Owner" },
+	{ LIBFWNT_WELL_KNOWN_SID_CREATOR_GROUP, "CG", "S-1-3-1", "Creator Group" },
+	{ LIBFWNT_WELL_KNOWN_SID_CREATOR_OWNER_SERVER, NULL, "S-1-3-2", "Creator Owner Server" },
+	{ LIBFWNT_WELL_KNOWN_SID_CREATOR_GROUP_SERVER, NULL, "S-1-3-3", "Creator Group Server" },
+	{ LIBFWNT_WELL_KNOWN_SID_OWNER_RIGHTS, "OW", "S-1-3-4", "Owner Rights" },
+	{ LIBFWNT_WELL_KNOWN_SID_DIALUP, NULL, "S-1-5-1", "Dialup" },
+	{ LIBFWNT_WELL_KNOWN_SID_NETWORK, "NU", "S-1-5-2", "Network" },
+	{ LIBFWNT_WELL_KNOWN_SID_BATCH, NULL, "S-1-5-3", "Batch" },
+	{ LIBFWNT_WELL_KNOWN_SID_INTERACTIVE, "IU", "S-1-5-4", "Interactive" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOGON_SESSION, NULL, NULL, "Logon Session" },
+	{ LIBFWNT_WELL_KNOWN_SID_SERVICE, "SU", "S-1-5-6", "Service" },
+	{ LIBFWNT_WELL_KNOWN_SID_ANONYMOUS, "AN", "S-1-5-7", "Anonymous Logon" },
+	{ LIBFWNT_WELL_KNOWN_SID_PROXY, NULL, "S-1-5-8", "Proxy" },
+	{ LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_DOMAIN_CONTROLLERS, "ED", "S-1-5-9", "Enterprise Domain Controllers" },
+	{ LIBFWNT_WELL_KNOWN_SID_PRINCIPAL_SELF, "PS", "S-1-5-10", "Principal Self" },
+	{ LIBFWNT_WELL_KNOWN_SID_AUTHENTICATED_USERS, "AU", "S-1-5-11", "Authenticated Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_RESTRICTED_CODE, "RC", "S-1-5-12", "Restricted Code" },
+	{ LIBFWNT_WELL_KNOWN_SID_TERMINAL_SERVER_USERS, NULL, "S-1-5-13", "Terminal Server Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_REMOTE_INTERACTIVE_LOGON, NULL, "S-1-5-14", "Remote Interactive Logon" },
+	{ LIBFWNT_WELL_KNOWN_SID_THIS_ORGANIZATION, NULL, "S-1-5-15", "This Organization" },
+	{ LIBFWNT_WELL_KNOWN_SID_IUSR, NULL, "S-1-5-17", "IUSR" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOCAL_SYSTEM, "SY", "S-1-5-18", "Local System" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOCAL_SERVICE, "LS", "S-1-5-19", "Local Service" },
+	{ LIBFWNT_WELL_KNOWN_SID_NETWORK_SERVICE, "NS", "S-1-5-20", "Network Service" },
+	{ LIBFWNT_WELL_KNOWN_SID_WRITE_RESTRICTED_CODE, "WR", "S-1-5-33", "Write Restricted Code" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_ADMINISTRATORS, "BA", "S-1-5-32-544", "Administrators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_USERS, "BU", "S-1-5-32-545", "Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_GUESTS, "BG", "S-1-5-32-546", "Guests" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_POWER_USERS, "PU", "S-1-5-32-547", "Power Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_ACCOUNT_OPERATORS, "AO", "S-1-5-32-548", "Account Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_SERVER_OPERATORS, "SO", "S-1-5-32-549", "Server Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_PRINT_OPERATORS, "PO", "S-1-5-32-550", "Print Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_BACKUP_OPERATORS, "BO", "S-1-5-32-551", "Backup Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_REPLICATOR, "RE", "S-1-5-32-552", "Replicator" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_PRE_WINDOWS_2000_COMPATIBLE_ACCESS, "RU", "S-1-5-32-554", "Pre-Windows 2000 Compatible Access" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_REMOTE_DESKTOP_USERS, "RD", "S-1-5-32-555", "Remote Desktop Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_NETWORK_CONFIGURATION_OPERATORS, "NO", "S-1-5-32-556", "Network Configuration Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_PERFORMANCE_MONITOR_USERS, "MU", "S-1-5-32-558", "Performance Monitor Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_PERFORMANCE_LOG_USERS, "LU", "S-1-5-32-559", "Performance Log Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_DISTRIBUTED_COM_USERS, NULL, "S-1-5-32-562", "Distributed COM Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_IIS_IUSRS, "IS", "S-1-5-32-568", "IIS_IUSRS" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_CRYPTOGRAPHIC_OPERATORS, "CY", "S-1-5-32-569", "Cryptographic Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_EVENT_LOG_READERS, "ER", "S-1-5-32-573", "Event Log Readers" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_CERTIFICATE_SERVICE_DCOM_ACCESS, "CD", "S-1-5-32-574", "Certificate Service DCOM Access" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_RDS_REMOTE_ACCESS_SERVERS, "RA", "S-1-5-32-575", "RDS Remote Access Servers" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_RDS_ENDPOINT_SERVERS, "ES", "S-1-5-32-576", "RDS Endpoint Servers" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_RDS_MANAGEMENT_SERVERS, "MS", "S-1-5-32-577", "RDS Management Servers" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_HYPER_V_ADMINISTRATORS, "HA", "S-1-5-32-578", "Hyper-V Administrators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_ACCESS_CONTROL_ASSISTANCE_OPERATORS, "AA", "S-1-5-32-579", "Access Control Assistance Operators" },
+	{ LIBFWNT_WELL_KNOWN_SID_BUILTIN_REMOTE_MANAGEMENT_USERS, "RM", "S-1-5-32-580", "Remote Management Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_NTLM_AUTHENTICATION, NULL, "S-1-5-64-10", "NTLM Authentication" },
+	{ LIBFWNT_WELL_KNOWN_SID_SCHANNEL_AUTHENTICATION, NULL, "S-1-5-64-14", "SChannel Authentication" },
+	{ LIBFWNT_WELL_KNOWN_SID_DIGEST_AUTHENTICATION, NULL, "S-1-5-64-21", "Digest Authentication" },
+	{ LIBFWNT_WELL_KNOWN_SID_ALL_SERVICES, NULL, "S-1-5-80-0", "All Services" },
+	{ LIBFWNT_WELL_KNOWN_SID_USER_MODE_DRIVERS, "UD", "S-1-5-84-0-0-0-0-0", "User Mode Drivers" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOCAL_ACCOUNT, NULL, "S-1-5-113", "Local Account" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOCAL_ACCOUNT_AND_ADMINISTRATOR, NULL, "S-1-5-114", "Local Account and Member of Administrators Group" },
+	{ LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_READ_ONLY_DOMAIN_CONTROLLERS, NULL, NULL, "Enterprise Read-only Domain Controllers" },
+	{ LIBFWNT_WELL_KNOWN_SID_ADMINISTRATOR, "LA", NULL, "Administrator" },
+	{ LIBFWNT_WELL_KNOWN_SID_GUEST, "LG", NULL, "Guest" },
+	{ LIBFWNT_WELL_KNOWN_SID_KRBTGT, NULL, NULL, "krbtgt" },
+	{ LIBFWNT_WELL_KNOWN_SID_DOMAIN_ADMINS, "DA", NULL, "Domain Admins" },
+	{ LIBFWNT_WELL_KNOWN_SID_DOMAIN_USERS, "DU", NULL, "Domain Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_DOMAIN_GUESTS, "DG", NULL, "Domain Guests" },
+	{ LIBFWNT_WELL_KNOWN_SID_DOMAIN_COMPUTERS, "DC", NULL, "Domain Computers" },
+	{ LIBFWNT_WELL_KNOWN_SID_DOMAIN_CONTROLLERS, "DD", NULL, "Domain Controllers" },
+	{ LIBFWNT_WELL_KNOWN_SID_CERT_PUBLISHERS, "CA", NULL, "Cert Publishers" },
+	{ LIBFWNT_WELL_KNOWN_SID_SCHEMA_ADMINS, "SA", NULL, "Schema Admins" },
+	{ LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_ADMINS, "EA", NULL, "Enterprise Admins" },
+	{ LIBFWNT_WELL_KNOWN_SID_GROUP_POLICY_CREATOR_OWNERS, "PA", NULL, "Group Policy Creator Owners" },
+	{ LIBFWNT_WELL_KNOWN_SID_READ_ONLY_DOMAIN_CONTROLLERS, "RO", NULL, "Read-only Domain Controllers" },
+	{ LIBFWNT_WELL_KNOWN_SID_CLONEABLE_DOMAIN_CONTROLLERS, "CN", NULL, "Cloneable Domain Controllers" },
+	{ LIBFWNT_WELL_KNOWN_SID_PROTECTED_USERS, "AP", NULL, "Protected Users" },
+	{ LIBFWNT_WELL_KNOWN_SID_KEY_ADMINS, "KA", NULL, "Key Admins" },
+	{ LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_KEY_ADMINS, "EK", NULL, "Enterprise Key Admins" },
+	{ LIBFWNT_WELL_KNOWN_SID_RAS_SERVERS, "RS", NULL, "RAS and IAS Servers" },
+	{ LIBFWNT_WELL_KNOWN_SID_ALL_APPLICATION_PACKAGES, "AC", "S-1-15-2-1", "All Application Packages" },
+	{ LIBFWNT_WELL_KNOWN_SID_ALL_RESTRICTED_APPLICATION_PACKAGES, NULL, "S-1-15-2-2", "All Restricted Application Packages" },
+	{ LIBFWNT_WELL_KNOWN_SID_APPLICATION_CONTAINER, NULL, NULL, "Application Container" },
+	{ LIBFWNT_WELL_KNOWN_SID_CAPABILITY, NULL, NULL, "Capability" },
+	{ LIBFWNT_WELL_KNOWN_SID_UNTRUSTED_MANDATORY_LEVEL, NULL, "S-1-16-0", "Untrusted Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_LOW_MANDATORY_LEVEL, "LW", "S-1-16-4096", "Low Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_MEDIUM_MANDATORY_LEVEL, "ME", "S-1-16-8192", "Medium Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_MEDIUM_PLUS_MANDATORY_LEVEL, "MP", "S-1-16-8448", "Medium Plus Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_HIGH_MANDATORY_LEVEL, "HI", "S-1-16-12288", "High Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_SYSTEM_MANDATORY_LEVEL, "SI", "S-1-16-16384", "System Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_PROTECTED_PROCESS_MANDATORY_LEVEL, NULL, "S-1-16-20480", "Protected Process Mandatory Level" },
+	{ LIBFWNT_WELL_KNOWN_SID_AUTHENTICATION_AUTHORITY_ASSERTED_IDENTITY, "AS", "S-1-18-1", "Authentication Authority Asserted Identity" },
+	{ LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY, "SS", "S-1-18-2", "Service Asserted Identity" } };
+
+/* Determines the well-known type of a security identifier
+ * The lookup only uses switch statements that the compiler turns into jump tables
+ * Returns the well-known type or LIBFWNT_WELL_KNOWN_SID_UNKNOWN if not well-known
+ */
+int libfwnt_well_known_security_identifier_get_type(
+     libfwnt_internal_security_identifier_t *internal_security_identifier )
+{
+	const uint32_t *sub_authority     = NULL;
+	uint8_t number_of_sub_authorities = 0;
+
+	if( ( internal_security_identifier == NULL )
+	 || ( internal_security_identifier->revision_number != 1 )
+	 || ( internal_security_identifier->number_of_sub_authorities == 0 ) )
+	{
+		return( LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+	}
+	number_of_sub_authorities = internal_security_identifier->number_of_sub_authorities;
+	sub_authority             = internal_security_identifier->sub_authority;
+
+	switch( internal_security_identifier->authority )
+	{
+		case LIBFWNT_AUTHORITY_NULL:
+			if( ( number_of_sub_authorities == 1 )
+			 && ( sub_authority[ 0 ] == 0 ) )
+			{
+				return( LIBFWNT_WELL_KNOWN_SID_NULL );
+			}
+			break;
+
+		case LIBFWNT_AUTHORITY_WORLD:
+			if( ( number_of_sub_authorities == 1 )
+			 && ( sub_authority[ 0 ] == 0 ) )
+			{
+				return( LIBFWNT_WELL_KNOWN_SID_WORLD );
+			}
+			break;
+
+		case LIBFWNT_AUTHORITY_LOCAL:
+			if( number_of_sub_authorities == 1 )
+			{
+				switch( sub_authority[ 0 ] )
+				{
+					case 0:
+						return( LIBFWNT_WELL_KNOWN_SID_LOCAL );
+
+					case 1:
+						return( LIBFWNT_WELL_KNOWN_SID_CONSOLE_LOGON );
+				}
+			}
+			break;
+
+		case LIBFWNT_AUTHORITY_CREATOR:
+			if( number_of_sub_authorities == 1 )
+			{
+				switch( sub_authority[ 0 ] )
+				{
+					case 0:
+						return( LIBFWNT_WELL_KNOWN_SID_CREATOR_OWNER );
+
+					case 1:
+						return( LIBFWNT_WELL_KNOWN_SID_CREATOR_GROUP );
+
+					case 2:
+						return( LIBFWNT_WELL_KNOWN_SID_CREATOR_OWNER_SERVER );
+
+					case 3:
+						return( LIBFWNT_WELL_KNOWN_SID_CREATOR_GROUP_SERVER );
+
+					case 4:
+						return( LIBFWNT_WELL_KNOWN_SID_OWNER_RIGHTS );
+				}
+			}
+			break;
+
+		case LIBFWNT_AUTHORITY_NT_AUTHORITY:
+			switch( number_of_sub_authorities )
+			{
+				case 1:
+					switch( sub_authority[ 0 ] )
+					{
+						case 1:
+							return( LIBFWNT_WELL_KNOWN_SID_DIALUP );
+
+						case 2:
+							return( LIBFWNT_WELL_KNOWN_SID_NETWORK );
+
+						case 3:
+							return( LIBFWNT_WELL_KNOWN_SID_BATCH );
+
+						case 4:
+							return( LIBFWNT_WELL_KNOWN_SID_INTERACTIVE );
+
+						case 6:
+							return( LIBFWNT_WELL_KNOWN_SID_SERVICE );
+
+						case 7:
+							return( LIBFWNT_WELL_KNOWN_SID_ANONYMOUS );
+
+						case 8:
+							return( LIBFWNT_WELL_KNOWN_SID_PROXY );
+
+						case 9:
+							return( LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_DOMAIN_CONTROLLERS );
+
+						case 10:
+							return( LIBFWNT_WELL_KNOWN_SID_PRINCIPAL_SELF );
+
+						case 11:
+							return( LIBFWNT_WELL_KNOWN_SID_AUTHENTICATED_USERS );
+
+						case 12:
+							return( LIBFWNT_WELL_KNOWN_SID_RESTRICTED_CODE );
+
+						case 13:
+							return( LIBFWNT_WELL_KNOWN_SID_TERMINAL_SERVER_USERS );
+
+						case 14:
+							return( LIBFWNT_WELL_KNOWN_SID_REMOTE_INTERACTIVE_LOGON );
+
+						case 15:
+							return( LIBFWNT_WELL_KNOWN_SID_THIS_ORGANIZATION );
+
+						case 17:
+							return( LIBFWNT_WELL_KNOWN_SID_IUSR );
+
+						case 18:
+							return( LIBFWNT_WELL_KNOWN_SID_LOCAL_SYSTEM );
+
+						case 19:
+							return( LIBFWNT_WELL_KNOWN_SID_LOCAL_SERVICE );
+
+						case 20:
+							return( LIBFWNT_WELL_KNOWN_SID_NETWORK_SERVICE );
+
+						case 33:
+							return( LIBFWNT_WELL_KNOWN_SID_WRITE_RESTRICTED_CODE );
+
+						case 113:
+							return( LIBFWNT_WELL_KNOWN_SID_LOCAL_ACCOUNT );
+
+						case 114:
+							return( LIBFWNT_WELL_KNOWN_SID_LOCAL_ACCOUNT_AND_ADMINISTRATOR );
+					}
+					break;
+
+				case 2:
+					switch( sub_authority[ 0 ] )
+					{
+						case 32:
+							switch( sub_authority[ 1 ] )
+							{
+								case 544:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_ADMINISTRATORS );
+
+								case 545:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_USERS );
+
+								case 546:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_GUESTS );
+
+								case 547:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_POWER_USERS );
+
+								case 548:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_ACCOUNT_OPERATORS );
+
+								case 549:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_SERVER_OPERATORS );
+
+								case 550:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_PRINT_OPERATORS );
+
+								case 551:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_BACKUP_OPERATORS );
+
+								case 552:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_REPLICATOR );
+
+								case 554:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_PRE_WINDOWS_2000_COMPATIBLE_ACCESS );
+
+								case 555:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_REMOTE_DESKTOP_USERS );
+
+								case 556:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_NETWORK_CONFIGURATION_OPERATORS );
+
+								case 558:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_PERFORMANCE_MONITOR_USERS );
+
+								case 559:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_PERFORMANCE_LOG_USERS );
+
+								case 562:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_DISTRIBUTED_COM_USERS );
+
+								case 568:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_IIS_IUSRS );
+
+								case 569:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_CRYPTOGRAPHIC_OPERATORS );
+
+								case 573:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_EVENT_LOG_READERS );
+
+								case 574:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_CERTIFICATE_SERVICE_DCOM_ACCESS );
+
+								case 575:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_RDS_REMOTE_ACCESS_SERVERS );
+
+								case 576:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_RDS_ENDPOINT_SERVERS );
+
+								case 577:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_RDS_MANAGEMENT_SERVERS );
+
+								case 578:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_HYPER_V_ADMINISTRATORS );
+
+								case 579:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_ACCESS_CONTROL_ASSISTANCE_OPERATORS );
+
+								case 580:
+									return( LIBFWNT_WELL_KNOWN_SID_BUILTIN_REMOTE_MANAGEMENT_USERS );
+							}
+							break;
+
+						case 64:
+							switch( sub_authority[ 1 ] )
+							{
+								case 10:
+									return( LIBFWNT_WELL_KNOWN_SID_NTLM_AUTHENTICATION );
+
+								case 14:
+									return( LIBFWNT_WELL_KNOWN_SID_SCHANNEL_AUTHENTICATION );
+
+								case 21:
+									return( LIBFWNT_WELL_KNOWN_SID_DIGEST_AUTHENTICATION );
+							}
+							break;
+
+						case 80:
+							if( sub_authority[ 1 ] == 0 )
+							{
+								return( LIBFWNT_WELL_KNOWN_SID_ALL_SERVICES );
+							}
+							break;
+					}
+					break;
+
+				case 3:
+					/* S-1-5-5-X-Y
+					 */
+					if( sub_authority[ 0 ] == 5 )
+					{
+						return( LIBFWNT_WELL_KNOWN_SID_LOGON_SESSION );
+					}
+					break;
+
+				case 5:
+					/* S-1-5-21-domain-RID, where domain consists of 3 sub authorities
+					 */
+					if( sub_authority[ 0 ] == 21 )
+					{
+						switch( sub_authority[ 4 ] )
+						{
+							case 498:
+								return( LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_READ_ONLY_DOMAIN_CONTROLLERS );
+
+							case 500:
+								return( LIBFWNT_WELL_KNOWN_SID_ADMINISTRATOR );
+
+							case 501:
+								return( LIBFWNT_WELL_KNOWN_SID_GUEST );
+
+							case 502:
+								return( LIBFWNT_WELL_KNOWN_SID_KRBTGT );
+
+							case 512:
+								return( LIBFWNT_WELL_KNOWN_SID_DOMAIN_ADMINS );
+
+							case 513:
+								return( LIBFWNT_WELL_KNOWN_SID_DOMAIN_USERS );
+
+							case 514:
+								return( LIBFWNT_WELL_KNOWN_SID_DOMAIN_GUESTS );
+
+							case 515:
+								return( LIBFWNT_WELL_KNOWN_SID_DOMAIN_COMPUTERS );
+
+							case 516:
+								return( LIBFWNT_WELL_KNOWN_SID_DOMAIN_CONTROLLERS );
+
+							case 517:
+								return( LIBFWNT_WELL_KNOWN_SID_CERT_PUBLISHERS );
+
+							case 518:
+								return( LIBFWNT_WELL_KNOWN_SID_SCHEMA_ADMINS );
+
+							case 519:
+								return( LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_ADMINS );
+
+							case 520:
+								return( LIBFWNT_WELL_KNOWN_SID_GROUP_POLICY_CREATOR_OWNERS );
+
+							case 521:
+								return( LIBFWNT_WELL_KNOWN_SID_READ_ONLY_DOMAIN_CONTROLLERS );
+
+							case 522:
+								return( LIBFWNT_WELL_KNOWN_SID_CLONEABLE_DOMAIN_CONTROLLERS );
+
+							case 525:
+								return( LIBFWNT_WELL_KNOWN_SID_PROTECTED_USERS );
+
+							case 526:
+								return( LIBFWNT_WELL_KNOWN_SID_KEY_ADMINS );
+
+							case 527:
+								return( LIBFWNT_WELL_KNOWN_SID_ENTERPRISE_KEY_ADMINS );
+
+							case 553:
+								return( LIBFWNT_WELL_KNOWN_SID_RAS_SERVERS );
+						}
+					}
+					break;
+
+				case 6:
+					if( ( sub_authority[ 0 ] == 84 )
+					 && ( sub_authority[ 1 ] == 0 )
+					 && ( sub_authority[ 2 ] == 0 )
+					 && ( sub_authority[ 3 ] == 0 )
+					 && ( sub_authority[ 4 ] == 0 )
+					 && ( sub_authority[ 5 ] == 0 ) )
+					{
+						return( LIBFWNT_WELL_KNOWN_SID_USER_MODE_DRIVERS );
+					}
+					break;
+			}
+			break;
+
+		case 15:
+			/* S-1-15-2-X is an application package and S-1-15-3-X a capability
+			 */
+			if( number_of_sub_authorities >= 2 )
+			{
+				if( sub_authority[ 0 ] == 2 )
+				{
+					if( number_of_sub_authorities == 2 )
+					{
+						switch( sub_authority[ 1 ] )
+						{
+							case 1:
+								return( LIBFWNT_WELL_KNOWN_SID_ALL_APPLICATION_PACKAGES );
+
+							case 2:
+								return( LIBFWNT_WELL_KNOWN_SID_ALL_RESTRICTED_APPLICATION_PACKAGES );
+						}
+					}
+					else if( number_of_sub_authorities == 8 )
+					{
+						return( LIBFWNT_WELL_KNOWN_SID_APPLICATION_CONTAINER );
+					}
+				}
+				else if( sub_authority[ 0 ] == 3 )
+				{
+					return( LIBFWNT_WELL_KNOWN_SID_CAPABILITY );
+				}
+			}
+			break;
+
+		case 16:
+			if( number_of_sub_authorities == 1 )
+			{
+				switch( sub_authority[ 0 ] )
+				{
+					case 0:
+						return( LIBFWNT_WELL_KNOWN_SID_UNTRUSTED_MANDATORY_LEVEL );
+
+					case 4096:
+						return( LIBFWNT_WELL_KNOWN_SID_LOW_MANDATORY_LEVEL );
+
+					case 8192:
+						return( LIBFWNT_WELL_KNOWN_SID_MEDIUM_MANDATORY_LEVEL );
+
+					case 8448:
+						return( LIBFWNT_WELL_KNOWN_SID_MEDIUM_PLUS_MANDATORY_LEVEL );
+
+					case 12288:
+						return( LIBFWNT_WELL_KNOWN_SID_HIGH_MANDATORY_LEVEL );
+
+					case 16384:
+						return( LIBFWNT_WELL_KNOWN_SID_SYSTEM_MANDATORY_LEVEL );
+
+					case 20480:
+						return( LIBFWNT_WELL_KNOWN_SID_PROTECTED_PROCESS_MANDATORY_LEVEL );
+				}
+			}
+			break;
+
+		case 18:
+			if( number_of_sub_authorities == 1 )
+			{
+				switch( sub_authority[ 0 ] )
+				{
+					case 1:
+						return( LIBFWNT_WELL_KNOWN_SID_AUTHENTICATION_AUTHORITY_ASSERTED_IDENTITY );
+
+					case 2:
+						return( LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY );
+				}
+			}
+			break;
+	}
+	return( LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+}
+
+/* Retrieves the string of the well-known security identifier of a specific
+ * security descriptor definition language (SDDL) alias
+ * The alias consists of 2 characters
+ * Returns the string or NULL if not available or relative to a domain or computer
+ */
+const char *libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+             const uint8_t *sddl_alias )
+{
+	const char *well_known_sddl_alias = NULL;
+	int well_known_type               = 0;
+
+	if( sddl_alias == NULL )
+	{
+		return( NULL );
+	}
+	for( well_known_type = 1;
+	     well_known_type < LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_NUMBER_OF_TYPES;
+	     well_known_type++ )
+	{
+		well_known_sddl_alias = libfwnt_well_known_security_identifiers[ well_known_type ].sddl_alias;
+
+		if( ( well_known_sddl_alias != NULL )
+		 && ( sddl_alias[ 0 ] == (uint8_t) well_known_sddl_alias[ 0 ] )
+		 && ( sddl_alias[ 1 ] == (uint8_t) well_known_sddl_alias[ 1 ] ) )
+		{
+			return( libfwnt_well_known_security_identifiers[ well_known_type ].string );
+		}
+	}
+	return( NULL );
+}
+
+/* Determines the well-known type of a security identifier stored in a byte stream
+ * Returns 1 if the security identifier is well-known, 0 if not or -1 on error
+ */
+int libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     int *well_known_type,
+     libcerror_error_t **error )
+{
+	libfwnt_internal_security_identifier_t security_identifier;
+
+	static char *function = "libfwnt_well_known_security_identifier_get_type_from_byte_stream";
+
+	if( well_known_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid well-known type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &security_identifier,
+	     0,
+	     sizeof( libfwnt_internal_security_identifier_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwnt_security_identifier_copy_from_byte_stream(
+	     (libfwnt_security_identifier_t *) &security_identifier,
+	     byte_stream,
+	     byte_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy security identifier from byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	*well_known_type = libfwnt_well_known_security_identifier_get_type(
+	                    &security_identifier );
+
+	if( *well_known_type == LIBFWNT_WELL_KNOWN_SID_UNKNOWN )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the security descriptor definition language (SDDL) alias of a well-known type
+ * Returns the alias or NULL if not available
+ */
+const char *libfwnt_well_known_security_identifier_get_sddl_alias(
+             int well_known_type )
+{
+	if( ( well_known_type <= LIBFWNT_WELL_KNOWN_SID_UNKNOWN )
+	 || ( well_known_type >= LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_NUMBER_OF_TYPES ) )
+	{
+		return( NULL );
+	}
+	return( libfwnt_well_known_security_identifiers[ well_known_type ].sddl_alias );
+}
+
+/* Retrieves the name of a well-known type
+ * Returns the name or NULL if not available
+ */
+const char *libfwnt_well_known_security_identifier_get_name(
+             int well_known_type )
+{
+	if( ( well_known_type <= LIBFWNT_WELL_KNOWN_SID_UNKNOWN )
+	 || ( well_known_type >= LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_NUMBER_OF_TYPES ) )
+	{
+		return( NULL );
+	}
+	return( libfwnt_well_known_security_identifiers[ well_known_type ].name );
+}
+
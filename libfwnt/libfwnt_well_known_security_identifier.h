@@ -0,0 +1,92 @@
+/*
+ * Well-known security identifier (SID) functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_H )
+#define _LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwnt_definitions.h"
+#include "libfwnt_extern.h"
+#include "libfwnt_libcerror.h"
+#include "libfwnt_security_identifier.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of well-known security identifier types including unknown
+ */
+#define LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_NUMBER_OF_TYPES		( LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY + 1 )
+
+typedef struct libfwnt_well_known_security_identifier libfwnt_well_known_security_identifier_t;
+
+struct libfwnt_well_known_security_identifier
+{
+	/* The type
+	 */
+	int type;
+
+	/* The security descriptor definition language (SDDL) alias
+	 */
+	const char *sddl_alias;
+
+	/* The string or NULL if the security identifier is relative to a domain or computer
+	 * or represents a class of security identifiers
+	 */
+	const char *string;
+
+	/* The name
+	 */
+	const char *name;
+};
+
+extern const libfwnt_well_known_security_identifier_t libfwnt_well_known_security_identifiers[ LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_NUMBER_OF_TYPES ];
+
+int libfwnt_well_known_security_identifier_get_type(
+     libfwnt_internal_security_identifier_t *internal_security_identifier );
+
+const char *libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+             const uint8_t *sddl_alias );
+
+LIBFWNT_EXTERN \
+int libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int byte_order,
+     int *well_known_type,
+     libcerror_error_t **error );
+
+LIBFWNT_EXTERN \
+const char *libfwnt_well_known_security_identifier_get_sddl_alias(
+             int well_known_type );
+
+LIBFWNT_EXTERN \
+const char *libfwnt_well_known_security_identifier_get_name(
+             int well_known_type );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWNT_WELL_KNOWN_SECURITY_IDENTIFIER_H ) */
+
@@ -32,6 +32,7 @@
 #include "pyfwnt_access_control_entry.h"
 #include "pyfwnt_access_control_list.h"
 #include "pyfwnt_access_control_types.h"
+#include "pyfwnt_decompressor.h"
 #include "pyfwnt_error.h"
 #include "pyfwnt_libcerror.h"
 #include "pyfwnt_libfwnt.h"
@@ -56,31 +57,104 @@ PyMethodDef pyfwnt_module_methods[] = {
 	{ "lznt1_decompress",
 	  (PyCFunction) pyfwnt_lznt1_decompress,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "lznt1_compress(compressed_data, uncompressed_data_size) -> Bytes\n"
+	  "lznt1_decompress(compressed_data, uncompressed_data_size, maximum_uncompressed_data_size) -> Bytes\n"
 	  "\n"
-	  "Decompresses data using LZNT1 compression." },
+	  "Decompresses data using LZNT1 compression.\n"
+	  "If the uncompressed data size is 0 or not provided, the uncompressed data is grown\n"
+	  "until the decompressed data fits, up to the maximum uncompressed data size,\n"
+	  "which defaults to 64 MiB." },
+
+	{ "lznt1_decompress_into",
+	  (PyCFunction) pyfwnt_lznt1_decompress_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lznt1_decompress_into(compressed_data, uncompressed_data) -> Integer\n"
+	  "\n"
+	  "Decompresses data using LZNT1 compression into a writable buffer.\n"
+	  "Returns the number of bytes written." },
+
+	{ "lznt1_decompress_many",
+	  (PyCFunction) pyfwnt_lznt1_decompress_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lznt1_decompress_many(compressed_data, uncompressed_data_sizes, threads) -> List\n"
+	  "\n"
+	  "Decompresses a sequence of buffers using LZNT1 compression.\n"
+	  "The buffers are decompressed without holding the GIL using the number of threads." },
 
 	{ "lzx_decompress",
 	  (PyCFunction) pyfwnt_lzx_decompress,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "lzx_compress(compressed_data, uncompressed_data_size) -> Bytes\n"
+	  "lzx_decompress(compressed_data, uncompressed_data_size, maximum_uncompressed_data_size) -> Bytes\n"
+	  "\n"
+	  "Decompresses data using LZX compression.\n"
+	  "If the uncompressed data size is 0 or not provided, the uncompressed data is grown\n"
+	  "until the decompressed data fits, up to the maximum uncompressed data size,\n"
+	  "which defaults to 64 MiB." },
+
+	{ "lzx_decompress_into",
+	  (PyCFunction) pyfwnt_lzx_decompress_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lzx_decompress_into(compressed_data, uncompressed_data) -> Integer\n"
 	  "\n"
-	  "Decompresses data using LZX compression." },
+	  "Decompresses data using LZX compression into a writable buffer.\n"
+	  "Returns the number of bytes written." },
+
+	{ "lzx_decompress_many",
+	  (PyCFunction) pyfwnt_lzx_decompress_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lzx_decompress_many(compressed_data, uncompressed_data_sizes, threads) -> List\n"
+	  "\n"
+	  "Decompresses a sequence of buffers using LZX compression.\n"
+	  "The buffers are decompressed without holding the GIL using the number of threads." },
 
 	{ "lzxpress_decompress",
 	  (PyCFunction) pyfwnt_lzxpress_decompress,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "lzxpress_compress(compressed_data, uncompressed_data_size) -> Bytes\n"
+	  "lzxpress_decompress(compressed_data, uncompressed_data_size, maximum_uncompressed_data_size) -> Bytes\n"
+	  "\n"
+	  "Decompresses data using LZXPRESS compression.\n"
+	  "If the uncompressed data size is 0 or not provided, the uncompressed data is grown\n"
+	  "until the decompressed data fits, up to the maximum uncompressed data size,\n"
+	  "which defaults to 64 MiB." },
+
+	{ "lzxpress_decompress_into",
+	  (PyCFunction) pyfwnt_lzxpress_decompress_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lzxpress_decompress_into(compressed_data, uncompressed_data) -> Integer\n"
+	  "\n"
+	  "Decompresses data using LZXPRESS compression into a writable buffer.\n"
+	  "Returns the number of bytes written." },
+
+	{ "lzxpress_decompress_many",
+	  (PyCFunction) pyfwnt_lzxpress_decompress_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lzxpress_decompress_many(compressed_data, uncompressed_data_sizes, threads) -> List\n"
 	  "\n"
-	  "Decompresses data using LZXPRESS compression." },
+	  "Decompresses a sequence of buffers using LZXPRESS compression.\n"
+	  "The buffers are decompressed without holding the GIL using the number of threads." },
 
 	{ "lzxpress_huffman_decompress",
 	  (PyCFunction) pyfwnt_lzxpress_huffman_decompress,
 	  METH_VARARGS | METH_KEYWORDS,
-	  "lzxpress_huffman_compress(compressed_data, uncompressed_data_size) -> Bytes\n"
+	  "lzxpress_huffman_decompress(compressed_data, uncompressed_data_size) -> Bytes\n"
 	  "\n"
 	  "Decompresses data using LZXPRESS Huffman compression." },
 
+	{ "lzxpress_huffman_decompress_into",
+	  (PyCFunction) pyfwnt_lzxpress_huffman_decompress_into,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lzxpress_huffman_decompress_into(compressed_data, uncompressed_data) -> Integer\n"
+	  "\n"
+	  "Decompresses data using LZXPRESS Huffman compression into a writable buffer.\n"
+	  "Returns the number of bytes written." },
+
+	{ "lzxpress_huffman_decompress_many",
+	  (PyCFunction) pyfwnt_lzxpress_huffman_decompress_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "lzxpress_huffman_decompress_many(compressed_data, uncompressed_data_sizes, threads) -> List\n"
+	  "\n"
+	  "Decompresses a sequence of buffers using LZXPRESS Huffman compression.\n"
+	  "The buffers are decompressed without holding the GIL using the number of threads." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -259,6 +333,23 @@ PyMODINIT_FUNC initpyfwnt(
 	 "access_control_types",
 	 (PyObject *) &pyfwnt_access_control_types_type_object );
 
+	/* Setup the lznt1_decompressor type object
+	 */
+	pyfwnt_lznt1_decompressor_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyfwnt_lznt1_decompressor_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyfwnt_lznt1_decompressor_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "lznt1_decompressor",
+	 (PyObject *) &pyfwnt_lznt1_decompressor_type_object );
+
 	/* Setup the security_descriptor type object
 	 */
 	pyfwnt_security_descriptor_type_object.tp_new = PyType_GenericNew;
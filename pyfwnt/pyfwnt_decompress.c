@@ -0,0 +1,625 @@
+/*
+ * Shared decompression functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "pyfwnt_decompress.h"
+#include "pyfwnt_error.h"
+#include "pyfwnt_libcerror.h"
+#include "pyfwnt_libcthreads.h"
+#include "pyfwnt_python.h"
+#include "pyfwnt_unused.h"
+
+/* Decompresses data of which the uncompressed data size is not known
+ * The uncompressed data is grown geometrically, starting from an estimate
+ * based on the compressed data size, until the decompressed data fits.
+ * Since a decompressor can stop when the uncompressed data is full,
+ * the decompressed data only fits if it is smaller than the uncompressed data.
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_decompress_with_estimated_size(
+           pyfwnt_decompress_function_t decompress_function,
+           const uint8_t *compressed_data,
+           size_t compressed_data_size,
+           size_t maximum_uncompressed_data_size )
+{
+	libcerror_error_t *error                  = NULL;
+	PyObject *uncompressed_data_string_object = NULL;
+	static char *function                     = "pyfwnt_decompress_with_estimated_size";
+	char *uncompressed_data                   = NULL;
+	size_t allocated_data_size                = 0;
+	size_t safe_uncompressed_data_size        = 0;
+	int result                                = 0;
+
+	if( decompress_function == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompress function.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( maximum_uncompressed_data_size == 0 )
+	 || ( maximum_uncompressed_data_size >= (size_t) INT_MAX ) )
+	{
+		maximum_uncompressed_data_size = (size_t) INT_MAX - 1;
+	}
+	if( compressed_data_size > ( maximum_uncompressed_data_size / PYFWNT_DECOMPRESS_ESTIMATED_SIZE_FACTOR ) )
+	{
+		allocated_data_size = maximum_uncompressed_data_size + 1;
+	}
+	else
+	{
+		allocated_data_size = compressed_data_size * PYFWNT_DECOMPRESS_ESTIMATED_SIZE_FACTOR;
+
+		if( allocated_data_size < PYFWNT_DECOMPRESS_MINIMUM_ESTIMATED_SIZE )
+		{
+			allocated_data_size = PYFWNT_DECOMPRESS_MINIMUM_ESTIMATED_SIZE;
+		}
+		if( allocated_data_size > maximum_uncompressed_data_size )
+		{
+			allocated_data_size = maximum_uncompressed_data_size + 1;
+		}
+	}
+	while( allocated_data_size > 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		uncompressed_data_string_object = PyBytes_FromStringAndSize(
+		                                   NULL,
+		                                   (Py_ssize_t) allocated_data_size );
+#else
+		uncompressed_data_string_object = PyString_FromStringAndSize(
+		                                   NULL,
+		                                   (Py_ssize_t) allocated_data_size );
+#endif
+		if( uncompressed_data_string_object == NULL )
+		{
+			return( NULL );
+		}
+#if PY_MAJOR_VERSION >= 3
+		uncompressed_data = PyBytes_AsString(
+		                     uncompressed_data_string_object );
+#else
+		uncompressed_data = PyString_AsString(
+		                     uncompressed_data_string_object );
+#endif
+		safe_uncompressed_data_size = allocated_data_size;
+
+		Py_BEGIN_ALLOW_THREADS
+
+		result = decompress_function(
+		          compressed_data,
+		          compressed_data_size,
+		          (uint8_t *) uncompressed_data,
+		          &safe_uncompressed_data_size,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( ( result == 1 )
+		 && ( safe_uncompressed_data_size < allocated_data_size ) )
+		{
+			break;
+		}
+		/* Only an uncompressed data that is too small warrants another attempt,
+		 * other errors such as truncated compressed data are not recoverable
+		 */
+		if( ( result != 1 )
+		 && ( libcerror_error_matches(
+		       error,
+		       LIBCERROR_ERROR_DOMAIN_OUTPUT,
+		       LIBCERROR_OUTPUT_ERROR_INSUFFICIENT_SPACE ) == 0 ) )
+		{
+			goto on_error;
+		}
+		if( allocated_data_size > maximum_uncompressed_data_size )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: uncompressed data size exceeds maximum: %d.",
+				 function,
+				 (int) maximum_uncompressed_data_size );
+			}
+			goto on_error;
+		}
+		libcerror_error_free(
+		 &error );
+
+		Py_DecRef(
+		 (PyObject *) uncompressed_data_string_object );
+
+		uncompressed_data_string_object = NULL;
+
+		if( allocated_data_size > ( maximum_uncompressed_data_size / 2 ) )
+		{
+			allocated_data_size = maximum_uncompressed_data_size + 1;
+		}
+		else
+		{
+			allocated_data_size *= 2;
+		}
+	}
+	/* Need to resize the string here since the uncompressed data is larger
+	 * than the decompressed data.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &uncompressed_data_string_object,
+	     (Py_ssize_t) safe_uncompressed_data_size ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &uncompressed_data_string_object,
+	     (Py_ssize_t) safe_uncompressed_data_size ) != 0 )
+#endif
+	{
+		return( NULL );
+	}
+	return( uncompressed_data_string_object );
+
+on_error:
+	pyfwnt_error_raise(
+	 error,
+	 PyExc_IOError,
+	 "%s: unable to decompress data.",
+	 function );
+
+	libcerror_error_free(
+	 &error );
+
+	Py_DecRef(
+	 (PyObject *) uncompressed_data_string_object );
+
+	return( NULL );
+}
+
+/* Processes a decompress job
+ * This function is called from the worker threads and cannot use the Python API
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwnt_decompress_job_process(
+     intptr_t *decompress_job,
+     void *arguments PYFWNT_ATTRIBUTE_UNUSED )
+{
+	pyfwnt_decompress_job_t *safe_decompress_job = NULL;
+
+	PYFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( decompress_job == NULL )
+	{
+		return( -1 );
+	}
+	safe_decompress_job = (pyfwnt_decompress_job_t *) decompress_job;
+
+	safe_decompress_job->result = safe_decompress_job->decompress_function(
+	                               safe_decompress_job->compressed_data,
+	                               safe_decompress_job->compressed_data_size,
+	                               safe_decompress_job->uncompressed_data,
+	                               &( safe_decompress_job->uncompressed_data_size ),
+	                               &( safe_decompress_job->error ) );
+
+	return( 1 );
+}
+
+/* Decompresses many buffers
+ * The buffers are decompressed without holding the GIL, using a pool of
+ * worker threads if multi-threading is supported
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_decompress_many(
+           pyfwnt_decompress_function_t decompress_function,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool     = NULL;
+#endif
+	Py_buffer *compressed_data_buffers         = NULL;
+	PyObject *compressed_data_object           = NULL;
+	PyObject *compressed_data_sequence         = NULL;
+	PyObject *list_object                      = NULL;
+	PyObject *uncompressed_data_sizes_object   = NULL;
+	PyObject *uncompressed_data_sizes_sequence = NULL;
+	PyObject *uncompressed_data_string_object  = NULL;
+	libcerror_error_t *error                   = NULL;
+	pyfwnt_decompress_job_t *decompress_jobs   = NULL;
+	static char *function                      = "pyfwnt_decompress_many";
+	static char *keyword_list[]                = { "compressed_data", "uncompressed_data_sizes", "threads", NULL };
+	Py_ssize_t item_index                      = 0;
+	Py_ssize_t number_of_buffers               = 0;
+	Py_ssize_t number_of_items                 = 0;
+	Py_ssize_t uncompressed_data_size          = 0;
+	int number_of_threads                      = 1;
+	int result                                 = 1;
+
+	if( decompress_function == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompress function.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OO|i",
+	     keyword_list,
+	     &compressed_data_object,
+	     &uncompressed_data_sizes_object,
+	     &number_of_threads ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > PYFWNT_DECOMPRESS_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument threads value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	/* Private tuples are used since retrieving the buffers and sizes can run
+	 * Python code, such as __index__, that modifies the sequences of the caller
+	 */
+	compressed_data_sequence = PySequence_Tuple(
+	                            compressed_data_object );
+
+	if( compressed_data_sequence == NULL )
+	{
+		goto on_error;
+	}
+	uncompressed_data_sizes_sequence = PySequence_Tuple(
+	                                    uncompressed_data_sizes_object );
+
+	if( uncompressed_data_sizes_sequence == NULL )
+	{
+		goto on_error;
+	}
+	number_of_items = PyTuple_GET_SIZE(
+	                   compressed_data_sequence );
+
+	if( number_of_items != PyTuple_GET_SIZE( uncompressed_data_sizes_sequence ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument uncompressed data sizes value does not match number of compressed data.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_items > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument compressed data number of items value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	list_object = PyList_New(
+	               number_of_items );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	if( number_of_items == 0 )
+	{
+		Py_DecRef(
+		 uncompressed_data_sizes_sequence );
+
+		Py_DecRef(
+		 compressed_data_sequence );
+
+		return( list_object );
+	}
+	decompress_jobs = (pyfwnt_decompress_job_t *) PyMem_Malloc(
+	                                               sizeof( pyfwnt_decompress_job_t ) * number_of_items );
+
+	if( decompress_jobs == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create decompress jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     decompress_jobs,
+	     0,
+	     sizeof( pyfwnt_decompress_job_t ) * number_of_items ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear decompress jobs.",
+		 function );
+
+		goto on_error;
+	}
+	compressed_data_buffers = (Py_buffer *) PyMem_Malloc(
+	                                         sizeof( Py_buffer ) * number_of_items );
+
+	if( compressed_data_buffers == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create compressed data buffers.",
+		 function );
+
+		goto on_error;
+	}
+	/* The uncompressed data is decompressed directly into the string objects
+	 * that are returned, which are only referenced by the list
+	 */
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( PyObject_GetBuffer(
+		     PyTuple_GET_ITEM( compressed_data_sequence, item_index ),
+		     &( compressed_data_buffers[ item_index ] ),
+		     PyBUF_SIMPLE ) != 0 )
+		{
+			goto on_error;
+		}
+		number_of_buffers++;
+
+		uncompressed_data_size = PyNumber_AsSsize_t(
+		                          PyTuple_GET_ITEM( uncompressed_data_sizes_sequence, item_index ),
+		                          PyExc_OverflowError );
+
+		if( ( uncompressed_data_size == -1 )
+		 && ( PyErr_Occurred() != NULL ) )
+		{
+			goto on_error;
+		}
+		if( ( uncompressed_data_size <= 0 )
+		 || ( uncompressed_data_size > (Py_ssize_t) INT_MAX ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid argument uncompressed data size: %d value out of bounds.",
+			 function,
+			 (int) item_index );
+
+			goto on_error;
+		}
+#if PY_MAJOR_VERSION >= 3
+		uncompressed_data_string_object = PyBytes_FromStringAndSize(
+		                                   NULL,
+		                                   uncompressed_data_size );
+#else
+		uncompressed_data_string_object = PyString_FromStringAndSize(
+		                                   NULL,
+		                                   uncompressed_data_size );
+#endif
+		if( uncompressed_data_string_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyList_SET_ITEM steals the reference
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 item_index,
+		 uncompressed_data_string_object );
+
+		decompress_jobs[ item_index ].decompress_function    = decompress_function;
+		decompress_jobs[ item_index ].compressed_data        = (uint8_t *) compressed_data_buffers[ item_index ].buf;
+		decompress_jobs[ item_index ].compressed_data_size   = (size_t) compressed_data_buffers[ item_index ].len;
+		decompress_jobs[ item_index ].uncompressed_data_size = (size_t) uncompressed_data_size;
+
+#if PY_MAJOR_VERSION >= 3
+		decompress_jobs[ item_index ].uncompressed_data = (uint8_t *) PyBytes_AsString(
+		                                                               uncompressed_data_string_object );
+#else
+		decompress_jobs[ item_index ].uncompressed_data = (uint8_t *) PyString_AsString(
+		                                                               uncompressed_data_string_object );
+#endif
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( number_of_items > 1 ) )
+	{
+		if( number_of_threads > number_of_items )
+		{
+			number_of_threads = (int) number_of_items;
+		}
+		result = libcthreads_thread_pool_create(
+		          &thread_pool,
+		          NULL,
+		          number_of_threads,
+		          (int) number_of_items,
+		          &pyfwnt_decompress_job_process,
+		          NULL,
+		          &error );
+
+		for( item_index = 0;
+		     ( result == 1 ) && ( item_index < number_of_items );
+		     item_index++ )
+		{
+			result = libcthreads_thread_pool_push(
+			          thread_pool,
+			          (intptr_t *) &( decompress_jobs[ item_index ] ),
+			          &error );
+		}
+		/* Joining the thread pool waits for the pushed jobs to complete
+		 */
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     &error ) != 1 )
+			{
+				result = -1;
+			}
+		}
+	}
+	else
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+	{
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			pyfwnt_decompress_job_process(
+			 (intptr_t *) &( decompress_jobs[ item_index ] ),
+			 NULL );
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to decompress data using thread pool.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( decompress_jobs[ item_index ].result != 1 )
+		{
+			pyfwnt_error_raise(
+			 decompress_jobs[ item_index ].error,
+			 PyExc_IOError,
+			 "%s: unable to decompress data: %d.",
+			 function,
+			 (int) item_index );
+
+			goto on_error;
+		}
+		uncompressed_data_string_object = PyList_GET_ITEM(
+		                                   list_object,
+		                                   item_index );
+
+		/* Need to resize the string here in case the uncompressed data size was not fully used.
+		 */
+#if PY_MAJOR_VERSION >= 3
+		result = _PyBytes_Resize(
+		          &uncompressed_data_string_object,
+		          (Py_ssize_t) decompress_jobs[ item_index ].uncompressed_data_size );
+#else
+		result = _PyString_Resize(
+		          &uncompressed_data_string_object,
+		          (Py_ssize_t) decompress_jobs[ item_index ].uncompressed_data_size );
+#endif
+		/* The resize function can reallocate the string object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 item_index,
+		 uncompressed_data_string_object );
+
+		if( result != 0 )
+		{
+			goto on_error;
+		}
+	}
+	for( item_index = 0;
+	     item_index < number_of_buffers;
+	     item_index++ )
+	{
+		PyBuffer_Release(
+		 &( compressed_data_buffers[ item_index ] ) );
+	}
+	PyMem_Free(
+	 compressed_data_buffers );
+
+	PyMem_Free(
+	 decompress_jobs );
+
+	Py_DecRef(
+	 uncompressed_data_sizes_sequence );
+
+	Py_DecRef(
+	 compressed_data_sequence );
+
+	return( list_object );
+
+on_error:
+	if( compressed_data_buffers != NULL )
+	{
+		for( item_index = 0;
+		     item_index < number_of_buffers;
+		     item_index++ )
+		{
+			PyBuffer_Release(
+			 &( compressed_data_buffers[ item_index ] ) );
+		}
+		PyMem_Free(
+		 compressed_data_buffers );
+	}
+	if( decompress_jobs != NULL )
+	{
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( decompress_jobs[ item_index ].error != NULL )
+			{
+				libcerror_error_free(
+				 &( decompress_jobs[ item_index ].error ) );
+			}
+		}
+		PyMem_Free(
+		 decompress_jobs );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( uncompressed_data_sizes_sequence != NULL )
+	{
+		Py_DecRef(
+		 uncompressed_data_sizes_sequence );
+	}
+	if( compressed_data_sequence != NULL )
+	{
+		Py_DecRef(
+		 compressed_data_sequence );
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,116 @@
+/*
+ * Shared decompression functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _PYFWNT_DECOMPRESS_H )
+#define _PYFWNT_DECOMPRESS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfwnt_libcerror.h"
+#include "pyfwnt_libcthreads.h"
+#include "pyfwnt_python.h"
+
+/* The initial size of the uncompressed data relative to the compressed data
+ * when the uncompressed data size is not known
+ */
+#define PYFWNT_DECOMPRESS_ESTIMATED_SIZE_FACTOR		4
+
+/* The minimum initial size of the uncompressed data when the uncompressed
+ * data size is not known
+ */
+#define PYFWNT_DECOMPRESS_MINIMUM_ESTIMATED_SIZE	4096
+
+/* The default maximum size of the uncompressed data when the uncompressed
+ * data size is not known
+ */
+#define PYFWNT_DECOMPRESS_DEFAULT_MAXIMUM_SIZE		( 64 * 1024 * 1024 )
+
+/* The maximum number of threads used to decompress many buffers
+ */
+#define PYFWNT_DECOMPRESS_MAXIMUM_NUMBER_OF_THREADS	64
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef int (*pyfwnt_decompress_function_t)(
+               const uint8_t *compressed_data,
+               size_t compressed_data_size,
+               uint8_t *uncompressed_data,
+               size_t *uncompressed_data_size,
+               libcerror_error_t **error );
+
+typedef struct pyfwnt_decompress_job pyfwnt_decompress_job_t;
+
+struct pyfwnt_decompress_job
+{
+	/* The decompress function
+	 */
+	pyfwnt_decompress_function_t decompress_function;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed data size
+	 */
+	size_t compressed_data_size;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The uncompressed data size
+	 */
+	size_t uncompressed_data_size;
+
+	/* The result of the decompress function
+	 */
+	int result;
+
+	/* The error of the decompress function
+	 */
+	libcerror_error_t *error;
+};
+
+PyObject *pyfwnt_decompress_with_estimated_size(
+           pyfwnt_decompress_function_t decompress_function,
+           const uint8_t *compressed_data,
+           size_t compressed_data_size,
+           size_t maximum_uncompressed_data_size );
+
+int pyfwnt_decompress_job_process(
+     intptr_t *decompress_job,
+     void *arguments );
+
+PyObject *pyfwnt_decompress_many(
+           pyfwnt_decompress_function_t decompress_function,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFWNT_DECOMPRESS_H ) */
+
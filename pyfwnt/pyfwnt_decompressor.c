@@ -0,0 +1,791 @@
+/*
+ * Python object wrapper of a streaming decompressor
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyfwnt_decompressor.h"
+#include "pyfwnt_error.h"
+#include "pyfwnt_libcerror.h"
+#include "pyfwnt_libfwnt.h"
+#include "pyfwnt_python.h"
+#include "pyfwnt_unused.h"
+
+PyMethodDef pyfwnt_decompressor_object_methods[] = {
+
+	{ "decompress",
+	  (PyCFunction) pyfwnt_decompressor_decompress,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "decompress(compressed_data, max_length) -> Bytes\n"
+	  "\n"
+	  "Decompresses data. If max length is non-zero at most max length bytes\n"
+	  "are returned and the remaining data is returned by the next calls." },
+
+	{ "flush",
+	  (PyCFunction) pyfwnt_decompressor_flush,
+	  METH_NOARGS,
+	  "flush() -> Bytes\n"
+	  "\n"
+	  "Returns all the remaining decompressed data." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyTypeObject pyfwnt_lznt1_decompressor_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyfwnt.lznt1_decompressor",
+	/* tp_basicsize */
+	sizeof( pyfwnt_decompressor_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyfwnt_decompressor_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT,
+	/* tp_doc */
+	"pyfwnt LZNT1 streaming decompressor object",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	0,
+	/* tp_iternext */
+	0,
+	/* tp_methods */
+	pyfwnt_decompressor_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyfwnt_lznt1_decompressor_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Initializes a LZNT1 decompressor object
+ * Returns 0 if successful or -1 on error
+ */
+int pyfwnt_lznt1_decompressor_init(
+     pyfwnt_decompressor_t *pyfwnt_decompressor,
+     PyObject *arguments,
+     PyObject *keywords )
+{
+	static char *function       = "pyfwnt_lznt1_decompressor_init";
+	static char *keyword_list[] = { NULL };
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "",
+	     keyword_list ) == 0 )
+	{
+		return( -1 );
+	}
+	/* The object can be initialized more than once
+	 */
+	if( pyfwnt_decompressor->compressed_data != NULL )
+	{
+		PyMem_Free(
+		 pyfwnt_decompressor->compressed_data );
+	}
+	if( pyfwnt_decompressor->pending_data != NULL )
+	{
+		PyMem_Free(
+		 pyfwnt_decompressor->pending_data );
+	}
+	pyfwnt_decompressor->compressed_data                = NULL;
+	pyfwnt_decompressor->compressed_data_size           = 0;
+	pyfwnt_decompressor->compressed_data_allocated_size = 0;
+	pyfwnt_decompressor->compressed_data_offset         = 0;
+	pyfwnt_decompressor->pending_data_size              = 0;
+	pyfwnt_decompressor->pending_data_offset            = 0;
+	pyfwnt_decompressor->is_end_of_stream               = 0;
+	pyfwnt_decompressor->is_flushed                     = 0;
+
+	pyfwnt_decompressor->pending_data = (uint8_t *) PyMem_Malloc(
+	                                                 sizeof( uint8_t ) * PYFWNT_DECOMPRESSOR_LZNT1_CHUNK_SIZE );
+
+	if( pyfwnt_decompressor->pending_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create pending data.",
+		 function );
+
+		pyfwnt_decompressor->pending_data_allocated_size = 0;
+
+		return( -1 );
+	}
+	pyfwnt_decompressor->pending_data_allocated_size = PYFWNT_DECOMPRESSOR_LZNT1_CHUNK_SIZE;
+
+	return( 0 );
+}
+
+/* Frees a decompressor object
+ */
+void pyfwnt_decompressor_free(
+      pyfwnt_decompressor_t *pyfwnt_decompressor )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyfwnt_decompressor_free";
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyfwnt_decompressor );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyfwnt_decompressor->compressed_data != NULL )
+	{
+		PyMem_Free(
+		 pyfwnt_decompressor->compressed_data );
+	}
+	if( pyfwnt_decompressor->pending_data != NULL )
+	{
+		PyMem_Free(
+		 pyfwnt_decompressor->pending_data );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyfwnt_decompressor );
+}
+
+/* Appends data to the buffered compressed data
+ * Compressed data that has already been decompressed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwnt_decompressor_append_compressed_data(
+     pyfwnt_decompressor_t *pyfwnt_decompressor,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size )
+{
+	uint8_t *reallocation = NULL;
+	static char *function = "pyfwnt_decompressor_append_compressed_data";
+	size_t allocated_size = 0;
+	size_t remaining_size = 0;
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size == 0 )
+	 || ( pyfwnt_decompressor->is_end_of_stream != 0 ) )
+	{
+		return( 1 );
+	}
+	if( compressed_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_size = pyfwnt_decompressor->compressed_data_size - pyfwnt_decompressor->compressed_data_offset;
+
+	if( compressed_data_size > ( (size_t) SSIZE_MAX - remaining_size ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pyfwnt_decompressor->compressed_data_offset > 0 )
+	 && ( remaining_size > 0 ) )
+	{
+		memmove(
+		 pyfwnt_decompressor->compressed_data,
+		 &( pyfwnt_decompressor->compressed_data[ pyfwnt_decompressor->compressed_data_offset ] ),
+		 remaining_size );
+	}
+	pyfwnt_decompressor->compressed_data_size   = remaining_size;
+	pyfwnt_decompressor->compressed_data_offset = 0;
+
+	if( compressed_data_size > ( pyfwnt_decompressor->compressed_data_allocated_size - remaining_size ) )
+	{
+		allocated_size = remaining_size + compressed_data_size;
+
+		if( allocated_size < ( pyfwnt_decompressor->compressed_data_allocated_size * 2 ) )
+		{
+			allocated_size = pyfwnt_decompressor->compressed_data_allocated_size * 2;
+		}
+		reallocation = (uint8_t *) PyMem_Realloc(
+		                            pyfwnt_decompressor->compressed_data,
+		                            sizeof( uint8_t ) * allocated_size );
+
+		if( reallocation == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to resize compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		pyfwnt_decompressor->compressed_data                = reallocation;
+		pyfwnt_decompressor->compressed_data_allocated_size = allocated_size;
+	}
+	if( memory_copy(
+	     &( pyfwnt_decompressor->compressed_data[ remaining_size ] ),
+	     compressed_data,
+	     compressed_data_size ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to copy compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	pyfwnt_decompressor->compressed_data_size += compressed_data_size;
+
+	return( 1 );
+}
+
+/* Determines the upper bound of the size of the data that can be returned
+ * Returns 1 if successful or -1 on error
+ */
+int pyfwnt_decompressor_get_upper_bound(
+     pyfwnt_decompressor_t *pyfwnt_decompressor,
+     uint8_t flush,
+     size_t *upper_bound )
+{
+	static char *function             = "pyfwnt_decompressor_get_upper_bound";
+	size_t compressed_chunk_size      = 0;
+	size_t compressed_data_offset     = 0;
+	size_t safe_upper_bound           = 0;
+	uint16_t compression_chunk_header = 0;
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( upper_bound == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid upper bound.",
+		 function );
+
+		return( -1 );
+	}
+	safe_upper_bound = pyfwnt_decompressor->pending_data_size - pyfwnt_decompressor->pending_data_offset;
+
+	/* Every complete compressed chunk decompresses into at most 4096 bytes
+	 */
+	compressed_data_offset = pyfwnt_decompressor->compressed_data_offset;
+
+	while( ( compressed_data_offset + 2 ) <= pyfwnt_decompressor->compressed_data_size )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( pyfwnt_decompressor->compressed_data[ compressed_data_offset ] ),
+		 compression_chunk_header );
+
+		/* A chunk header of 0 marks the end of the compressed data
+		 */
+		if( compression_chunk_header == 0 )
+		{
+			compressed_data_offset = pyfwnt_decompressor->compressed_data_size;
+
+			break;
+		}
+		compressed_chunk_size = 2 + (size_t) ( compression_chunk_header & 0x0fff ) + 1;
+
+		if( compressed_chunk_size > ( pyfwnt_decompressor->compressed_data_size - compressed_data_offset ) )
+		{
+			break;
+		}
+		if( safe_upper_bound > ( (size_t) SSIZE_MAX - PYFWNT_DECOMPRESSOR_LZNT1_CHUNK_SIZE ) )
+		{
+			break;
+		}
+		safe_upper_bound       += PYFWNT_DECOMPRESSOR_LZNT1_CHUNK_SIZE;
+		compressed_data_offset += compressed_chunk_size;
+	}
+	/* Remaining compressed data, including a partial chunk header,
+	 * that does not form a complete chunk is truncated
+	 */
+	if( ( flush != 0 )
+	 && ( compressed_data_offset < pyfwnt_decompressor->compressed_data_size ) )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: compressed data is truncated.",
+		 function );
+
+		return( -1 );
+	}
+	*upper_bound = safe_upper_bound;
+
+	return( 1 );
+}
+
+/* Decompresses the next LZNT1 compressed chunk into the pending data
+ * Returns 1 if successful, 0 if no complete compressed chunk is available or -1 on error
+ */
+int pyfwnt_decompressor_decompress_next_chunk(
+     pyfwnt_decompressor_t *pyfwnt_decompressor )
+{
+	libcerror_error_t *error          = NULL;
+	static char *function             = "pyfwnt_decompressor_decompress_next_chunk";
+	size_t compressed_chunk_size      = 0;
+	size_t uncompressed_chunk_size    = 0;
+	uint16_t compression_chunk_header = 0;
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pyfwnt_decompressor->is_end_of_stream != 0 )
+	 || ( ( pyfwnt_decompressor->compressed_data_offset + 2 ) > pyfwnt_decompressor->compressed_data_size ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( pyfwnt_decompressor->compressed_data[ pyfwnt_decompressor->compressed_data_offset ] ),
+	 compression_chunk_header );
+
+	/* A chunk header of 0 marks the end of the compressed data
+	 */
+	if( compression_chunk_header == 0 )
+	{
+		pyfwnt_decompressor->compressed_data_offset = pyfwnt_decompressor->compressed_data_size;
+		pyfwnt_decompressor->is_end_of_stream       = 1;
+
+		return( 0 );
+	}
+	compressed_chunk_size = 2 + (size_t) ( compression_chunk_header & 0x0fff ) + 1;
+
+	if( compressed_chunk_size > ( pyfwnt_decompressor->compressed_data_size - pyfwnt_decompressor->compressed_data_offset ) )
+	{
+		return( 0 );
+	}
+	uncompressed_chunk_size = PYFWNT_DECOMPRESSOR_LZNT1_CHUNK_SIZE;
+
+	/* The GIL is not released since the state of the decompressor
+	 * is not protected against concurrent use
+	 */
+	if( libfwnt_lznt1_decompress(
+	     &( pyfwnt_decompressor->compressed_data[ pyfwnt_decompressor->compressed_data_offset ] ),
+	     compressed_chunk_size,
+	     pyfwnt_decompressor->pending_data,
+	     &uncompressed_chunk_size,
+	     &error ) != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to decompress chunk.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	pyfwnt_decompressor->compressed_data_offset += compressed_chunk_size;
+	pyfwnt_decompressor->pending_data_size       = uncompressed_chunk_size;
+	pyfwnt_decompressor->pending_data_offset     = 0;
+
+	return( 1 );
+}
+
+/* Reads decompressed data
+ * If maximum size is 0 all the data that can be decompressed is returned
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_decompressor_read_data(
+           pyfwnt_decompressor_t *pyfwnt_decompressor,
+           size_t maximum_size,
+           uint8_t flush )
+{
+	PyObject *data_string_object = NULL;
+	static char *function        = "pyfwnt_decompressor_read_data";
+	char *data                   = NULL;
+	size_t data_offset           = 0;
+	size_t data_size             = 0;
+	size_t read_size             = 0;
+	int result                   = 0;
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwnt_decompressor_get_upper_bound(
+	     pyfwnt_decompressor,
+	     flush,
+	     &data_size ) != 1 )
+	{
+		return( NULL );
+	}
+	if( ( maximum_size > 0 )
+	 && ( data_size > maximum_size ) )
+	{
+		data_size = maximum_size;
+	}
+#if PY_MAJOR_VERSION >= 3
+	data_string_object = PyBytes_FromStringAndSize(
+	                      NULL,
+	                      (Py_ssize_t) data_size );
+#else
+	data_string_object = PyString_FromStringAndSize(
+	                      NULL,
+	                      (Py_ssize_t) data_size );
+#endif
+	if( data_string_object == NULL )
+	{
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	data = PyBytes_AsString(
+	        data_string_object );
+#else
+	data = PyString_AsString(
+	        data_string_object );
+#endif
+	while( data_offset < data_size )
+	{
+		if( pyfwnt_decompressor->pending_data_offset >= pyfwnt_decompressor->pending_data_size )
+		{
+			result = pyfwnt_decompressor_decompress_next_chunk(
+			          pyfwnt_decompressor );
+
+			if( result == -1 )
+			{
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		read_size = pyfwnt_decompressor->pending_data_size - pyfwnt_decompressor->pending_data_offset;
+
+		if( read_size > ( data_size - data_offset ) )
+		{
+			read_size = data_size - data_offset;
+		}
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     &( pyfwnt_decompressor->pending_data[ pyfwnt_decompressor->pending_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to copy pending data.",
+			 function );
+
+			goto on_error;
+		}
+		pyfwnt_decompressor->pending_data_offset += read_size;
+		data_offset                              += read_size;
+	}
+	/* Need to resize the string here in case the upper bound was not reached.
+	 */
+#if PY_MAJOR_VERSION >= 3
+	if( _PyBytes_Resize(
+	     &data_string_object,
+	     (Py_ssize_t) data_offset ) != 0 )
+#else
+	if( _PyString_Resize(
+	     &data_string_object,
+	     (Py_ssize_t) data_offset ) != 0 )
+#endif
+	{
+		return( NULL );
+	}
+	return( data_string_object );
+
+on_error:
+	Py_DecRef(
+	 (PyObject *) data_string_object );
+
+	return( NULL );
+}
+
+/* Decompresses data
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_decompressor_decompress(
+           pyfwnt_decompressor_t *pyfwnt_decompressor,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer compressed_data_buffer;
+
+	PyObject *compressed_data_object = NULL;
+	static char *function            = "pyfwnt_decompressor_decompress";
+	static char *keyword_list[]      = { "compressed_data", "max_length", NULL };
+	int max_length                   = 0;
+	int result                       = 0;
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwnt_decompressor->pending_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor - missing pending data.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwnt_decompressor->is_flushed != 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor - already flushed.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &compressed_data_object,
+	     &max_length ) == 0 )
+	{
+		return( NULL );
+	}
+	if( max_length < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument max length value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     compressed_data_object,
+	     &compressed_data_buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	result = pyfwnt_decompressor_append_compressed_data(
+	          pyfwnt_decompressor,
+	          (uint8_t *) compressed_data_buffer.buf,
+	          (size_t) compressed_data_buffer.len );
+
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
+	if( result != 1 )
+	{
+		return( NULL );
+	}
+	return( pyfwnt_decompressor_read_data(
+	         pyfwnt_decompressor,
+	         (size_t) max_length,
+	         0 ) );
+}
+
+/* Flushes the decompressor
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_decompressor_flush(
+           pyfwnt_decompressor_t *pyfwnt_decompressor,
+           PyObject *arguments PYFWNT_ATTRIBUTE_UNUSED )
+{
+	PyObject *data_string_object = NULL;
+	static char *function        = "pyfwnt_decompressor_flush";
+
+	PYFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwnt_decompressor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwnt_decompressor->pending_data == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid decompressor - missing pending data.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyfwnt_decompressor->is_flushed != 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		return( PyBytes_FromStringAndSize(
+		         NULL,
+		         0 ) );
+#else
+		return( PyString_FromStringAndSize(
+		         NULL,
+		         0 ) );
+#endif
+	}
+	data_string_object = pyfwnt_decompressor_read_data(
+	                      pyfwnt_decompressor,
+	                      0,
+	                      1 );
+
+	if( data_string_object != NULL )
+	{
+		pyfwnt_decompressor->is_flushed = 1;
+	}
+	return( data_string_object );
+}
+
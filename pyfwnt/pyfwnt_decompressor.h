@@ -0,0 +1,132 @@
+/*
+ * Python object wrapper of a streaming decompressor
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _PYFWNT_DECOMPRESSOR_H )
+#define _PYFWNT_DECOMPRESSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyfwnt_libfwnt.h"
+#include "pyfwnt_python.h"
+
+/* The maximum size of the uncompressed data of a LZNT1 compressed chunk
+ */
+#define PYFWNT_DECOMPRESSOR_LZNT1_CHUNK_SIZE	4096
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyfwnt_decompressor pyfwnt_decompressor_t;
+
+struct pyfwnt_decompressor
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The buffered compressed data
+	 */
+	uint8_t *compressed_data;
+
+	/* The size of the buffered compressed data
+	 */
+	size_t compressed_data_size;
+
+	/* The allocated size of the buffered compressed data
+	 */
+	size_t compressed_data_allocated_size;
+
+	/* The offset of the compressed data that has not been decompressed
+	 */
+	size_t compressed_data_offset;
+
+	/* The decompressed data that has not yet been returned
+	 */
+	uint8_t *pending_data;
+
+	/* The allocated size of the pending data
+	 */
+	size_t pending_data_allocated_size;
+
+	/* The size of the pending data
+	 */
+	size_t pending_data_size;
+
+	/* The offset of the pending data that has not yet been returned
+	 */
+	size_t pending_data_offset;
+
+	/* Value to indicate the end of the compressed data was reached
+	 */
+	uint8_t is_end_of_stream;
+
+	/* Value to indicate the decompressor was flushed
+	 */
+	uint8_t is_flushed;
+};
+
+extern PyMethodDef pyfwnt_decompressor_object_methods[];
+extern PyTypeObject pyfwnt_lznt1_decompressor_type_object;
+
+int pyfwnt_lznt1_decompressor_init(
+     pyfwnt_decompressor_t *pyfwnt_decompressor,
+     PyObject *arguments,
+     PyObject *keywords );
+
+void pyfwnt_decompressor_free(
+      pyfwnt_decompressor_t *pyfwnt_decompressor );
+
+int pyfwnt_decompressor_append_compressed_data(
+     pyfwnt_decompressor_t *pyfwnt_decompressor,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size );
+
+int pyfwnt_decompressor_get_upper_bound(
+     pyfwnt_decompressor_t *pyfwnt_decompressor,
+     uint8_t flush,
+     size_t *upper_bound );
+
+int pyfwnt_decompressor_decompress_next_chunk(
+     pyfwnt_decompressor_t *pyfwnt_decompressor );
+
+PyObject *pyfwnt_decompressor_read_data(
+           pyfwnt_decompressor_t *pyfwnt_decompressor,
+           size_t maximum_size,
+           uint8_t flush );
+
+PyObject *pyfwnt_decompressor_decompress(
+           pyfwnt_decompressor_t *pyfwnt_decompressor,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwnt_decompressor_flush(
+           pyfwnt_decompressor_t *pyfwnt_decompressor,
+           PyObject *arguments );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYFWNT_DECOMPRESSOR_H ) */
+
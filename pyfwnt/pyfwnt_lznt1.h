@@ -36,6 +36,16 @@ PyObject *pyfwnt_lznt1_decompress(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwnt_lznt1_decompress_into(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwnt_lznt1_decompress_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
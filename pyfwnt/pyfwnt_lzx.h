@@ -36,6 +36,16 @@ PyObject *pyfwnt_lzx_decompress(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwnt_lzx_decompress_into(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwnt_lzx_decompress_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
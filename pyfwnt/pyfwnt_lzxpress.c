@@ -22,6 +22,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "pyfwnt_decompress.h"
 #include "pyfwnt_error.h"
 #include "pyfwnt_libcerror.h"
 #include "pyfwnt_libfwnt.h"
@@ -36,25 +37,27 @@ PyObject *pyfwnt_lzxpress_decompress(
            PyObject *arguments,
            PyObject *keywords )
 {
+	Py_buffer compressed_data_buffer;
+
 	libcerror_error_t *error                  = NULL;
-	PyObject *compressed_data_string_object   = NULL;
+	PyObject *compressed_data_object          = NULL;
 	PyObject *uncompressed_data_string_object = NULL;
 	static char *function                     = "pyfwnt_lzxpress_decompress";
-	static char *keyword_list[]               = { "compressed_data", "uncompressed_data_size", NULL };
-	char *compressed_data                     = NULL;
+	static char *keyword_list[]               = { "compressed_data", "uncompressed_data_size", "maximum_uncompressed_data_size", NULL };
 	char *uncompressed_data                   = NULL;
-	Py_ssize_t compressed_data_size           = 0;
 	size_t safe_uncompressed_data_size        = 0;
+	int maximum_uncompressed_data_size        = PYFWNT_DECOMPRESS_DEFAULT_MAXIMUM_SIZE;
 	int uncompressed_data_size                = 0;
 	int result                                = 0;
 
 	if( PyArg_ParseTupleAndKeywords(
 	     arguments,
 	     keywords,
-	     "O|i",
+	     "O|ii",
 	     keyword_list,
-	     &compressed_data_string_object,
-	     &uncompressed_data_size ) == 0 )
+	     &compressed_data_object,
+	     &uncompressed_data_size,
+	     &maximum_uncompressed_data_size ) == 0 )
 	{
 		return( NULL );
 	}
@@ -78,23 +81,27 @@ PyObject *pyfwnt_lzxpress_decompress(
 
 		return( NULL );
 	}
-/* TODO allow uncompressed_data_size to be 0 and estimate uncompressed data size */
-
-#if PY_MAJOR_VERSION >= 3
-	compressed_data = PyBytes_AsString(
-	                   compressed_data_string_object );
-
-	compressed_data_size = PyBytes_Size(
-	                        compressed_data_string_object );
-#else
-	compressed_data = PyString_AsString(
-	                   compressed_data_string_object );
+	if( maximum_uncompressed_data_size <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument maximum uncompressed data size value zero or less.",
+		 function );
 
-	compressed_data_size = PyString_Size(
-	                        compressed_data_string_object );
-#endif
-	if( ( compressed_data_size < 0 )
-	 || ( compressed_data_size > (Py_ssize_t) SSIZE_MAX ) )
+		return( NULL );
+	}
+	/* Any object that supports the buffer protocol, such as bytes, bytearray,
+	 * memoryview or mmap, is accepted without copying its data
+	 */
+	if( PyObject_GetBuffer(
+	     compressed_data_object,
+	     &compressed_data_buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	if( ( compressed_data_buffer.len < 0 )
+	 || ( compressed_data_buffer.len > (Py_ssize_t) SSIZE_MAX ) )
 	{
 		PyErr_Format(
 		 PyExc_ValueError,
@@ -103,18 +110,39 @@ PyObject *pyfwnt_lzxpress_decompress(
 
 		goto on_error;
 	}
+	/* If the uncompressed data size is not known determine it by growing
+	 * the uncompressed data until the decompressed data fits
+	 */
+	if( uncompressed_data_size == 0 )
+	{
+		uncompressed_data_string_object = pyfwnt_decompress_with_estimated_size(
+		                                   libfwnt_lzxpress_decompress,
+		                                   (uint8_t *) compressed_data_buffer.buf,
+		                                   (size_t) compressed_data_buffer.len,
+		                                   (size_t) maximum_uncompressed_data_size );
+
+		PyBuffer_Release(
+		 &compressed_data_buffer );
+
+		return( uncompressed_data_string_object );
+	}
 #if PY_MAJOR_VERSION >= 3
 	uncompressed_data_string_object = PyBytes_FromStringAndSize(
 	                                   NULL,
 	                                   uncompressed_data_size );
-
-	uncompressed_data = PyBytes_AsString(
-	                     uncompressed_data_string_object );
 #else
 	uncompressed_data_string_object = PyString_FromStringAndSize(
 	                                   NULL,
 	                                   uncompressed_data_size );
-
+#endif
+	if( uncompressed_data_string_object == NULL )
+	{
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	uncompressed_data = PyBytes_AsString(
+	                     uncompressed_data_string_object );
+#else
 	uncompressed_data = PyString_AsString(
 	                     uncompressed_data_string_object );
 #endif
@@ -123,14 +151,17 @@ PyObject *pyfwnt_lzxpress_decompress(
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libfwnt_lzxpress_decompress(
-	          (uint8_t *) compressed_data,
-	          (size_t) compressed_data_size,
+	          (uint8_t *) compressed_data_buffer.buf,
+	          (size_t) compressed_data_buffer.len,
 	          (uint8_t *) uncompressed_data,
 	          &safe_uncompressed_data_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
 
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
 	if( result != 1 )
 	{
 		pyfwnt_error_raise(
@@ -142,7 +173,10 @@ PyObject *pyfwnt_lzxpress_decompress(
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		Py_DecRef(
+		 (PyObject *) uncompressed_data_string_object );
+
+		return( NULL );
 	}
 	/* Need to resize the string here in case read_size was not fully read.
 	 */
@@ -156,7 +190,9 @@ PyObject *pyfwnt_lzxpress_decompress(
 	     (Py_ssize_t) safe_uncompressed_data_size ) != 0 )
 #endif
 	{
-		goto on_error;
+		/* On failure the resize function releases the string object
+		 */
+		return( NULL );
 	}
 	return( uncompressed_data_string_object );
 
@@ -166,9 +202,144 @@ on_error:
 		Py_DecRef(
 		 (PyObject *) uncompressed_data_string_object );
 	}
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
+	return( NULL );
+}
+
+/* Decompresses data using LZXPRESS compression into a caller provided buffer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_lzxpress_decompress_into(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer compressed_data_buffer;
+	Py_buffer uncompressed_data_buffer;
+
+	libcerror_error_t *error           = NULL;
+	PyObject *compressed_data_object   = NULL;
+	PyObject *uncompressed_data_object = NULL;
+	static char *function              = "pyfwnt_lzxpress_decompress_into";
+	static char *keyword_list[]        = { "compressed_data", "uncompressed_data", NULL };
+	size_t safe_uncompressed_data_size = 0;
+	int result                         = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OO",
+	     keyword_list,
+	     &compressed_data_object,
+	     &uncompressed_data_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     compressed_data_object,
+	     &compressed_data_buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     uncompressed_data_object,
+	     &uncompressed_data_buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		PyBuffer_Release(
+		 &compressed_data_buffer );
+
+		return( NULL );
+	}
+	if( ( compressed_data_buffer.len < 0 )
+	 || ( compressed_data_buffer.len > (Py_ssize_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument compressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the number of bytes written can be returned as an integer
+	 */
+	if( ( uncompressed_data_buffer.len < 0 )
+	 || ( uncompressed_data_buffer.len > (Py_ssize_t) INT_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_uncompressed_data_size = (size_t) uncompressed_data_buffer.len;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwnt_lzxpress_decompress(
+	          (uint8_t *) compressed_data_buffer.buf,
+	          (size_t) compressed_data_buffer.len,
+	          (uint8_t *) uncompressed_data_buffer.buf,
+	          &safe_uncompressed_data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to decompress data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	PyBuffer_Release(
+	 &uncompressed_data_buffer );
+
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
+#if PY_MAJOR_VERSION >= 3
+	return( PyLong_FromLong(
+	         (long) safe_uncompressed_data_size ) );
+#else
+	return( PyInt_FromLong(
+	         (long) safe_uncompressed_data_size ) );
+#endif
+
+on_error:
+	PyBuffer_Release(
+	 &uncompressed_data_buffer );
+
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
 	return( NULL );
 }
 
+/* Decompresses many buffers using LZXPRESS compression
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_lzxpress_decompress_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	return( pyfwnt_decompress_many(
+	         libfwnt_lzxpress_decompress,
+	         arguments,
+	         keywords ) );
+}
+
 /* Decompresses data using LZXPRESS Huffman compression
  * Returns a Python object if successful or NULL on error
  */
@@ -177,14 +348,14 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
            PyObject *arguments,
            PyObject *keywords )
 {
+	Py_buffer compressed_data_buffer;
+
 	libcerror_error_t *error                  = NULL;
-	PyObject *compressed_data_string_object   = NULL;
+	PyObject *compressed_data_object          = NULL;
 	PyObject *uncompressed_data_string_object = NULL;
 	static char *function                     = "pyfwnt_lzxpress_huffman_decompress";
 	static char *keyword_list[]               = { "compressed_data", "uncompressed_data_size", NULL };
-	char *compressed_data                     = NULL;
 	char *uncompressed_data                   = NULL;
-	Py_ssize_t compressed_data_size           = 0;
 	size_t safe_uncompressed_data_size        = 0;
 	int uncompressed_data_size                = 0;
 	int result                                = 0;
@@ -194,16 +365,19 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
 	     keywords,
 	     "O|i",
 	     keyword_list,
-	     &compressed_data_string_object,
+	     &compressed_data_object,
 	     &uncompressed_data_size ) == 0 )
 	{
 		return( NULL );
 	}
-	if( uncompressed_data_size < 0 )
+	/* The end of LZXPRESS Huffman compressed data is defined by
+	 * the uncompressed data size hence it cannot be estimated
+	 */
+	if( uncompressed_data_size <= 0 )
 	{
 		PyErr_Format(
 		 PyExc_ValueError,
-		 "%s: invalid argument uncompressed data size value less than zero.",
+		 "%s: invalid argument uncompressed data size value zero or less.",
 		 function );
 
 		return( NULL );
@@ -219,23 +393,18 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
 
 		return( NULL );
 	}
-/* TODO allow uncompressed_data_size to be 0 and estimate uncompressed data size */
-
-#if PY_MAJOR_VERSION >= 3
-	compressed_data = PyBytes_AsString(
-	                   compressed_data_string_object );
-
-	compressed_data_size = PyBytes_Size(
-	                        compressed_data_string_object );
-#else
-	compressed_data = PyString_AsString(
-	                   compressed_data_string_object );
-
-	compressed_data_size = PyString_Size(
-	                        compressed_data_string_object );
-#endif
-	if( ( compressed_data_size < 0 )
-	 || ( compressed_data_size > (Py_ssize_t) SSIZE_MAX ) )
+	/* Any object that supports the buffer protocol, such as bytes, bytearray,
+	 * memoryview or mmap, is accepted without copying its data
+	 */
+	if( PyObject_GetBuffer(
+	     compressed_data_object,
+	     &compressed_data_buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	if( ( compressed_data_buffer.len < 0 )
+	 || ( compressed_data_buffer.len > (Py_ssize_t) SSIZE_MAX ) )
 	{
 		PyErr_Format(
 		 PyExc_ValueError,
@@ -248,14 +417,19 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
 	uncompressed_data_string_object = PyBytes_FromStringAndSize(
 	                                   NULL,
 	                                   uncompressed_data_size );
-
-	uncompressed_data = PyBytes_AsString(
-	                     uncompressed_data_string_object );
 #else
 	uncompressed_data_string_object = PyString_FromStringAndSize(
 	                                   NULL,
 	                                   uncompressed_data_size );
-
+#endif
+	if( uncompressed_data_string_object == NULL )
+	{
+		goto on_error;
+	}
+#if PY_MAJOR_VERSION >= 3
+	uncompressed_data = PyBytes_AsString(
+	                     uncompressed_data_string_object );
+#else
 	uncompressed_data = PyString_AsString(
 	                     uncompressed_data_string_object );
 #endif
@@ -264,14 +438,17 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libfwnt_lzxpress_huffman_decompress(
-	          (uint8_t *) compressed_data,
-	          (size_t) compressed_data_size,
+	          (uint8_t *) compressed_data_buffer.buf,
+	          (size_t) compressed_data_buffer.len,
 	          (uint8_t *) uncompressed_data,
 	          &safe_uncompressed_data_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
 
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
 	if( result != 1 )
 	{
 		pyfwnt_error_raise(
@@ -283,7 +460,10 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		Py_DecRef(
+		 (PyObject *) uncompressed_data_string_object );
+
+		return( NULL );
 	}
 	/* Need to resize the string here in case read_size was not fully read.
 	 */
@@ -297,7 +477,9 @@ PyObject *pyfwnt_lzxpress_huffman_decompress(
 	     (Py_ssize_t) safe_uncompressed_data_size ) != 0 )
 #endif
 	{
-		goto on_error;
+		/* On failure the resize function releases the string object
+		 */
+		return( NULL );
 	}
 	return( uncompressed_data_string_object );
 
@@ -307,6 +489,141 @@ on_error:
 		Py_DecRef(
 		 (PyObject *) uncompressed_data_string_object );
 	}
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
+	return( NULL );
+}
+
+/* Decompresses data using LZXPRESS Huffman compression into a caller provided buffer
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_lzxpress_huffman_decompress_into(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	Py_buffer compressed_data_buffer;
+	Py_buffer uncompressed_data_buffer;
+
+	libcerror_error_t *error           = NULL;
+	PyObject *compressed_data_object   = NULL;
+	PyObject *uncompressed_data_object = NULL;
+	static char *function              = "pyfwnt_lzxpress_huffman_decompress_into";
+	static char *keyword_list[]        = { "compressed_data", "uncompressed_data", NULL };
+	size_t safe_uncompressed_data_size = 0;
+	int result                         = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "OO",
+	     keyword_list,
+	     &compressed_data_object,
+	     &uncompressed_data_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     compressed_data_object,
+	     &compressed_data_buffer,
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	if( PyObject_GetBuffer(
+	     uncompressed_data_object,
+	     &uncompressed_data_buffer,
+	     PyBUF_WRITABLE ) != 0 )
+	{
+		PyBuffer_Release(
+		 &compressed_data_buffer );
+
+		return( NULL );
+	}
+	if( ( compressed_data_buffer.len < 0 )
+	 || ( compressed_data_buffer.len > (Py_ssize_t) SSIZE_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument compressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the number of bytes written can be returned as an integer
+	 */
+	if( ( uncompressed_data_buffer.len < 0 )
+	 || ( uncompressed_data_buffer.len > (Py_ssize_t) INT_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid argument uncompressed data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_uncompressed_data_size = (size_t) uncompressed_data_buffer.len;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwnt_lzxpress_huffman_decompress(
+	          (uint8_t *) compressed_data_buffer.buf,
+	          (size_t) compressed_data_buffer.len,
+	          (uint8_t *) uncompressed_data_buffer.buf,
+	          &safe_uncompressed_data_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to decompress data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	PyBuffer_Release(
+	 &uncompressed_data_buffer );
+
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
+#if PY_MAJOR_VERSION >= 3
+	return( PyLong_FromLong(
+	         (long) safe_uncompressed_data_size ) );
+#else
+	return( PyInt_FromLong(
+	         (long) safe_uncompressed_data_size ) );
+#endif
+
+on_error:
+	PyBuffer_Release(
+	 &uncompressed_data_buffer );
+
+	PyBuffer_Release(
+	 &compressed_data_buffer );
+
 	return( NULL );
 }
 
+/* Decompresses many buffers using LZXPRESS Huffman compression
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_lzxpress_huffman_decompress_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	return( pyfwnt_decompress_many(
+	         libfwnt_lzxpress_huffman_decompress,
+	         arguments,
+	         keywords ) );
+}
+
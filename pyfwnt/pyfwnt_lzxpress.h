@@ -36,11 +36,31 @@ PyObject *pyfwnt_lzxpress_decompress(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwnt_lzxpress_decompress_into(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwnt_lzxpress_decompress_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pyfwnt_lzxpress_huffman_decompress(
            PyObject *self,
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwnt_lzxpress_huffman_decompress_into(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyfwnt_lzxpress_huffman_decompress_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -44,6 +44,20 @@ PyMethodDef pyfwnt_security_descriptor_object_methods[] = {
 	  "\n"
 	  "Copies the security descriptor from the byte stream." },
 
+	{ "get_revision_number",
+	  (PyCFunction) pyfwnt_security_descriptor_get_revision_number,
+	  METH_NOARGS,
+	  "get_revision_number() -> Integer\n"
+	  "\n"
+	  "Retrieves the revision number." },
+
+	{ "get_control_flags",
+	  (PyCFunction) pyfwnt_security_descriptor_get_control_flags,
+	  METH_NOARGS,
+	  "get_control_flags() -> Integer\n"
+	  "\n"
+	  "Retrieves the control flags." },
+
 	{ "get_owner",
 	  (PyCFunction) pyfwnt_security_descriptor_get_owner,
 	  METH_NOARGS,
@@ -72,12 +86,31 @@ PyMethodDef pyfwnt_security_descriptor_object_methods[] = {
 	  "\n"
 	  "Retrieves the system access control list (ACL)." },
 
+	{ "get_sddl_string",
+	  (PyCFunction) pyfwnt_security_descriptor_get_sddl_string,
+	  METH_NOARGS,
+	  "get_sddl_string() -> Unicode string\n"
+	  "\n"
+	  "Retrieves the security descriptor definition language (SDDL) string." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
 
 PyGetSetDef pyfwnt_security_descriptor_object_get_set_definitions[] = {
 
+	{ "revision_number",
+	  (getter) pyfwnt_security_descriptor_get_revision_number,
+	  (setter) 0,
+	  "The revision number.",
+	  NULL },
+
+	{ "control_flags",
+	  (getter) pyfwnt_security_descriptor_get_control_flags,
+	  (setter) 0,
+	  "The control flags.",
+	  NULL },
+
 	{ "owner",
 	  (getter) pyfwnt_security_descriptor_get_owner,
 	  (setter) 0,
@@ -102,6 +135,12 @@ PyGetSetDef pyfwnt_security_descriptor_object_get_set_definitions[] = {
 	  "The system access control list (ACL).",
 	  NULL },
 
+	{ "sddl_string",
+	  (getter) pyfwnt_security_descriptor_get_sddl_string,
+	  (setter) 0,
+	  "The security descriptor definition language (SDDL) string.",
+	  NULL },
+
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -425,6 +464,118 @@ PyObject *pyfwnt_security_descriptor_copy_from_byte_stream(
 	return( Py_None );
 }
 
+/* Retrieves the revision number
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_security_descriptor_get_revision_number(
+           pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
+           PyObject *arguments PYFWNT_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwnt_security_descriptor_get_revision_number";
+	uint8_t revision_number  = 0;
+	int result               = 0;
+
+	PYFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwnt_security_descriptor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwnt_security_descriptor_get_revision_number(
+	          pyfwnt_security_descriptor->security_descriptor,
+	          &revision_number,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve revision number.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) revision_number );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) revision_number );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves the control flags
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_security_descriptor_get_control_flags(
+           pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
+           PyObject *arguments PYFWNT_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyfwnt_security_descriptor_get_control_flags";
+	uint16_t control_flags   = 0;
+	int result               = 0;
+
+	PYFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwnt_security_descriptor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwnt_security_descriptor_get_control_flags(
+	          pyfwnt_security_descriptor->security_descriptor,
+	          &control_flags,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve control flags.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) control_flags );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) control_flags );
+#endif
+	return( integer_object );
+}
+
 /* Retrieves the owner security identifier (SID)
  * Returns a Python object if successful or NULL on error
  */
@@ -737,3 +888,116 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the security descriptor definition language (SDDL) string
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyfwnt_security_descriptor_get_sddl_string(
+           pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
+           PyObject *arguments PYFWNT_ATTRIBUTE_UNUSED )
+{
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	uint8_t *utf8_string     = NULL;
+	static char *function    = "pyfwnt_security_descriptor_get_sddl_string";
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	PYFWNT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyfwnt_security_descriptor == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid security descriptor.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwnt_security_descriptor_get_utf8_sddl_string_size(
+	          pyfwnt_security_descriptor->security_descriptor,
+	          &utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to determine size of SDDL string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) PyMem_Malloc(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          pyfwnt_security_descriptor->security_descriptor,
+	          utf8_string,
+	          utf8_string_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyfwnt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve SDDL string.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) utf8_string,
+	                 (Py_ssize_t) utf8_string_size - 1,
+	                 NULL );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		goto on_error;
+	}
+	PyMem_Free(
+	 utf8_string );
+
+	return( string_object );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		PyMem_Free(
+		 utf8_string );
+	}
+	return( NULL );
+}
+
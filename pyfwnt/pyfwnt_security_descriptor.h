@@ -59,6 +59,14 @@ PyObject *pyfwnt_security_descriptor_copy_from_byte_stream(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pyfwnt_security_descriptor_get_revision_number(
+           pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
+           PyObject *arguments );
+
+PyObject *pyfwnt_security_descriptor_get_control_flags(
+           pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
+           PyObject *arguments );
+
 PyObject *pyfwnt_security_descriptor_get_owner(
            pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
            PyObject *arguments );
@@ -75,6 +83,10 @@ PyObject *pyfwnt_security_descriptor_get_system_acl(
            pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
            PyObject *arguments );
 
+PyObject *pyfwnt_security_descriptor_get_sddl_string(
+           pyfwnt_security_descriptor_t *pyfwnt_security_descriptor,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -449,13 +449,12 @@ PyObject *pyfwnt_security_identifier_get_string(
            pyfwnt_security_identifier_t *pyfwnt_security_identifier,
            PyObject *arguments PYFWNT_ATTRIBUTE_UNUSED )
 {
-	PyObject *string_object      = NULL;
-	libcerror_error_t *error     = NULL;
-	static char *function        = "pyfwnt_security_identifier_get_string";
-	char *utf8_string            = NULL;
-	size_t string_size           = 0;
-	uint32_t string_format_flags = 0;
-	int result                   = 0;
+	PyObject *string_object    = NULL;
+	libcerror_error_t *error   = NULL;
+	const uint8_t *utf8_string = NULL;
+	static char *function      = "pyfwnt_security_identifier_get_string";
+	size_t utf8_string_length  = 0;
+	int result                 = 0;
 
 	PYFWNT_UNREFERENCED_PARAMETER( arguments )
 
@@ -468,60 +467,12 @@ PyObject *pyfwnt_security_identifier_get_string(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libfwnt_security_identifier_get_string_size(
-	          pyfwnt_security_identifier->security_identifier,
-	          &string_size,
-	          string_format_flags,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result == -1 )
-	{
-		pyfwnt_error_raise(
-		 error,
-		 PyExc_IOError,
-		 "%s: unable to determine size of string as string.",
-		 function );
-
-		libcerror_error_free(
-		 &error );
-
-		goto on_error;
-	}
-	else if( ( result == 0 )
-	      || ( string_size == 0 ) )
-	{
-		Py_IncRef(
-		 Py_None );
-
-		return( Py_None );
-	}
-	utf8_string = (char *) PyMem_Malloc(
-	                        sizeof( char ) * string_size );
-
-	if( utf8_string == NULL )
-	{
-		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to create UTF-8 string.",
-		 function );
-
-		goto on_error;
-	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_get_utf8_string_reference(
 	          pyfwnt_security_identifier->security_identifier,
-	          (uint8_t *) utf8_string,
-	          string_size,
-	          string_format_flags,
+	          &utf8_string,
+	          &utf8_string_length,
 	          &error );
 
-	Py_END_ALLOW_THREADS
-
 	if( result != 1 )
 	{
 		pyfwnt_error_raise(
@@ -533,14 +484,11 @@ PyObject *pyfwnt_security_identifier_get_string(
 		libcerror_error_free(
 		 &error );
 
-		goto on_error;
+		return( NULL );
 	}
-	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
-	 * the end of string character is part of the string.
-	 */
 	string_object = PyUnicode_DecodeUTF8(
-	                 utf8_string,
-	                 (Py_ssize_t) string_size - 1,
+	                 (char *) utf8_string,
+	                 (Py_ssize_t) utf8_string_length,
 	                 NULL );
 
 	if( string_object == NULL )
@@ -550,19 +498,8 @@ PyObject *pyfwnt_security_identifier_get_string(
 		 "%s: unable to convert UTF-8 string into Unicode object.",
 		 function );
 
-		goto on_error;
+		return( NULL );
 	}
-	PyMem_Free(
-	 utf8_string );
-
 	return( string_object );
-
-on_error:
-	if( utf8_string != NULL )
-	{
-		PyMem_Free(
-		 utf8_string );
-	}
-	return( NULL );
 }
 
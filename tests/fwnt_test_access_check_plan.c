@@ -0,0 +1,2453 @@
+/*
+ * Library access_check_plan type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_access_check_plan.h"
+
+/* S-1-5-32-544
+ */
+uint8_t fwnt_test_access_check_plan_data1[ 16 ] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00 };
+
+/* S-1-5-32-545
+ */
+uint8_t fwnt_test_access_check_plan_data2[ 16 ] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00 };
+
+/* S-1-1-0
+ */
+uint8_t fwnt_test_access_check_plan_data3[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 };
+
+/* S-1-5-18
+ */
+uint8_t fwnt_test_access_check_plan_data4[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Security descriptor with a discretionary ACL that denies and allows S-1-5-32-545 in consecutive entries
+ */
+uint8_t fwnt_test_access_check_plan_data5[ 144 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x74, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x21, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x12, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Security descriptor without a discretionary ACL
+ */
+uint8_t fwnt_test_access_check_plan_data6[ 48 ] = {
+	0x01, 0x00, 0x00, 0x80, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Security descriptor with a discretionary ACL that contains OWNER RIGHTS and callback entries
+ */
+uint8_t fwnt_test_access_check_plan_data7[ 144 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x74, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwnt_access_check_plan_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfwnt_access_check_plan_t *access_check_plan = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	access_check_plan = (libfwnt_access_check_plan_t *) 0x12345678UL;
+
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	access_check_plan = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_access_check_plan_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_access_check_plan_initialize(
+		          &access_check_plan,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( access_check_plan != NULL )
+			{
+				libfwnt_access_check_plan_free(
+				 &access_check_plan,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "access_check_plan",
+			 access_check_plan );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_compile_security_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_compile_security_descriptor(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int number_of_entries                              = 0;
+	int number_of_security_identifiers                 = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data5,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_get_number_of_security_identifiers(
+	          access_check_plan,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 2 );
+
+	result = libfwnt_access_check_plan_get_number_of_entries(
+	          access_check_plan,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	/* Test recompiling the access check plan
+	 */
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_get_number_of_entries(
+	          access_check_plan,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          NULL,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_compile_access_control_list function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_compile_access_control_list(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_access_control_list_t *discretionary_acl   = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int number_of_security_identifiers                 = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data5,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl(
+	          security_descriptor,
+	          &discretionary_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "discretionary_acl",
+	 discretionary_acl );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_compile_access_control_list(
+	          access_check_plan,
+	          discretionary_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_get_number_of_security_identifiers(
+	          access_check_plan,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_compile_access_control_list(
+	          NULL,
+	          discretionary_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_compile_access_control_list(
+	          access_check_plan,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_access_control_list_free(
+	          &discretionary_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( discretionary_acl != NULL )
+	{
+		libfwnt_access_control_list_free(
+		 &discretionary_acl,
+		 NULL );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_get_flags(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int result                                         = 0;
+	uint8_t flags                                      = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data7,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_get_flags(
+	          access_check_plan,
+	          &flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 (uint8_t) ( LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_OWNER_RIGHTS | LIBFWNT_ACCESS_CHECK_PLAN_FLAG_HAS_CALLBACK_ENTRIES ) );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data6,
+	          48,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_get_flags(
+	          access_check_plan,
+	          &flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 (uint8_t) LIBFWNT_ACCESS_CHECK_PLAN_FLAG_NO_DISCRETIONARY_ACL );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_get_flags(
+	          access_check_plan,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_get_number_of_security_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_get_number_of_security_identifiers(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int number_of_security_identifiers                 = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data7,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_get_number_of_security_identifiers(
+	          access_check_plan,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_get_number_of_security_identifiers(
+	          NULL,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_get_number_of_security_identifiers(
+	          access_check_plan,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int number_of_entries                              = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data7,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_get_number_of_entries(
+	          access_check_plan,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_get_number_of_entries(
+	          access_check_plan,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_check_access function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_check_access(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_access_token_t *access_token               = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	uint32_t granted_access                            = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data5,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_check_plan_data2,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) 0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000000UL );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) 0x00000002UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000002UL );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000002UL );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_check_plan_data4,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x001f01feUL );
+
+	/* Test with the owner of the security descriptor
+	 */
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_check_plan_data1,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) ( LIBFWNT_ACCESS_MASK_READ_CONTROL | LIBFWNT_ACCESS_MASK_WRITE_DAC ) );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) 0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000000UL );
+
+	/* Test with OWNER RIGHTS and a denied callback entry
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data7,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_check_plan_data2,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000001UL );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_check_plan_data3,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000005UL );
+
+	/* Test without a discretionary ACL
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data6,
+	          48,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) 0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000001UL );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x001fffffUL );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_check_access(
+	          NULL,
+	          access_token,
+	          (uint32_t) 0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          NULL,
+	          (uint32_t) 0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_check_access(
+	          access_check_plan,
+	          access_token,
+	          (uint32_t) 0x00000001UL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_check_plan_check_access_for_tokens function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_check_plan_check_access_for_tokens(
+     void )
+{
+	libfwnt_access_token_t *access_tokens[ 2 ] = { NULL, NULL };
+	uint32_t expected_access_masks[ 2 ]        = { 0, 0 };
+	uint32_t granted_access_masks[ 2 ]         = { 0, 0 };
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_check_plan_t *access_check_plan     = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int access_token_index                             = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_check_plan_initialize(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_access_check_plan_data5,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_tokens[ 0 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_tokens[ 0 ]",
+	 access_tokens[ 0 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_tokens[ 0 ],
+	          fwnt_test_access_check_plan_data2,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_tokens[ 1 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_tokens[ 1 ]",
+	 access_tokens[ 1 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_tokens[ 1 ],
+	          fwnt_test_access_check_plan_data4,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_compile_security_descriptor(
+	          access_check_plan,
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_check_plan_check_access_for_tokens(
+	          access_check_plan,
+	          access_tokens,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 0 ]",
+	 granted_access_masks[ 0 ],
+	 (uint32_t) 0x00000002UL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 1 ]",
+	 granted_access_masks[ 1 ],
+	 (uint32_t) 0x001f01ffUL );
+
+	/* Test that the result is the same as that of the security descriptor
+	 */
+	result = libfwnt_security_descriptor_check_access_for_tokens(
+	          security_descriptor,
+	          access_tokens,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          expected_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 0 ]",
+	 granted_access_masks[ 0 ],
+	 expected_access_masks[ 0 ] );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 1 ]",
+	 granted_access_masks[ 1 ],
+	 expected_access_masks[ 1 ] );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_check_plan_check_access_for_tokens(
+	          NULL,
+	          access_tokens,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_check_access_for_tokens(
+	          access_check_plan,
+	          NULL,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_check_access_for_tokens(
+	          access_check_plan,
+	          access_tokens,
+	          -1,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_check_plan_check_access_for_tokens(
+	          access_check_plan,
+	          access_tokens,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( access_token_index = 0;
+	     access_token_index < 2;
+	     access_token_index++ )
+	{
+		result = libfwnt_access_token_free(
+		          &( access_tokens[ access_token_index ] ),
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_check_plan_free(
+	          &access_check_plan,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_check_plan",
+	 access_check_plan );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( access_token_index = 0;
+	     access_token_index < 2;
+	     access_token_index++ )
+	{
+		if( access_tokens[ access_token_index ] != NULL )
+		{
+			libfwnt_access_token_free(
+			 &( access_tokens[ access_token_index ] ),
+			 NULL );
+		}
+	}
+	if( access_check_plan != NULL )
+	{
+		libfwnt_access_check_plan_free(
+		 &access_check_plan,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_initialize",
+	 fwnt_test_access_check_plan_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_free",
+	 fwnt_test_access_check_plan_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_compile_security_descriptor",
+	 fwnt_test_access_check_plan_compile_security_descriptor );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_compile_access_control_list",
+	 fwnt_test_access_check_plan_compile_access_control_list );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_get_flags",
+	 fwnt_test_access_check_plan_get_flags );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_get_number_of_security_identifiers",
+	 fwnt_test_access_check_plan_get_number_of_security_identifiers );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_get_number_of_entries",
+	 fwnt_test_access_check_plan_get_number_of_entries );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_check_access",
+	 fwnt_test_access_check_plan_check_access );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_check_plan_check_access_for_tokens",
+	 fwnt_test_access_check_plan_check_access_for_tokens );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -39,6 +40,33 @@ uint8_t fwnt_test_access_control_entry_data1[ 20 ] = {
 	0x00, 0x00, 0x14, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
 	0x12, 0x00, 0x00, 0x00 };
 
+/* Access allowed object entry with an object type
+ */
+uint8_t fwnt_test_access_control_entry_data2[ 40 ] = {
+	0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x11, 0x12, 0x13,
+	0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Access denied object entry with an object type and an inherited object type
+ */
+uint8_t fwnt_test_access_control_entry_data3[ 56 ] = {
+	0x06, 0x00, 0x38, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x11, 0x12, 0x13,
+	0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23,
+	0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Access allowed callback entry with application data
+ */
+uint8_t fwnt_test_access_control_entry_data4[ 28 ] = {
+	0x09, 0x00, 0x1c, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x12, 0x00, 0x00, 0x00, 0x61, 0x72, 0x74, 0x78, 0x00, 0x00, 0x00, 0x00 };
+
+/* Access allowed object entry with a truncated inherited object type
+ */
+uint8_t fwnt_test_access_control_entry_data5[ 28 ] = {
+	0x05, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x11, 0x12, 0x13,
+	0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
 #if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
 
 /* Tests the libfwnt_access_control_entry_initialize function
@@ -473,6 +501,25 @@ int fwnt_test_access_control_entry_copy_from_byte_stream(
 	libcerror_error_free(
 	 &error );
 
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data5,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libfwnt_internal_access_control_entry_free(
@@ -890,53 +937,2143 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+/* Tests the libfwnt_access_control_entry_get_object_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_get_object_flags(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	uint32_t object_flags                                = 0;
+	int result                                           = 0;
 
-/* The main program
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data2,
+	          40,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_object_flags(
+	          access_control_entry,
+	          &object_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "object_flags",
+	 object_flags,
+	 (uint32_t) LIBFWNT_ACE_OBJECT_TYPE_PRESENT );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data3,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_object_flags(
+	          access_control_entry,
+	          &object_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "object_flags",
+	 object_flags,
+	 (uint32_t) ( LIBFWNT_ACE_OBJECT_TYPE_PRESENT | LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_object_flags(
+	          access_control_entry,
+	          &object_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_get_object_flags(
+	          NULL,
+	          &object_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_object_flags(
+	          access_control_entry,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_get_object_type function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
-#endif
+int fwnt_test_access_control_entry_get_object_type(
+     void )
 {
-#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+	uint8_t guid_data[ 16 ];
 
 	libcerror_error_t *error                             = NULL;
 	libfwnt_access_control_entry_t *access_control_entry = NULL;
 	int result                                           = 0;
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
 
-	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
-	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
 
-	FWNT_TEST_RUN(
-	 "libfwnt_access_control_entry_initialize",
-	 fwnt_test_access_control_entry_initialize );
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data3,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
 
-	FWNT_TEST_RUN(
-	 "libfwnt_access_control_entry_free",
-	 fwnt_test_access_control_entry_free );
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	FWNT_TEST_RUN(
-	 "libfwnt_internal_access_control_entry_free",
+	result = libfwnt_access_control_entry_get_object_type(
+	          access_control_entry,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          &( fwnt_test_access_control_entry_data3[ 12 ] ),
+	          16 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data2,
+	          40,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_object_type(
+	          access_control_entry,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          &( fwnt_test_access_control_entry_data2[ 12 ] ),
+	          16 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_object_type(
+	          access_control_entry,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_get_object_type(
+	          NULL,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_object_type(
+	          access_control_entry,
+	          NULL,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_object_type(
+	          access_control_entry,
+	          guid_data,
+	          15,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_object_type(
+	          access_control_entry,
+	          guid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_get_inherited_object_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_get_inherited_object_type(
+     void )
+{
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data3,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          access_control_entry,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          &( fwnt_test_access_control_entry_data3[ 28 ] ),
+	          16 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data2,
+	          40,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          access_control_entry,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          access_control_entry,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          NULL,
+	          guid_data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          access_control_entry,
+	          NULL,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          access_control_entry,
+	          guid_data,
+	          15,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_inherited_object_type(
+	          access_control_entry,
+	          guid_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_get_application_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_get_application_data_size(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	uint8_t *application_data                            = NULL;
+	size_t data_size                                     = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data4,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_application_data_size(
+	          access_control_entry,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 8 );
+
+	application_data = ( (libfwnt_internal_access_control_entry_t *) access_control_entry )->application_data;
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_application_data_size(
+	          access_control_entry,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that converting a callback entry again reuses the application data
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data4,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "application_data",
+	 (size_t) ( (libfwnt_internal_access_control_entry_t *) access_control_entry )->application_data,
+	 (size_t) application_data );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "application_data_size",
+	 ( (libfwnt_internal_access_control_entry_t *) access_control_entry )->application_data_size,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_get_application_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_application_data_size(
+	          access_control_entry,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_get_application_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_get_application_data(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data4,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_application_data(
+	          access_control_entry,
+	          data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          "artx",
+	          4 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_application_data(
+	          access_control_entry,
+	          data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data4,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_get_application_data(
+	          NULL,
+	          data,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_application_data(
+	          access_control_entry,
+	          NULL,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_application_data(
+	          access_control_entry,
+	          data,
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_application_data(
+	          access_control_entry,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_copy_to_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 56 ];
+
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	size_t data_size                                     = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data1,
+	          20,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_data_size(
+	          access_control_entry,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 20 );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_entry_data1,
+	          20 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data2,
+	          40,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_data_size(
+	          access_control_entry,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 40 );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_entry_data2,
+	          40 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data3,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_data_size(
+	          access_control_entry,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 56 );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_entry_data3,
+	          56 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_copy_from_byte_stream(
+	          access_control_entry,
+	          fwnt_test_access_control_entry_data4,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_get_data_size(
+	          access_control_entry,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 28 );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_entry_data4,
+	          28 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          NULL,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          27,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_get_data_size(
+	          access_control_entry,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_control_entry_set_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_control_entry_set_values(
+     void )
+{
+	uint8_t byte_stream[ 56 ];
+
+	uint8_t object_type_guid[ 16 ] = {
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+
+	uint8_t inherited_object_type_guid[ 16 ] = {
+		0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f };
+
+	uint8_t application_data[ 8 ] = {
+		0x61, 0x72, 0x74, 0x78, 0x00, 0x00, 0x00, 0x00 };
+
+	uint8_t system_sid[ 12 ] = {
+		0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	libfwnt_security_identifier_t *security_identifier   = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_control_entry_initialize(
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          system_sid,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          LIBFWNT_ACCESS_DENIED_OBJECT,
+	          0,
+	          0x00000100UL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_set_object_type(
+	          access_control_entry,
+	          object_type_guid,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_set_inherited_object_type(
+	          access_control_entry,
+	          inherited_object_type_guid,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_entry_data3,
+	          56 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          LIBFWNT_ACCESS_ALLOWED_CALLBACK,
+	          0,
+	          0,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_set_access_mask(
+	          access_control_entry,
+	          0x001f01ffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_set_application_data(
+	          access_control_entry,
+	          application_data,
+	          8,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_copy_to_byte_stream(
+	          access_control_entry,
+	          byte_stream,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_access_control_entry_data4,
+	          28 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_control_entry_set_values(
+	          NULL,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x001f01ffUL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          LIBFWNT_ACCESS_ALLOWED_COMPOUND,
+	          0,
+	          0x001f01ffUL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          0xff,
+	          0,
+	          0x001f01ffUL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x001f01ffUL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_object_type(
+	          NULL,
+	          object_type_guid,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_object_type(
+	          access_control_entry,
+	          NULL,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_object_type(
+	          access_control_entry,
+	          object_type_guid,
+	          15,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_application_data(
+	          NULL,
+	          application_data,
+	          8,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_application_data(
+	          access_control_entry,
+	          application_data,
+	          (size_t) UINT16_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x001f01ffUL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_set_object_type(
+	          access_control_entry,
+	          object_type_guid,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_control_entry_set_application_data(
+	          access_control_entry,
+	          application_data,
+	          8,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_internal_access_control_entry_free(
+	          (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( access_control_entry != NULL )
+	{
+		libfwnt_internal_access_control_entry_free(
+		 (libfwnt_internal_access_control_entry_t **) &access_control_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	libcerror_error_t *error                             = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	int result                                           = 0;
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_initialize",
+	 fwnt_test_access_control_entry_initialize );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_free",
+	 fwnt_test_access_control_entry_free );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_internal_access_control_entry_free",
 	 fwnt_test_internal_access_control_entry_free );
 
 	FWNT_TEST_RUN(
 	 "libfwnt_access_control_entry_copy_from_byte_stream",
 	 fwnt_test_access_control_entry_copy_from_byte_stream );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_get_object_flags",
+	 fwnt_test_access_control_entry_get_object_flags );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_get_object_type",
+	 fwnt_test_access_control_entry_get_object_type );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_get_inherited_object_type",
+	 fwnt_test_access_control_entry_get_inherited_object_type );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_get_application_data_size",
+	 fwnt_test_access_control_entry_get_application_data_size );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_get_application_data",
+	 fwnt_test_access_control_entry_get_application_data );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_copy_to_byte_stream",
+	 fwnt_test_access_control_entry_copy_to_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_control_entry_set_values",
+	 fwnt_test_access_control_entry_set_values );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize access_control_entry for tests
@@ -0,0 +1,1149 @@
+/*
+ * Library access_token type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_access_token.h"
+
+/* S-1-5-18
+ */
+uint8_t fwnt_test_access_token_data1[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* S-1-5-32-544
+ */
+uint8_t fwnt_test_access_token_data2[ 16 ] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00 };
+
+/* Security descriptor with a discretionary ACL that grants S-1-5-18 full access
+ */
+uint8_t fwnt_test_access_token_data3[ 144 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x74, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x21, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x12, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Security descriptor with an empty discretionary ACL
+ */
+uint8_t fwnt_test_access_token_data4[ 56 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwnt_access_token_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_access_token_t *access_token = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	access_token = (libfwnt_access_token_t *) 0x12345678UL;
+
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	access_token = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_access_token_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_access_token_initialize(
+		          &access_token,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( access_token != NULL )
+			{
+				libfwnt_access_token_free(
+				 &access_token,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "access_token",
+			 access_token );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_append_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_append_byte_stream(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_access_token_t *access_token = NULL;
+	int number_of_security_identifiers   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_token_data2,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a security identifier is only stored once
+	 */
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_append_byte_stream(
+	          NULL,
+	          fwnt_test_access_token_data1,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          NULL,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          4,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_append_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_append_security_identifier(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_token_t *access_token               = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_access_token_data2,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_contains_security_identifier(
+	          access_token,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_contains_security_identifier(
+	          access_token,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_append_security_identifier(
+	          NULL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_append_security_identifier(
+	          access_token,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_contains_security_identifier(
+	          NULL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_contains_security_identifier(
+	          access_token,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_get_number_of_security_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_get_number_of_security_identifiers(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_access_token_t *access_token = NULL;
+	int number_of_security_identifiers   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          NULL,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_get_number_of_security_identifiers(
+	          access_token,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_access_token_check_access_for_security_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_access_token_check_access_for_security_descriptors(
+     void )
+{
+	libfwnt_security_descriptor_t *security_descriptors[ 2 ] = { NULL, NULL };
+	uint32_t granted_access_masks[ 2 ]                       = { 0, 0 };
+
+	libcerror_error_t *error                                 = NULL;
+	libfwnt_access_token_t *access_token                     = NULL;
+	int result                                               = 0;
+	int security_descriptor_index                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_access_token_initialize(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_token,
+	          fwnt_test_access_token_data1,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptors[ 0 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptors[ 0 ]",
+	 security_descriptors[ 0 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptors[ 1 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptors[ 1 ]",
+	 security_descriptors[ 1 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptors[ 0 ],
+	          fwnt_test_access_token_data3,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptors[ 1 ],
+	          fwnt_test_access_token_data4,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_access_token_check_access_for_security_descriptors(
+	          access_token,
+	          security_descriptors,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 0 ]",
+	 granted_access_masks[ 0 ],
+	 (uint32_t) 0x001f01ffUL );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 1 ]",
+	 granted_access_masks[ 1 ],
+	 (uint32_t) 0x00000000UL );
+
+	/* Test error cases
+	 */
+	result = libfwnt_access_token_check_access_for_security_descriptors(
+	          NULL,
+	          security_descriptors,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_check_access_for_security_descriptors(
+	          access_token,
+	          NULL,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_check_access_for_security_descriptors(
+	          access_token,
+	          security_descriptors,
+	          -1,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_access_token_check_access_for_security_descriptors(
+	          access_token,
+	          security_descriptors,
+	          2,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( security_descriptor_index = 0;
+	     security_descriptor_index < 2;
+	     security_descriptor_index++ )
+	{
+		result = libfwnt_security_descriptor_free(
+		          &( security_descriptors[ security_descriptor_index ] ),
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libfwnt_access_token_free(
+	          &access_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "access_token",
+	 access_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( security_descriptor_index = 0;
+	     security_descriptor_index < 2;
+	     security_descriptor_index++ )
+	{
+		if( security_descriptors[ security_descriptor_index ] != NULL )
+		{
+			libfwnt_security_descriptor_free(
+			 &( security_descriptors[ security_descriptor_index ] ),
+			 NULL );
+		}
+	}
+	if( access_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &access_token,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_initialize",
+	 fwnt_test_access_token_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_free",
+	 fwnt_test_access_token_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_append_byte_stream",
+	 fwnt_test_access_token_append_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_append_security_identifier",
+	 fwnt_test_access_token_append_security_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_get_number_of_security_identifiers",
+	 fwnt_test_access_token_get_number_of_security_identifiers );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_access_token_check_access_for_security_descriptors",
+	 fwnt_test_access_token_check_access_for_security_descriptors );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
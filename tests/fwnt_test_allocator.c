@@ -0,0 +1,538 @@
+/*
+ * Library allocator functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+uint8_t fwnt_test_allocator_security_descriptor_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Security descriptor with a DACL that contains an access allowed callback entry
+ */
+uint8_t fwnt_test_allocator_security_descriptor_data2[ 56 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x24, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00,
+	0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x61, 0x72, 0x74, 0x78, 0x00, 0x00, 0x00, 0x00 };
+
+/* Security descriptor with a DACL of 30 entries that exceeds the hash data on the stack
+ */
+const char *fwnt_test_allocator_sddl_string = "D:"
+	"(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)"
+	"(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)"
+	"(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)"
+	"(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)"
+	"(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)"
+	"(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)(A;;FA;;;SY)";
+
+typedef struct fwnt_test_allocator_context fwnt_test_allocator_context_t;
+
+struct fwnt_test_allocator_context
+{
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+
+	/* The number of frees
+	 */
+	int number_of_frees;
+};
+
+/* Test allocate function
+ */
+void *fwnt_test_allocator_allocate(
+       void *context,
+       size_t size )
+{
+	( (fwnt_test_allocator_context_t *) context )->number_of_allocations += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Test reallocate function
+ */
+void *fwnt_test_allocator_reallocate(
+       void *context,
+       void *memory,
+       size_t size )
+{
+	if( memory == NULL )
+	{
+		( (fwnt_test_allocator_context_t *) context )->number_of_allocations += 1;
+	}
+	return( memory_reallocate(
+	         memory,
+	         size ) );
+}
+
+/* Test free function
+ */
+void fwnt_test_allocator_free(
+      void *context,
+      void *memory )
+{
+	( (fwnt_test_allocator_context_t *) context )->number_of_frees += 1;
+
+	memory_free(
+	 memory );
+}
+
+/* Tests the libfwnt_allocator_set_functions function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_allocator_set_functions(
+     void )
+{
+	fwnt_test_allocator_context_t allocator_context;
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	uint64_t hash                                      = 0;
+	int number_of_allocations                          = 0;
+	int result                                         = 0;
+
+	allocator_context.number_of_allocations = 0;
+	allocator_context.number_of_frees       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_allocator_set_functions(
+	          &fwnt_test_allocator_allocate,
+	          &fwnt_test_allocator_reallocate,
+	          &fwnt_test_allocator_free,
+	          &allocator_context,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_allocator_security_descriptor_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that converting the descriptor again does not allocate
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_allocator_security_descriptor_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that converting a callback entry again reuses the application data
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_allocator_security_descriptor_data2,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_allocator_security_descriptor_data2,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that calculating the hash does not allocate
+	 */
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor,
+	          &hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations );
+
+	/* Test that the allocator cannot be changed while memory is allocated
+	 */
+	result = libfwnt_allocator_set_functions(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_allocator_set_functions(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The descriptor, 2 SIDs, 1 ACL, its entries, 2 ACEs, 2 ACE SIDs
+	 * and the application data of the callback entry
+	 */
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 10 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	/* Test error cases
+	 */
+	result = libfwnt_allocator_set_functions(
+	          &fwnt_test_allocator_allocate,
+	          NULL,
+	          &fwnt_test_allocator_free,
+	          &allocator_context,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	libfwnt_allocator_set_functions(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the allocator with the libfwnt_security_descriptor_get_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_allocator_security_descriptor_get_hash(
+     void )
+{
+	fwnt_test_allocator_context_t allocator_context;
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	uint64_t hash                                      = 0;
+	int number_of_allocations                          = 0;
+	int result                                         = 0;
+
+	allocator_context.number_of_allocations = 0;
+	allocator_context.number_of_frees       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_allocator_set_functions(
+	          &fwnt_test_allocator_allocate,
+	          &fwnt_test_allocator_reallocate,
+	          &fwnt_test_allocator_free,
+	          &allocator_context,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) fwnt_test_allocator_sddl_string,
+	          362,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that calculating the hash of a large security descriptor uses the allocator
+	 */
+	number_of_allocations = allocator_context.number_of_allocations;
+
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor,
+	          &hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_allocations",
+	 allocator_context.number_of_allocations,
+	 number_of_allocations + 1 );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_allocator_set_functions(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "allocator_context.number_of_frees",
+	 allocator_context.number_of_frees,
+	 allocator_context.number_of_allocations );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	libfwnt_allocator_set_functions(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_allocator_set_functions",
+	 fwnt_test_allocator_set_functions );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_get_hash",
+	 fwnt_test_allocator_security_descriptor_get_hash );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
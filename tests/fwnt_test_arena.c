@@ -0,0 +1,548 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_arena.h"
+
+/* Tests the libfwnt_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwnt_arena_t *arena          = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libfwnt_arena_t *) 0x12345678UL;
+
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	arena = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          (size_t) -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_arena_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwnt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_arena_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwnt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_arena_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_clear(
+     libfwnt_arena_t *arena )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_arena_clear(
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_arena_clear(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_arena_allocate(
+     libfwnt_arena_t *arena )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *first_memory    = NULL;
+	uint8_t *large_memory    = NULL;
+	uint8_t *memory          = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	first_memory = (uint8_t *) libfwnt_arena_allocate(
+	                            arena,
+	                            3 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_memory",
+	 first_memory );
+
+	memory = (uint8_t *) libfwnt_arena_allocate(
+	                      arena,
+	                      5 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "memory - first_memory",
+	 (size_t) ( memory - first_memory ),
+	 (size_t) LIBFWNT_ARENA_ALIGNMENT );
+
+	/* Test an allocation that is larger than the block size
+	 */
+	large_memory = (uint8_t *) libfwnt_arena_allocate(
+	                            arena,
+	                            LIBFWNT_ARENA_DEFAULT_BLOCK_SIZE * 2 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "large_memory",
+	 large_memory );
+
+	/* Test that the blocks are reused after the arena is cleared
+	 */
+	result = libfwnt_arena_clear(
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory = (uint8_t *) libfwnt_arena_allocate(
+	                      arena,
+	                      8 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "memory",
+	 (size_t) memory,
+	 (size_t) first_memory );
+
+	/* Test error cases
+	 */
+	memory = (uint8_t *) libfwnt_arena_allocate(
+	                      arena,
+	                      0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	memory = (uint8_t *) libfwnt_arena_allocate(
+	                      arena,
+	                      (size_t) -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "memory",
+	 memory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libfwnt_arena_t *arena   = NULL;
+	int result               = 0;
+
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_initialize",
+	 fwnt_test_arena_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_arena_free",
+	 fwnt_test_arena_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize arena for tests
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_arena_clear",
+	 fwnt_test_arena_clear,
+	 arena );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_arena_allocate",
+	 fwnt_test_arena_allocate,
+	 arena );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
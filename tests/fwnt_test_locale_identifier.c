@@ -0,0 +1,1012 @@
+/*
+ * Library locale identifier (LCID) functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_locale_identifier.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_locale_identifier_language_tag_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_language_tag_get_values(
+     void )
+{
+	const libfwnt_locale_identifier_language_tag_t *expected_language_tag = NULL;
+	const libfwnt_locale_identifier_language_tag_t *language_tag          = NULL;
+	uint32_t lcid_language_tag                                            = 0;
+	int number_of_language_tags                                           = 0;
+	int table_index                                                       = 0;
+
+	/* Test that the index tables return the same entry as a linear scan of the language tags table
+	 * for every LCID language tag
+	 */
+	for( lcid_language_tag = 0;
+	     lcid_language_tag <= 0x0000ffffUL;
+	     lcid_language_tag++ )
+	{
+		expected_language_tag = &( libfwnt_locale_identifier_language_tags[ LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX ] );
+
+		for( table_index = 0;
+		     table_index < LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX;
+		     table_index++ )
+		{
+			if( libfwnt_locale_identifier_language_tags[ table_index ].lcid_language_tag == (uint16_t) lcid_language_tag )
+			{
+				expected_language_tag = &( libfwnt_locale_identifier_language_tags[ table_index ] );
+
+				break;
+			}
+		}
+		language_tag = libfwnt_locale_identifier_language_tag_get_values(
+		                (uint16_t) lcid_language_tag );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "language_tag",
+		 (size_t) language_tag,
+		 (size_t) expected_language_tag );
+
+		if( language_tag->lcid_language_tag != (uint16_t) -1 )
+		{
+			number_of_language_tags++;
+		}
+	}
+	/* Test that every entry of the language tags table is reachable
+	 */
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_language_tags",
+	 number_of_language_tags,
+	 LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "libfwnt_locale_identifier_language_tags[ LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX ].lcid_language_tag",
+	 libfwnt_locale_identifier_language_tags[ LIBFWNT_LOCALE_IDENTIFIER_UNKNOWN_LANGUAGE_TAG_INDEX ].lcid_language_tag,
+	 (uint16_t) -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwnt_locale_identifier_language_tag_get_identifier and libfwnt_locale_identifier_language_tag_get_description functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_language_tag_get_identifier(
+     void )
+{
+	const char *string = NULL;
+	int result         = 0;
+
+	/* Test regular cases
+	 */
+	string = libfwnt_locale_identifier_language_tag_get_identifier(
+	          0x0409 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "en-US",
+	          6 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string = libfwnt_locale_identifier_language_tag_get_description(
+	          0x0409 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "English, United States",
+	          23 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string = libfwnt_locale_identifier_language_tag_get_identifier(
+	          0x0400 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "_UNKNOWN_",
+	          10 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* Tests the libfwnt_locale_identifier_language_tag_get_strings function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_language_tag_get_strings(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	const char *description  = NULL;
+	const char *identifier   = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_locale_identifier_language_tag_get_strings(
+	          0x0407,
+	          &identifier,
+	          &description,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "de-DE",
+	          6 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          description,
+	          "German, Germany",
+	          16 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_locale_identifier_language_tag_get_strings(
+	          0x7fff,
+	          &identifier,
+	          &description,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "_UNKNOWN_",
+	          10 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_locale_identifier_language_tag_get_strings(
+	          0x0407,
+	          NULL,
+	          &description,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_language_tag_get_strings(
+	          0x0407,
+	          &identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_locale_identifier_language_tag_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_language_tag_copy_from_utf8_string(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	uint16_t lcid_language_tag = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          (uint8_t *) "en-US",
+	          5,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "lcid_language_tag",
+	 lcid_language_tag,
+	 (uint16_t) 0x0409 );
+
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          (uint8_t *) "EN-us",
+	          6,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "lcid_language_tag",
+	 lcid_language_tag,
+	 (uint16_t) 0x0409 );
+
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          (uint8_t *) "en",
+	          2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "lcid_language_tag",
+	 lcid_language_tag,
+	 (uint16_t) 0x0009 );
+
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          (uint8_t *) "en-U",
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          (uint8_t *) "_UNKNOWN_",
+	          9,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          NULL,
+	          (uint8_t *) "en-US",
+	          5,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          NULL,
+	          5,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_language_tag_copy_from_utf8_string(
+	          &lcid_language_tag,
+	          (uint8_t *) "en-US",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_locale_identifier_get_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_get_values(
+     void )
+{
+	libfwnt_locale_identifier_values_t values;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_locale_identifier_get_values(
+	          0x00010407,
+	          &values,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "values.language_tag",
+	 values.language_tag,
+	 (uint16_t) 0x0407 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "values.primary_language",
+	 values.primary_language,
+	 (uint16_t) 0x0007 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "values.sub_language",
+	 values.sub_language,
+	 (uint8_t) 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "values.sort_identifier",
+	 values.sort_identifier,
+	 (uint8_t) 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "values.sort_version",
+	 values.sort_version,
+	 (uint8_t) 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "values.neutral_language_tag",
+	 values.neutral_language_tag,
+	 (uint16_t) 0x0007 );
+
+	result = narrow_string_compare(
+	          values.identifier,
+	          "de-DE",
+	          6 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          values.neutral_identifier,
+	          "de",
+	          3 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          values.sort_suffix,
+	          "phoneb",
+	          7 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_locale_identifier_get_values(
+	          0x00000409,
+	          &values,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "values.sort_suffix",
+	 values.sort_suffix );
+
+	result = libfwnt_locale_identifier_get_values(
+	          0x00070409,
+	          &values,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_locale_identifier_get_values(
+	          0x01000409,
+	          &values,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_locale_identifier_get_values(
+	          0x00000400,
+	          &values,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          values.identifier,
+	          "_UNKNOWN_",
+	          10 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_locale_identifier_get_values(
+	          0x00000409,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_locale_identifier_get_values_array function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_get_values_array(
+     void )
+{
+	libfwnt_locale_identifier_values_t values_array[ 3 ];
+	uint32_t lcids[ 3 ]      = { 0x00000409, 0x00020804, 0x00000400 };
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_locale_identifier_get_values_array(
+	          lcids,
+	          values_array,
+	          3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "values_array[ 0 ].language_tag",
+	 values_array[ 0 ].language_tag,
+	 (uint16_t) 0x0409 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "values_array[ 1 ].sort_identifier",
+	 values_array[ 1 ].sort_identifier,
+	 (uint8_t) 2 );
+
+	result = narrow_string_compare(
+	          values_array[ 1 ].sort_suffix,
+	          "stroke",
+	          7 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = narrow_string_compare(
+	          values_array[ 2 ].identifier,
+	          "_UNKNOWN_",
+	          10 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_locale_identifier_get_values_array(
+	          NULL,
+	          values_array,
+	          3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_get_values_array(
+	          lcids,
+	          NULL,
+	          3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_get_values_array(
+	          lcids,
+	          values_array,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_locale_identifier_get_utf8_name_size and libfwnt_locale_identifier_copy_to_utf8_name functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_locale_identifier_copy_to_utf8_name(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_locale_identifier_get_utf8_name_size(
+	          0x0001040e,
+	          &utf8_string_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 13 );
+
+	result = libfwnt_locale_identifier_copy_to_utf8_name(
+	          0x0001040e,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "hu-HU_tchncl",
+	          13 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_locale_identifier_copy_to_utf8_name(
+	          0x00000409,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) utf8_string,
+	          "en-US",
+	          6 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_locale_identifier_copy_to_utf8_name(
+	          0x00000400,
+	          utf8_string,
+	          32,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_locale_identifier_copy_to_utf8_name(
+	          0x0001040e,
+	          NULL,
+	          32,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_copy_to_utf8_name(
+	          0x0001040e,
+	          utf8_string,
+	          12,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_copy_to_utf8_name(
+	          0x0001040e,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_locale_identifier_get_utf8_name_size(
+	          0x0001040e,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_language_tag_get_values",
+	 fwnt_test_locale_identifier_language_tag_get_values );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_language_tag_get_identifier",
+	 fwnt_test_locale_identifier_language_tag_get_identifier );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_language_tag_get_strings",
+	 fwnt_test_locale_identifier_language_tag_get_strings );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_language_tag_copy_from_utf8_string",
+	 fwnt_test_locale_identifier_language_tag_copy_from_utf8_string );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_get_values",
+	 fwnt_test_locale_identifier_get_values );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_get_values_array",
+	 fwnt_test_locale_identifier_get_values_array );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_locale_identifier_copy_to_utf8_name",
+	 fwnt_test_locale_identifier_copy_to_utf8_name );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1092 @@
+/*
+ * Library SDDL functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_definitions.h"
+#include "../libfwnt/libfwnt_sddl.h"
+
+uint8_t fwnt_test_sddl_guid[ 16 ] = {
+	0x78, 0x56, 0x34, 0x12, 0xbc, 0x9a, 0xf0, 0xde, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_sddl_write_access_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_sddl_write_access_mask(
+     void )
+{
+	uint8_t string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x001f01ffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          string,
+	          "FA",
+	          2 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x00000003UL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 4 );
+
+	result = memory_compare(
+	          string,
+	          "CCDC",
+	          4 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x800a0000UL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 6 );
+
+	result = memory_compare(
+	          string,
+	          "GRRCWO",
+	          6 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x0012019fUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          string,
+	          "0x12019f",
+	          8 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 3 );
+
+	result = memory_compare(
+	          string,
+	          "0x0",
+	          3 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_SYSTEM_MANDATORY_LABEL,
+	          0x00000001UL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          string,
+	          "NW",
+	          2 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          &string_index,
+	          LIBFWNT_SYSTEM_MANDATORY_LABEL,
+	          0x001f01ffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          string,
+	          "0x1f01ff",
+	          8 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test determining the string length without a string
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          NULL,
+	          0,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x0012019fUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          64,
+	          NULL,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x0012019fUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_write_access_mask(
+	          string,
+	          7,
+	          &string_index,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0x0012019fUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_sddl_write_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_sddl_write_guid(
+     void )
+{
+	uint8_t string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_guid(
+	          string,
+	          64,
+	          &string_index,
+	          fwnt_test_sddl_guid,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 36 );
+
+	result = memory_compare(
+	          string,
+	          "12345678-9abc-def0-0123-456789abcdef",
+	          36 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_guid(
+	          string,
+	          64,
+	          &string_index,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_write_guid(
+	          string,
+	          35,
+	          &string_index,
+	          fwnt_test_sddl_guid,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_sddl_write_access_control_list function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_sddl_write_access_control_list(
+     void )
+{
+	uint8_t string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t string_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_control_list(
+	          string,
+	          64,
+	          &string_index,
+	          NULL,
+	          LIBFWNT_CONTROL_FLAG_DACL_PRESENT | LIBFWNT_CONTROL_FLAG_DACL_PROTECTED | LIBFWNT_CONTROL_FLAG_DACL_AUTO_INHERITED | LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERIT_REQ,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          string,
+	          "PAINO_ACCESS_CONTROL",
+	          20 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_control_list(
+	          string,
+	          64,
+	          &string_index,
+	          NULL,
+	          LIBFWNT_CONTROL_FLAG_DACL_PROTECTED | LIBFWNT_CONTROL_FLAG_SACL_AUTO_INHERIT_REQ,
+	          1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 19 );
+
+	result = memory_compare(
+	          string,
+	          "ARNO_ACCESS_CONTROL",
+	          19 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	string_index = 0;
+
+	result = libfwnt_sddl_write_access_control_list(
+	          string,
+	          64,
+	          NULL,
+	          NULL,
+	          LIBFWNT_CONTROL_FLAG_DACL_PROTECTED,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_write_access_control_list(
+	          string,
+	          10,
+	          &string_index,
+	          NULL,
+	          LIBFWNT_CONTROL_FLAG_DACL_PROTECTED,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_sddl_read_access_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_sddl_read_access_mask(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t access_mask     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "FA",
+	          2,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x001f01ffUL );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "GRRCWO",
+	          6,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x800a0000UL );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "0x12019f",
+	          8,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x0012019fUL );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "2032127",
+	          7,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x001f01ffUL );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "NWNR",
+	          4,
+	          LIBFWNT_SYSTEM_MANDATORY_LABEL,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x00000003UL );
+
+	/* Test error cases
+	 */
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "",
+	          0,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "ZZ",
+	          2,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "FAX",
+	          3,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "0x1g",
+	          4,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "0x100000000",
+	          11,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "FA",
+	          2,
+	          LIBFWNT_SYSTEM_MANDATORY_LABEL,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          NULL,
+	          2,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          &access_mask,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_access_mask(
+	          (uint8_t *) "FA",
+	          2,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_sddl_read_guid function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_sddl_read_guid(
+     void )
+{
+	uint8_t guid_data[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_sddl_read_guid(
+	          (uint8_t *) "12345678-9abc-def0-0123-456789abcdef",
+	          36,
+	          guid_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          guid_data,
+	          fwnt_test_sddl_guid,
+	          16 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_sddl_read_guid(
+	          NULL,
+	          36,
+	          guid_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_guid(
+	          (uint8_t *) "12345678-9abc-def0-0123-456789abcdef",
+	          35,
+	          guid_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_guid(
+	          (uint8_t *) "12345678-9abc-def0-0123-456789abcdef",
+	          36,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_guid(
+	          (uint8_t *) "12345678_9abc-def0-0123-456789abcdef",
+	          36,
+	          guid_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_sddl_read_guid(
+	          (uint8_t *) "1234567g-9abc-def0-0123-456789abcdef",
+	          36,
+	          guid_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_sddl_write_access_mask",
+	 fwnt_test_sddl_write_access_mask );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_sddl_write_guid",
+	 fwnt_test_sddl_write_guid );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_sddl_write_access_control_list",
+	 fwnt_test_sddl_write_access_control_list );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_sddl_read_access_mask",
+	 fwnt_test_sddl_read_access_mask );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_sddl_read_guid",
+	 fwnt_test_sddl_read_guid );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+}
+
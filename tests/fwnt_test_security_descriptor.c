@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -45,6 +46,63 @@ uint8_t fwnt_test_security_descriptor_data1[ 116 ] = {
 	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
 	0x20, 0x02, 0x00, 0x00 };
 
+/* Discretionary ACL with a denied, an inherit-only allowed and two allowed entries
+ */
+uint8_t fwnt_test_security_descriptor_data2[ 144 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x74, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x60, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x18, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x21, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x12, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* No discretionary ACL
+ */
+uint8_t fwnt_test_security_descriptor_data3[ 48 ] = {
+	0x01, 0x00, 0x00, 0x80, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Empty discretionary ACL
+ */
+uint8_t fwnt_test_security_descriptor_data4[ 56 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Discretionary ACL with an allowed entry, as stored by libfwnt_security_descriptor_copy_to_byte_stream
+ */
+uint8_t fwnt_test_security_descriptor_data5[ 76 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Empty discretionary ACL without the DACL present flag
+ */
+uint8_t fwnt_test_security_descriptor_data6[ 56 ] = {
+	0x01, 0x00, 0x00, 0x80, 0x1c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+uint8_t fwnt_test_security_descriptor_users_sid[ 16 ] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00 };
+
+uint8_t fwnt_test_security_descriptor_world_sid[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t fwnt_test_security_descriptor_system_sid[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+uint8_t fwnt_test_security_descriptor_administrators_sid[ 16 ] = {
+	0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00 };
+
 /* Tests the libfwnt_security_descriptor_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -278,6 +336,170 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_security_descriptor_initialize_with_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_initialize_with_arena(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_arena_t *arena                             = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	libfwnt_security_identifier_t *owner               = NULL;
+	int iterator                                       = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the second iteration reuses the cleared arena
+	 */
+	for( iterator = 0;
+	     iterator < 2;
+	     iterator++ )
+	{
+		result = libfwnt_security_descriptor_initialize_with_arena(
+		          &security_descriptor,
+		          arena,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "security_descriptor",
+		 security_descriptor );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_security_descriptor_copy_from_byte_stream(
+		          security_descriptor,
+		          fwnt_test_security_descriptor_data1,
+		          116,
+		          LIBFWNT_ENDIAN_LITTLE,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_security_descriptor_get_owner(
+		          security_descriptor,
+		          &owner,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "owner",
+		 owner );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The security descriptor is released by clearing the arena
+		 */
+		security_descriptor = NULL;
+		owner               = NULL;
+
+		result = libfwnt_arena_clear(
+		          arena,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_initialize_with_arena(
+	          NULL,
+	          arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_arena_free(
+	          &arena,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwnt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwnt_security_descriptor_copy_from_byte_stream function
  * Returns 1 if successful or 0 if not
  */
@@ -325,6 +547,24 @@ int fwnt_test_security_descriptor_copy_from_byte_stream(
 	 "error",
 	 error );
 
+	/* Test to copy security descriptor from byte stream reusing its values
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libfwnt_security_descriptor_copy_from_byte_stream(
@@ -471,100 +711,276 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_descriptor_get_owner function
+/* Tests the libfwnt_security_descriptor_copy_to_byte_stream function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_descriptor_get_owner(
-     libfwnt_security_descriptor_t *security_descriptor )
+int fwnt_test_security_descriptor_copy_to_byte_stream(
+     void )
 {
-	libcerror_error_t *error             = NULL;
-	libfwnt_security_identifier_t *owner = NULL;
-	int owner_is_set                     = 0;
-	int result                           = 0;
+	uint8_t byte_stream[ 144 ];
 
-	/* Test regular cases
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	size_t data_size                                   = 0;
+	int result                                         = 0;
+
+	/* Initialize test
 	 */
-	result = libfwnt_security_descriptor_get_owner(
-	          security_descriptor,
-	          &owner,
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
 	          &error );
 
-	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
 
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	owner_is_set = result;
-
-	if( owner_is_set != 0 )
-	{
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "owner",
-		 owner );
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
 
-		result = libfwnt_security_identifier_free(
-		          &owner,
-		          &error );
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libfwnt_security_descriptor_get_owner(
-	          NULL,
-	          &owner,
+	result = libfwnt_security_descriptor_get_data_size(
+	          security_descriptor,
+	          &data_size,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NULL(
-	 "owner",
-	 owner );
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 116 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
 
-	if( owner_is_set != 0 )
-	{
-		result = libfwnt_security_descriptor_get_owner(
-		          security_descriptor,
-		          NULL,
-		          &error );
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "owner",
-		 owner );
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_descriptor_data1,
+	          116 );
 
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_descriptor_data2,
+	          144 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          NULL,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          143,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          144,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_data_size(
+	          security_descriptor,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -573,179 +989,3183 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( owner != NULL )
+	if( security_descriptor != NULL )
 	{
-		libfwnt_security_identifier_free(
-		 &owner,
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_descriptor_get_group function
+/* Tests the libfwnt_security_descriptor_copy_to_utf8_sddl_string function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_descriptor_get_group(
-     libfwnt_security_descriptor_t *security_descriptor )
+int fwnt_test_security_descriptor_copy_to_utf8_sddl_string(
+     void )
 {
-	libcerror_error_t *error             = NULL;
-	libfwnt_security_identifier_t *group = NULL;
-	int group_is_set                     = 0;
-	int result                           = 0;
+	uint8_t sddl_string[ 128 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	size_t sddl_string_size                            = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libfwnt_security_descriptor_get_group(
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
 	          security_descriptor,
-	          &group,
+	          fwnt_test_security_descriptor_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
 	          &error );
 
-	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	group_is_set = result;
+	result = libfwnt_security_descriptor_get_utf8_sddl_string_size(
+	          security_descriptor,
+	          &sddl_string_size,
+	          &error );
 
-	if( group_is_set != 0 )
-	{
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "group",
-		 group );
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		result = libfwnt_security_identifier_free(
-		          &group,
-		          &error );
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sddl_string_size",
+	 sddl_string_size,
+	 (size_t) 90 );
 
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
-	 */
-	result = libfwnt_security_descriptor_get_group(
-	          NULL,
-	          &group,
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          security_descriptor,
+	          sddl_string,
+	          128,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          sddl_string,
+	          "O:S-1-5-21-1757981266-484763869-1060284298-1003G:BAD:(A;;0x12019f;;;SY)(A;;0x12019f;;;BA)",
+	          90 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_utf8_sddl_string_size(
+	          security_descriptor,
+	          &sddl_string_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sddl_string_size",
+	 sddl_string_size,
+	 (size_t) 67 );
+
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          security_descriptor,
+	          sddl_string,
+	          128,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          sddl_string,
+	          "O:BAG:SYD:(D;;CC;;;BU)(A;OICIIO;FA;;;WD)(A;;CCDC;;;BU)(A;;FA;;;SY)",
+	          67 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          NULL,
+	          sddl_string,
+	          128,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          security_descriptor,
+	          NULL,
+	          128,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          security_descriptor,
+	          sddl_string,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          security_descriptor,
+	          sddl_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_to_utf8_sddl_string(
+	          security_descriptor,
+	          sddl_string,
+	          66,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_utf8_sddl_string_size(
+	          NULL,
+	          &sddl_string_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_utf8_sddl_string_size(
+	          security_descriptor,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_copy_from_utf8_sddl_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_copy_from_utf8_sddl_string(
+     void )
+{
+	uint8_t byte_stream[ 144 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	size_t data_size                                   = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "O:BAG:SYD:(D;;CC;;;BU)(A;OICIIO;FA;;;WD)(A;;CCDC;;;BU)(A;;FA;;;SY)",
+	          67,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_data_size(
+	          security_descriptor,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 144 );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_descriptor_data2,
+	          144 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a NULL discretionary ACL
+	 */
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:NO_ACCESS_CONTROL",
+	          19,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "byte_stream[ 2 ]",
+	 byte_stream[ 2 ],
+	 (uint8_t) 0x04 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "byte_stream[ 16 ]",
+	 byte_stream[ 16 ],
+	 (uint8_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          NULL,
+	          (uint8_t *) "O:BAG:SYD:(D;;CC;;;BU)(A;OICIIO;FA;;;WD)(A;;CCDC;;;BU)(A;;FA;;;SY)",
+	          66,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          NULL,
+	          66,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "O:BAG:SYD:(D;;CC;;;BU)(A;OICIIO;FA;;;WD)(A;;CCDC;;;BU)(A;;FA;;;SY)",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "X:BA",
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "O:BAO:BA",
+	          8,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "O:QQ",
+	          4,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:(A;;FA;;SY)",
+	          13,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:(A;;FA;;;SY",
+	          13,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:(A;;ZZ;;;SY)",
+	          14,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:(ZZ;;FA;;;SY)",
+	          15,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:(OA;;CR;bf967a7f-0de6-11d0-a285;;AU)",
+	          38,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_normalize and libfwnt_security_descriptor_get_hash functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_normalize(
+     void )
+{
+	uint8_t byte_stream1[ 144 ];
+	uint8_t byte_stream2[ 144 ];
+
+	libcerror_error_t *error                            = NULL;
+	libfwnt_security_descriptor_t *security_descriptor1 = NULL;
+	libfwnt_security_descriptor_t *security_descriptor2 = NULL;
+	size_t data_size                                    = 0;
+	uint64_t hash1                                      = 0;
+	uint64_t hash2                                      = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor1",
+	 security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor1,
+	          (uint8_t *) "O:BAG:SYD:(D;;CC;;;BU)(A;OICIIO;FA;;;WD)(A;;CCDC;;;BU)(A;;FA;;;SY)",
+	          67,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor2",
+	 security_descriptor2 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The allowed entries are reordered and contain a duplicate
+	 */
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor2,
+	          (uint8_t *) "O:BAG:SYD:(D;;CC;;;BU)(A;;FA;;;SY)(A;OICIIO;FA;;;WD)(A;;FA;;;SY)(A;;CCDC;;;BU)",
+	          78,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor1,
+	          &hash1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor2,
+	          &hash2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_UINT64(
+	 "hash2",
+	 hash2,
+	 hash1 );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_normalize(
+	          security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_normalize(
+	          security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_data_size(
+	          security_descriptor2,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 144 );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor1,
+	          byte_stream1,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor2,
+	          byte_stream2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream1,
+	          byte_stream2,
+	          144 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor1,
+	          &hash1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor2,
+	          &hash2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "hash2",
+	 hash2,
+	 hash1 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_normalize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_hash(
+	          NULL,
+	          &hash1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_hash(
+	          security_descriptor1,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor2",
+	 security_descriptor2 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor1",
+	 security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor2 != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor2,
+		 NULL );
+	}
+	if( security_descriptor1 != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor1,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests building a security descriptor and converting it into a byte stream
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_create_discretionary_acl(
+     void )
+{
+	uint8_t byte_stream[ 76 ];
+
+	libcerror_error_t *error                              = NULL;
+	libfwnt_access_control_entry_t *access_control_entry = NULL;
+	libfwnt_access_control_list_t *access_control_list   = NULL;
+	libfwnt_security_descriptor_t *security_descriptor   = NULL;
+	libfwnt_security_identifier_t *security_identifier   = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_descriptor_administrators_sid,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_set_owner(
+	          security_descriptor,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_descriptor_system_sid,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_set_group(
+	          security_descriptor,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_create_system_acl(
+	          security_descriptor,
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_list",
+	 access_control_list );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	access_control_list = NULL;
+
+	result = libfwnt_security_descriptor_remove_system_acl(
+	          security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_create_discretionary_acl(
+	          security_descriptor,
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_list",
+	 access_control_list );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_list_append_entry(
+	          access_control_list,
+	          &access_control_entry,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_entry",
+	 access_control_entry );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_descriptor_world_sid,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_control_entry_set_values(
+	          access_control_entry,
+	          LIBFWNT_ACCESS_ALLOWED,
+	          0,
+	          0x001f01ffUL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_to_byte_stream(
+	          security_descriptor,
+	          byte_stream,
+	          76,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_descriptor_data5,
+	          76 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	access_control_list = NULL;
+
+	result = libfwnt_security_descriptor_create_discretionary_acl(
+	          NULL,
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_create_discretionary_acl(
+	          security_descriptor,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_set_owner(
+	          NULL,
+	          security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_get_owner function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_get_owner(
+     libfwnt_security_descriptor_t *security_descriptor )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_security_identifier_t *owner = NULL;
+	int owner_is_set                     = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_get_owner(
+	          security_descriptor,
+	          &owner,
+	          &error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	owner_is_set = result;
+
+	if( owner_is_set != 0 )
+	{
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "owner",
+		 owner );
+
+		result = libfwnt_security_identifier_free(
+		          &owner,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_get_owner(
+	          NULL,
+	          &owner,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "owner",
+	 owner );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( owner_is_set != 0 )
+	{
+		result = libfwnt_security_descriptor_get_owner(
+		          security_descriptor,
+		          NULL,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "owner",
+		 owner );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( owner != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &owner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_get_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_get_group(
+     libfwnt_security_descriptor_t *security_descriptor )
+{
+	libcerror_error_t *error             = NULL;
+	libfwnt_security_identifier_t *group = NULL;
+	int group_is_set                     = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_get_group(
+	          security_descriptor,
+	          &group,
+	          &error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	group_is_set = result;
+
+	if( group_is_set != 0 )
+	{
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "group",
+		 group );
+
+		result = libfwnt_security_identifier_free(
+		          &group,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_get_group(
+	          NULL,
+	          &group,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "group",
+	 group );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( group_is_set != 0 )
+	{
+		result = libfwnt_security_descriptor_get_group(
+		          security_descriptor,
+		          NULL,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "group",
+		 group );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( group != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &group,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_get_discretionary_acl function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_get_discretionary_acl(
+     libfwnt_security_descriptor_t *security_descriptor )
+{
+	libcerror_error_t *error                         = NULL;
+	libfwnt_access_control_list_t *discretionary_acl = NULL;
+	int discretionary_acl_is_set                     = 0;
+	int result                                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_get_discretionary_acl(
+	          security_descriptor,
+	          &discretionary_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	discretionary_acl_is_set = result;
+
+	if( discretionary_acl_is_set != 0 )
+	{
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "discretionary_acl",
+		 discretionary_acl );
+
+		result = libfwnt_access_control_list_free(
+		          &discretionary_acl,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_get_discretionary_acl(
+	          NULL,
+	          &discretionary_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "discretionary_acl",
+	 discretionary_acl );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( discretionary_acl_is_set != 0 )
+	{
+		result = libfwnt_security_descriptor_get_discretionary_acl(
+		          security_descriptor,
+		          NULL,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "discretionary_acl",
+		 discretionary_acl );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( discretionary_acl != NULL )
+	{
+		libfwnt_access_control_list_free(
+		 &discretionary_acl,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_get_system_acl function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_get_system_acl(
+     libfwnt_security_descriptor_t *security_descriptor )
+{
+	libcerror_error_t *error                  = NULL;
+	libfwnt_access_control_list_t *system_acl = NULL;
+	int result                                = 0;
+	int system_acl_is_set                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_get_system_acl(
+	          security_descriptor,
+	          &system_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	system_acl_is_set = result;
+
+	if( system_acl_is_set != 0 )
+	{
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "system_acl",
+		 system_acl );
+
+		result = libfwnt_access_control_list_free(
+		          &system_acl,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_get_system_acl(
+	          NULL,
+	          &system_acl,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "system_acl",
+	 system_acl );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( system_acl_is_set != 0 )
+	{
+		result = libfwnt_security_descriptor_get_system_acl(
+		          security_descriptor,
+		          NULL,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "system_acl",
+		 system_acl );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( system_acl != NULL )
+	{
+		libfwnt_access_control_list_free(
+		 &system_acl,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_copy_header_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_copy_header_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_control_list_t *access_control_list = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	uint16_t control_flags                             = 0;
+	uint8_t revision_number                            = 0;
+	uint8_t state                                      = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_copy_header_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_revision_number(
+	          security_descriptor,
+	          &revision_number,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "revision_number",
+	 revision_number,
+	 (uint8_t) 1 );
+
+	result = libfwnt_security_descriptor_get_control_flags(
+	          security_descriptor,
+	          &control_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "control_flags",
+	 control_flags,
+	 (uint16_t) 0x8004 );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          security_descriptor,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "state",
+	 state,
+	 (uint8_t) LIBFWNT_ACCESS_CONTROL_LIST_STATE_PRESENT );
+
+	result = libfwnt_security_descriptor_get_owner(
+	          security_descriptor,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	/* The access control lists are not available after reading the header
+	 */
+	result = libfwnt_security_descriptor_get_discretionary_acl(
+	          security_descriptor,
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading the access control lists after reading the header
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl(
+	          security_descriptor,
+	          &access_control_list,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_control_list",
+	 access_control_list );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_copy_header_from_byte_stream(
+	          NULL,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_header_from_byte_stream(
+	          security_descriptor,
+	          NULL,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_header_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_get_discretionary_acl_state function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_get_discretionary_acl_state(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	uint16_t control_flags                             = 0;
+	uint8_t state                                      = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          security_descriptor,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "state",
+	 state,
+	 (uint8_t) LIBFWNT_ACCESS_CONTROL_LIST_STATE_NOT_PRESENT );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data4,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          security_descriptor,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "state",
+	 state,
+	 (uint8_t) LIBFWNT_ACCESS_CONTROL_LIST_STATE_PRESENT );
+
+	/* Test that a discretionary ACL offset without the DACL present flag is ignored
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data6,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          security_descriptor,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "state",
+	 state,
+	 (uint8_t) LIBFWNT_ACCESS_CONTROL_LIST_STATE_NOT_PRESENT );
+
+	result = libfwnt_security_descriptor_get_control_flags(
+	          security_descriptor,
+	          &control_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "control_flags",
+	 control_flags,
+	 (uint16_t) 0x8000 );
+
+	/* Test a discretionary ACL that is present but NULL
+	 */
+	result = libfwnt_security_descriptor_copy_from_utf8_sddl_string(
+	          security_descriptor,
+	          (uint8_t *) "D:NO_ACCESS_CONTROL",
+	          19,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          security_descriptor,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "state",
+	 state,
+	 (uint8_t) LIBFWNT_ACCESS_CONTROL_LIST_STATE_NULL );
+
+	result = libfwnt_security_descriptor_get_system_acl_state(
+	          security_descriptor,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "state",
+	 state,
+	 (uint8_t) LIBFWNT_ACCESS_CONTROL_LIST_STATE_NOT_PRESENT );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          NULL,
+	          &state,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_get_discretionary_acl_state(
+	          security_descriptor,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_check_access function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_check_access(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_access_token_t *administrators_token       = NULL;
+	libfwnt_access_token_t *system_token               = NULL;
+	libfwnt_access_token_t *users_token                = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	uint32_t granted_access                            = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &users_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "users_token",
+	 users_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &system_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "system_token",
+	 system_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &administrators_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "administrators_token",
+	 administrators_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          users_token,
+	          fwnt_test_security_descriptor_users_sid,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          users_token,
+	          fwnt_test_security_descriptor_world_sid,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          system_token,
+	          fwnt_test_security_descriptor_system_sid,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          administrators_token,
+	          fwnt_test_security_descriptor_administrators_sid,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a discretionary ACL with a denied, an inherit-only and allowed entries
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000000UL );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          0x00000002UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000002UL );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000002UL );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          system_token,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x001f01ffUL );
+
+	/* Test that the owner is implicitly granted read control and write DAC access
+	 */
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          administrators_token,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) ( LIBFWNT_ACCESS_MASK_READ_CONTROL | LIBFWNT_ACCESS_MASK_WRITE_DAC ) );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          administrators_token,
+	          0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000000UL );
+
+	/* Test a security descriptor without a discretionary ACL (NULL DACL)
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data3,
+	          48,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000001UL );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x001fffffUL );
+
+	/* Test a security descriptor with an empty discretionary ACL
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data4,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x00000000UL );
+
+	/* Test that a discretionary ACL without the DACL present flag does not restrict access
+	 */
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data6,
+	          56,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access",
+	 granted_access,
+	 (uint32_t) 0x001fffffUL );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_check_access(
+	          NULL,
+	          users_token,
+	          0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          NULL,
+	          0x00000001UL,
+	          &granted_access,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_check_access(
+	          security_descriptor,
+	          users_token,
+	          0x00000001UL,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_access_token_free(
+	          &administrators_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "administrators_token",
+	 administrators_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &system_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "system_token",
+	 system_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_free(
+	          &users_token,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "users_token",
+	 users_token );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( administrators_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &administrators_token,
+		 NULL );
+	}
+	if( system_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &system_token,
+		 NULL );
+	}
+	if( users_token != NULL )
+	{
+		libfwnt_access_token_free(
+		 &users_token,
+		 NULL );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_check_access_for_tokens function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_check_access_for_tokens(
+     void )
+{
+	libfwnt_access_token_t *access_tokens[ 3 ]         = { NULL, NULL, NULL };
+	uint32_t granted_access_masks[ 3 ]                 = { 0, 0, 0 };
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_descriptor_t *security_descriptor = NULL;
+	int access_token_index                             = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor,
+	          fwnt_test_security_descriptor_data2,
+	          144,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_tokens[ 0 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_tokens[ 0 ]",
+	 access_tokens[ 0 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_tokens[ 1 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_tokens[ 1 ]",
+	 access_tokens[ 1 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_initialize(
+	          &access_tokens[ 2 ],
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "access_tokens[ 2 ]",
+	 access_tokens[ 2 ] );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_tokens[ 0 ],
+	          fwnt_test_security_descriptor_users_sid,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_tokens[ 1 ],
+	          fwnt_test_security_descriptor_system_sid,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_access_token_append_byte_stream(
+	          access_tokens[ 2 ],
+	          fwnt_test_security_descriptor_administrators_sid,
+	          16,
+	          LIBFWNT_ENDIAN_LITTLE,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWNT_TEST_ASSERT_IS_NULL(
-	 "group",
-	 group );
-
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	if( group_is_set != 0 )
-	{
-		result = libfwnt_security_descriptor_get_group(
-		          security_descriptor,
-		          NULL,
-		          &error );
-
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "group",
-		 group );
-
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( group != NULL )
-	{
-		libfwnt_security_identifier_free(
-		 &group,
-		 NULL );
-	}
-	return( 0 );
-}
-
-/* Tests the libfwnt_security_descriptor_get_discretionary_acl function
- * Returns 1 if successful or 0 if not
- */
-int fwnt_test_security_descriptor_get_discretionary_acl(
-     libfwnt_security_descriptor_t *security_descriptor )
-{
-	libcerror_error_t *error                         = NULL;
-	libfwnt_access_control_list_t *discretionary_acl = NULL;
-	int discretionary_acl_is_set                     = 0;
-	int result                                       = 0;
-
 	/* Test regular cases
 	 */
-	result = libfwnt_security_descriptor_get_discretionary_acl(
+	result = libfwnt_security_descriptor_check_access_for_tokens(
 	          security_descriptor,
-	          &discretionary_acl,
+	          access_tokens,
+	          3,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
 	          &error );
 
-	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	discretionary_acl_is_set = result;
-
-	if( discretionary_acl_is_set != 0 )
-	{
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "discretionary_acl",
-		 discretionary_acl );
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 0 ]",
+	 granted_access_masks[ 0 ],
+	 (uint32_t) 0x00000002UL );
 
-		result = libfwnt_access_control_list_free(
-		          &discretionary_acl,
-		          &error );
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 1 ]",
+	 granted_access_masks[ 1 ],
+	 (uint32_t) 0x001f01ffUL );
 
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "granted_access_masks[ 2 ]",
+	 granted_access_masks[ 2 ],
+	 (uint32_t) ( LIBFWNT_ACCESS_MASK_READ_CONTROL | LIBFWNT_ACCESS_MASK_WRITE_DAC ) );
 
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = libfwnt_security_descriptor_get_discretionary_acl(
+	result = libfwnt_security_descriptor_check_access_for_tokens(
 	          NULL,
-	          &discretionary_acl,
+	          access_tokens,
+	          3,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -753,10 +4173,6 @@ int fwnt_test_security_descriptor_get_discretionary_acl(
 	 result,
 	 -1 );
 
-	FWNT_TEST_ASSERT_IS_NULL(
-	 "discretionary_acl",
-	 discretionary_acl );
-
 	FWNT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -764,99 +4180,52 @@ int fwnt_test_security_descriptor_get_discretionary_acl(
 	libcerror_error_free(
 	 &error );
 
-	if( discretionary_acl_is_set != 0 )
-	{
-		result = libfwnt_security_descriptor_get_discretionary_acl(
-		          security_descriptor,
-		          NULL,
-		          &error );
-
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "discretionary_acl",
-		 discretionary_acl );
-
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = libfwnt_security_descriptor_check_access_for_tokens(
+	          security_descriptor,
+	          NULL,
+	          3,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
+	          &error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( discretionary_acl != NULL )
-	{
-		libfwnt_access_control_list_free(
-		 &discretionary_acl,
-		 NULL );
-	}
-	return( 0 );
-}
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-/* Tests the libfwnt_security_descriptor_get_system_acl function
- * Returns 1 if successful or 0 if not
- */
-int fwnt_test_security_descriptor_get_system_acl(
-     libfwnt_security_descriptor_t *security_descriptor )
-{
-	libcerror_error_t *error                  = NULL;
-	libfwnt_access_control_list_t *system_acl = NULL;
-	int result                                = 0;
-	int system_acl_is_set                     = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Test regular cases
-	 */
-	result = libfwnt_security_descriptor_get_system_acl(
+	result = libfwnt_security_descriptor_check_access_for_tokens(
 	          security_descriptor,
-	          &system_acl,
+	          access_tokens,
+	          -1,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
+	          granted_access_masks,
 	          &error );
 
-	FWNT_TEST_ASSERT_NOT_EQUAL_INT(
+	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	FWNT_TEST_ASSERT_IS_NULL(
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	system_acl_is_set = result;
-
-	if( system_acl_is_set != 0 )
-	{
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
-		 "system_acl",
-		 system_acl );
-
-		result = libfwnt_access_control_list_free(
-		          &system_acl,
-		          &error );
-
-		FWNT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	libcerror_error_free(
+	 &error );
 
-		FWNT_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
-	/* Test error cases
-	 */
-	result = libfwnt_security_descriptor_get_system_acl(
+	result = libfwnt_security_descriptor_check_access_for_tokens(
+	          security_descriptor,
+	          access_tokens,
+	          3,
+	          LIBFWNT_ACCESS_MASK_MAXIMUM_ALLOWED,
 	          NULL,
-	          &system_acl,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -864,10 +4233,6 @@ int fwnt_test_security_descriptor_get_system_acl(
 	 result,
 	 -1 );
 
-	FWNT_TEST_ASSERT_IS_NULL(
-	 "system_acl",
-	 system_acl );
-
 	FWNT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -875,29 +4240,43 @@ int fwnt_test_security_descriptor_get_system_acl(
 	libcerror_error_free(
 	 &error );
 
-	if( system_acl_is_set != 0 )
+	/* Clean up
+	 */
+	for( access_token_index = 0;
+	     access_token_index < 3;
+	     access_token_index++ )
 	{
-		result = libfwnt_security_descriptor_get_system_acl(
-		          security_descriptor,
-		          NULL,
+		result = libfwnt_access_token_free(
+		          &( access_tokens[ access_token_index ] ),
 		          &error );
 
 		FWNT_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
 		FWNT_TEST_ASSERT_IS_NULL(
-		 "system_acl",
-		 system_acl );
-
-		FWNT_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
 		 error );
-
-		libcerror_error_free(
-		 &error );
 	}
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor",
+	 security_descriptor );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -906,10 +4285,21 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( system_acl != NULL )
+	for( access_token_index = 0;
+	     access_token_index < 3;
+	     access_token_index++ )
 	{
-		libfwnt_access_control_list_free(
-		 &system_acl,
+		if( access_tokens[ access_token_index ] != NULL )
+		{
+			libfwnt_access_token_free(
+			 &( access_tokens[ access_token_index ] ),
+			 NULL );
+		}
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
 		 NULL );
 	}
 	return( 0 );
@@ -942,10 +4332,50 @@ int main(
 	 "libfwnt_security_descriptor_free",
 	 fwnt_test_security_descriptor_free );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_initialize_with_arena",
+	 fwnt_test_security_descriptor_initialize_with_arena );
+
 	FWNT_TEST_RUN(
 	 "libfwnt_security_descriptor_copy_from_byte_stream",
 	 fwnt_test_security_descriptor_copy_from_byte_stream );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_copy_header_from_byte_stream",
+	 fwnt_test_security_descriptor_copy_header_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_get_discretionary_acl_state",
+	 fwnt_test_security_descriptor_get_discretionary_acl_state );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_check_access",
+	 fwnt_test_security_descriptor_check_access );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_check_access_for_tokens",
+	 fwnt_test_security_descriptor_check_access_for_tokens );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_copy_to_byte_stream",
+	 fwnt_test_security_descriptor_copy_to_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_copy_to_utf8_sddl_string",
+	 fwnt_test_security_descriptor_copy_to_utf8_sddl_string );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_copy_from_utf8_sddl_string",
+	 fwnt_test_security_descriptor_copy_from_utf8_sddl_string );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_normalize",
+	 fwnt_test_security_descriptor_normalize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_create_discretionary_acl",
+	 fwnt_test_security_descriptor_create_discretionary_acl );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize security_descriptor for tests
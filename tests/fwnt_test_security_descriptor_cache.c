@@ -0,0 +1,1231 @@
+/*
+ * Library security_descriptor_cache type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_descriptor.h"
+#include "../libfwnt/libfwnt_security_descriptor_cache.h"
+#include "../libfwnt/libfwnt_security_identifier.h"
+
+uint8_t fwnt_test_security_descriptor_cache_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+uint8_t fwnt_test_security_descriptor_cache_data2[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xf4, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Tests the libfwnt_security_descriptor_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_descriptor_cache_t *security_descriptor_cache = NULL;
+	int result                                                     = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                                = 2;
+	int test_number                                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_free(
+	          &security_descriptor_cache,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_cache_initialize(
+	          NULL,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_descriptor_cache = (libfwnt_security_descriptor_cache_t *) 0x12345678UL;
+
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          16,
+	          &error );
+
+	security_descriptor_cache = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_descriptor_cache_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_security_descriptor_cache_initialize(
+		          &security_descriptor_cache,
+		          16,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( security_descriptor_cache != NULL )
+			{
+				libfwnt_security_descriptor_cache_free(
+				 &security_descriptor_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_descriptor_cache",
+			 security_descriptor_cache );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_cache != NULL )
+	{
+		libfwnt_security_descriptor_cache_free(
+		 &security_descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_cache_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_cache_get_security_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_cache_get_security_descriptor(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_descriptor_cache_t *security_descriptor_cache = NULL;
+	libfwnt_security_descriptor_t *security_descriptor1            = NULL;
+	libfwnt_security_descriptor_t *security_descriptor2            = NULL;
+	libfwnt_security_descriptor_t *security_descriptor3            = NULL;
+	int number_of_entries                                          = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor1",
+	 security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the security identifier strings are formatted before the security descriptor is shared
+	 */
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 ( (libfwnt_internal_security_identifier_t *) ( (libfwnt_internal_security_descriptor_t *) security_descriptor1 )->owner_sid )->utf8_string_length,
+	 (size_t) 45 );
+
+	/* Test that identical data returns the shared security descriptor
+	 */
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "security_descriptor2",
+	 (size_t) security_descriptor2,
+	 (size_t) security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that different data returns a different security descriptor
+	 */
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data2,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor3",
+	 security_descriptor3 );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "security_descriptor3",
+	 (ssize_t) security_descriptor3,
+	 (ssize_t) security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_get_number_of_entries(
+	          security_descriptor_cache,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a shared security descriptor cannot be freed or modified
+	 */
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor1",
+	 security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_copy_from_byte_stream(
+	          security_descriptor1,
+	          fwnt_test_security_descriptor_cache_data2,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          NULL,
+	          fwnt_test_security_descriptor_cache_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          NULL,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that invalid data is not cached
+	 */
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data1,
+	          8,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          &security_descriptor3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor3",
+	 security_descriptor3 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_free(
+	          &security_descriptor_cache,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_cache != NULL )
+	{
+		libfwnt_security_descriptor_cache_free(
+		 &security_descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_cache_release_security_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_cache_release_security_descriptor(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_descriptor_cache_t *security_descriptor_cache = NULL;
+	libfwnt_security_descriptor_t *security_descriptor             = NULL;
+	libfwnt_security_descriptor_t *security_descriptor1            = NULL;
+	libfwnt_security_descriptor_t *security_descriptor2            = NULL;
+	int number_of_entries                                          = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the least recently used entry is evicted while still referenced
+	 */
+	result = libfwnt_security_descriptor_cache_get_security_descriptor(
+	          security_descriptor_cache,
+	          fwnt_test_security_descriptor_cache_data2,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_get_number_of_entries(
+	          security_descriptor_cache,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          &security_descriptor1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor1",
+	 security_descriptor1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          NULL,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a security descriptor that is not shared by the cache
+	 */
+	result = libfwnt_security_descriptor_initialize(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_free(
+	          &security_descriptor,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_cache_release_security_descriptor(
+	          security_descriptor_cache,
+	          &security_descriptor2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_cache_free(
+	          &security_descriptor_cache,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_cache",
+	 security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor != NULL )
+	{
+		libfwnt_security_descriptor_free(
+		 &security_descriptor,
+		 NULL );
+	}
+	if( security_descriptor_cache != NULL )
+	{
+		libfwnt_security_descriptor_cache_free(
+		 &security_descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_internal_security_descriptor_cache_evict_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_internal_security_descriptor_cache_evict_entry(
+     void )
+{
+	libcerror_error_t *error                                                         = NULL;
+	libfwnt_internal_security_descriptor_cache_t *internal_security_descriptor_cache = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry1                          = NULL;
+	libfwnt_security_descriptor_cache_entry_t *cache_entry2                          = NULL;
+	libfwnt_security_descriptor_cache_entry_t *evicted_entry                         = NULL;
+	libfwnt_security_descriptor_cache_t *security_descriptor_cache                   = NULL;
+	int result                                                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_security_descriptor_cache = (libfwnt_internal_security_descriptor_cache_t *) security_descriptor_cache;
+
+	result = libfwnt_security_descriptor_cache_entry_initialize(
+	          &cache_entry1,
+	          fwnt_test_security_descriptor_cache_data1,
+	          116,
+	          libfwnt_security_descriptor_cache_calculate_hash(
+	           fwnt_test_security_descriptor_cache_data1,
+	           116 ),
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfwnt_internal_security_descriptor_cache_insert_entry(
+	 internal_security_descriptor_cache,
+	 cache_entry1 );
+
+	result = libfwnt_security_descriptor_cache_entry_initialize(
+	          &cache_entry2,
+	          fwnt_test_security_descriptor_cache_data2,
+	          116,
+	          libfwnt_security_descriptor_cache_calculate_hash(
+	           fwnt_test_security_descriptor_cache_data2,
+	           116 ),
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	libfwnt_internal_security_descriptor_cache_insert_entry(
+	 internal_security_descriptor_cache,
+	 cache_entry2 );
+
+	/* Test that an entry that was retrieved since it was inserted is not evicted
+	 */
+	cache_entry1->is_referenced = 1;
+
+	evicted_entry = libfwnt_internal_security_descriptor_cache_evict_entry(
+	                 internal_security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "evicted_entry",
+	 (size_t) evicted_entry,
+	 (size_t) cache_entry2 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "cache_entry1->is_referenced",
+	 (int) cache_entry1->is_referenced,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "internal_security_descriptor_cache->number_of_entries",
+	 internal_security_descriptor_cache->number_of_entries,
+	 1 );
+
+	result = libfwnt_security_descriptor_cache_entry_free(
+	          &cache_entry2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the entry is evicted once it was passed
+	 */
+	evicted_entry = libfwnt_internal_security_descriptor_cache_evict_entry(
+	                 internal_security_descriptor_cache );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "evicted_entry",
+	 (size_t) evicted_entry,
+	 (size_t) cache_entry1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "internal_security_descriptor_cache->number_of_entries",
+	 internal_security_descriptor_cache->number_of_entries,
+	 0 );
+
+	result = libfwnt_security_descriptor_cache_entry_free(
+	          &cache_entry1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_cache_free(
+	          &security_descriptor_cache,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( cache_entry2 != NULL )
+	 && ( cache_entry2->is_cached == 0 ) )
+	{
+		libfwnt_security_descriptor_cache_entry_free(
+		 &cache_entry2,
+		 NULL );
+	}
+	if( ( cache_entry1 != NULL )
+	 && ( cache_entry1->is_cached == 0 ) )
+	{
+		libfwnt_security_descriptor_cache_entry_free(
+		 &cache_entry1,
+		 NULL );
+	}
+	if( security_descriptor_cache != NULL )
+	{
+		libfwnt_security_descriptor_cache_free(
+		 &security_descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_cache_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_cache_get_number_of_entries(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libfwnt_security_descriptor_cache_t *security_descriptor_cache = NULL;
+	int number_of_entries                                          = 0;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_cache_initialize(
+	          &security_descriptor_cache,
+	          16,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_cache_get_number_of_entries(
+	          security_descriptor_cache,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_cache_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_cache_get_number_of_entries(
+	          security_descriptor_cache,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_cache_free(
+	          &security_descriptor_cache,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_cache != NULL )
+	{
+		libfwnt_security_descriptor_cache_free(
+		 &security_descriptor_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_cache_initialize",
+	 fwnt_test_security_descriptor_cache_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_cache_free",
+	 fwnt_test_security_descriptor_cache_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_cache_get_security_descriptor",
+	 fwnt_test_security_descriptor_cache_get_security_descriptor );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_cache_release_security_descriptor",
+	 fwnt_test_security_descriptor_cache_release_security_descriptor );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_internal_security_descriptor_cache_evict_entry",
+	 fwnt_test_internal_security_descriptor_cache_evict_entry );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_cache_get_number_of_entries",
+	 fwnt_test_security_descriptor_cache_get_number_of_entries );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1815 @@
+/*
+ * Library security_descriptor_view type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_descriptor_view.h"
+
+uint8_t fwnt_test_security_descriptor_view_data1[ 116 ] = {
+	0x01, 0x00, 0x04, 0x80, 0x48, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x34, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+	0x9f, 0x01, 0x12, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x18, 0x00, 0x9f, 0x01, 0x12, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x15, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xc8, 0x68, 0xdd, 0xe8, 0xe4, 0x1c, 0x8a, 0xa7, 0x32, 0x3f,
+	0xeb, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00,
+	0x20, 0x02, 0x00, 0x00 };
+
+/* Security descriptor with a discretionary ACL that contains object and callback entries
+ */
+uint8_t fwnt_test_security_descriptor_view_data2[ 200 ] = {
+	0x01, 0x00, 0x04, 0x80, 0xac, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x98, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x38, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+	0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+	0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	0x12, 0x00, 0x00, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00,
+	0xff, 0x01, 0x1f, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00,
+	0x61, 0x72, 0x74, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0xff, 0x01, 0x1f, 0x00,
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwnt_security_descriptor_view_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_initialize(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_descriptor_view_t *security_descriptor_view = NULL;
+	int result                                                   = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                              = 1;
+	int number_of_memset_fail_tests                              = 1;
+	int test_number                                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_initialize(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_view_free(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_descriptor_view = (libfwnt_security_descriptor_view_t *) 0x12345678UL;
+
+	result = libfwnt_security_descriptor_view_initialize(
+	          &security_descriptor_view,
+	          &error );
+
+	security_descriptor_view = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_descriptor_view_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_security_descriptor_view_initialize(
+		          &security_descriptor_view,
+		          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( security_descriptor_view != NULL )
+			{
+				libfwnt_security_descriptor_view_free(
+				 &security_descriptor_view,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_descriptor_view",
+			 security_descriptor_view );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_descriptor_view_initialize with memset failing
+		 */
+		fwnt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwnt_security_descriptor_view_initialize(
+		          &security_descriptor_view,
+		          &error );
+
+		if( fwnt_test_memset_attempts_before_fail != -1 )
+		{
+			fwnt_test_memset_attempts_before_fail = -1;
+
+			if( security_descriptor_view != NULL )
+			{
+				libfwnt_security_descriptor_view_free(
+				 &security_descriptor_view,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_descriptor_view",
+			 security_descriptor_view );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_view != NULL )
+	{
+		libfwnt_security_descriptor_view_free(
+		 &security_descriptor_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_set_data(
+     void )
+{
+	uint8_t corrupted_data[ 116 ];
+
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_descriptor_view_t *security_descriptor_view = NULL;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_initialize(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, the view can be reused for multiple descriptors
+	 */
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_set_data(
+	          NULL,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          NULL,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          0,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated group SID
+	 */
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          112,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an access control entry size that is out of bounds
+	 */
+	memory_copy(
+	 corrupted_data,
+	 fwnt_test_security_descriptor_view_data1,
+	 116 );
+
+	corrupted_data[ 30 ] = 0xff;
+	corrupted_data[ 31 ] = 0xff;
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          corrupted_data,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_view_free(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_view != NULL )
+	{
+		libfwnt_security_descriptor_view_free(
+		 &security_descriptor_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_control_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_control_flags(
+     libfwnt_security_descriptor_view_t *security_descriptor_view )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t control_flags   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_control_flags(
+	          security_descriptor_view,
+	          &control_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "control_flags",
+	 control_flags,
+	 (uint16_t) 0x8004 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_control_flags(
+	          NULL,
+	          &control_flags,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_control_flags(
+	          security_descriptor_view,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_owner function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_owner(
+     libfwnt_security_descriptor_view_t *security_descriptor_view )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *sid_data  = NULL;
+	size_t sid_data_size     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_owner(
+	          security_descriptor_view,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data",
+	 (size_t) sid_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data1[ 72 ] ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data_size",
+	 sid_data_size,
+	 (size_t) 28 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_owner(
+	          NULL,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_owner(
+	          security_descriptor_view,
+	          NULL,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_owner(
+	          security_descriptor_view,
+	          &sid_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_group function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_group(
+     libfwnt_security_descriptor_view_t *security_descriptor_view )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *sid_data  = NULL;
+	size_t sid_data_size     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_group(
+	          security_descriptor_view,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data",
+	 (size_t) sid_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data1[ 100 ] ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data_size",
+	 sid_data_size,
+	 (size_t) 16 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_group(
+	          NULL,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_discretionary_acl function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_discretionary_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t size            = 0;
+	uint8_t revision_number  = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          security_descriptor_view,
+	          &revision_number,
+	          &size,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "revision_number",
+	 revision_number,
+	 (uint8_t) 2 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT16(
+	 "size",
+	 size,
+	 (uint16_t) 52 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          NULL,
+	          &revision_number,
+	          &size,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl(
+	          security_descriptor_view,
+	          &revision_number,
+	          &size,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_discretionary_acl_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_discretionary_acl_entry(
+     libfwnt_security_descriptor_view_t *security_descriptor_view )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *sid_data  = NULL;
+	size_t sid_data_size     = 0;
+	uint32_t access_mask     = 0;
+	uint8_t flags            = 0;
+	uint8_t type             = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+	          security_descriptor_view,
+	          1,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "type",
+	 type,
+	 (uint8_t) LIBFWNT_ACCESS_ALLOWED );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 (uint8_t) 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "access_mask",
+	 access_mask,
+	 (uint32_t) 0x0012019fUL );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data",
+	 (size_t) sid_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data1[ 56 ] ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data_size",
+	 sid_data_size,
+	 (size_t) 16 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+	          NULL,
+	          1,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+	          security_descriptor_view,
+	          -1,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+	          security_descriptor_view,
+	          2,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+	          security_descriptor_view,
+	          1,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          NULL,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_system_acl function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_system_acl(
+     libfwnt_security_descriptor_view_t *security_descriptor_view )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *sid_data  = NULL;
+	size_t sid_data_size     = 0;
+	uint32_t access_mask     = 0;
+	uint16_t size            = 0;
+	uint8_t flags            = 0;
+	uint8_t revision_number  = 0;
+	uint8_t type             = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_system_acl(
+	          security_descriptor_view,
+	          &revision_number,
+	          &size,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_system_acl(
+	          NULL,
+	          &revision_number,
+	          &size,
+	          &number_of_entries,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_system_acl_entry(
+	          security_descriptor_view,
+	          0,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_discretionary_acl_entry_object_types(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_descriptor_view_t *security_descriptor_view = NULL;
+	const uint8_t *inherited_object_type_data                    = NULL;
+	const uint8_t *object_type_data                              = NULL;
+	uint32_t object_flags                                        = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_initialize(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data2,
+	          200,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          0,
+	          &object_flags,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "object_flags",
+	 object_flags,
+	 (uint32_t) ( LIBFWNT_ACE_OBJECT_TYPE_PRESENT | LIBFWNT_ACE_INHERITED_OBJECT_TYPE_PRESENT ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "object_type_data",
+	 (size_t) object_type_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data2[ 40 ] ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "inherited_object_type_data",
+	 (size_t) inherited_object_type_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data2[ 56 ] ) );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          1,
+	          &object_flags,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT32(
+	 "object_flags",
+	 object_flags,
+	 (uint32_t) LIBFWNT_ACE_OBJECT_TYPE_PRESENT );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "object_type_data",
+	 (size_t) object_type_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data2[ 96 ] ) );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "inherited_object_type_data",
+	 inherited_object_type_data );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          3,
+	          &object_flags,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          NULL,
+	          0,
+	          &object_flags,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          -1,
+	          &object_flags,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          4,
+	          &object_flags,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          0,
+	          NULL,
+	          &object_type_data,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          0,
+	          &object_flags,
+	          NULL,
+	          &inherited_object_type_data,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types(
+	          security_descriptor_view,
+	          0,
+	          &object_flags,
+	          &object_type_data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_view_free(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_view != NULL )
+	{
+		libfwnt_security_descriptor_view_free(
+		 &security_descriptor_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_descriptor_view_get_discretionary_acl_entry_application_data(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_descriptor_view_t *security_descriptor_view = NULL;
+	const uint8_t *data                                          = NULL;
+	const uint8_t *sid_data                                      = NULL;
+	size_t data_size                                             = 0;
+	size_t sid_data_size                                         = 0;
+	uint32_t access_mask                                         = 0;
+	uint8_t flags                                                = 0;
+	uint8_t type                                                 = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_descriptor_view_initialize(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data2,
+	          200,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          security_descriptor_view,
+	          2,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data",
+	 (size_t) data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data2[ 144 ] ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 8 );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry(
+	          security_descriptor_view,
+	          2,
+	          &type,
+	          &flags,
+	          &access_mask,
+	          &sid_data,
+	          &sid_data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data",
+	 (size_t) sid_data,
+	 (size_t) &( fwnt_test_security_descriptor_view_data2[ 132 ] ) );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "sid_data_size",
+	 sid_data_size,
+	 (size_t) 12 );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          security_descriptor_view,
+	          3,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          NULL,
+	          2,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          security_descriptor_view,
+	          -1,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          security_descriptor_view,
+	          4,
+	          &data,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          security_descriptor_view,
+	          2,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data(
+	          security_descriptor_view,
+	          2,
+	          &data,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_view_free(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_view != NULL )
+	{
+		libfwnt_security_descriptor_view_free(
+		 &security_descriptor_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_descriptor_view_t *security_descriptor_view = NULL;
+	int result                                                   = 0;
+
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_initialize",
+	 fwnt_test_security_descriptor_view_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_free",
+	 fwnt_test_security_descriptor_view_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_set_data",
+	 fwnt_test_security_descriptor_view_set_data );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_discretionary_acl_entry_object_types",
+	 fwnt_test_security_descriptor_view_get_discretionary_acl_entry_object_types );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_descriptor_view_get_discretionary_acl_entry_application_data",
+	 fwnt_test_security_descriptor_view_get_discretionary_acl_entry_application_data );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize security_descriptor_view for tests
+	 */
+	result = libfwnt_security_descriptor_view_initialize(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_descriptor_view_set_data(
+	          security_descriptor_view,
+	          fwnt_test_security_descriptor_view_data1,
+	          116,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_view_get_control_flags",
+	 fwnt_test_security_descriptor_view_get_control_flags,
+	 security_descriptor_view );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_view_get_owner",
+	 fwnt_test_security_descriptor_view_get_owner,
+	 security_descriptor_view );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_view_get_group",
+	 fwnt_test_security_descriptor_view_get_group,
+	 security_descriptor_view );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_view_get_discretionary_acl",
+	 fwnt_test_security_descriptor_view_get_discretionary_acl,
+	 security_descriptor_view );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_view_get_discretionary_acl_entry",
+	 fwnt_test_security_descriptor_view_get_discretionary_acl_entry,
+	 security_descriptor_view );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_descriptor_view_get_system_acl",
+	 fwnt_test_security_descriptor_view_get_system_acl,
+	 security_descriptor_view );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_descriptor_view_free(
+	          &security_descriptor_view,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_descriptor_view",
+	 security_descriptor_view );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_descriptor_view != NULL )
+	{
+		libfwnt_security_descriptor_view_free(
+		 &security_descriptor_view,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
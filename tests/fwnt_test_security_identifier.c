@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -311,6 +312,66 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwnt_security_identifier_get_number_of_decimal_digits function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_get_number_of_decimal_digits(
+     void )
+{
+	uint64_t value_64bit    = 0;
+	size_t expected_digits  = 0;
+	size_t number_of_digits = 0;
+
+	/* Test regular cases
+	 */
+	number_of_digits = libfwnt_security_identifier_get_number_of_decimal_digits(
+	                    0 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_digits",
+	 number_of_digits,
+	 (size_t) 1 );
+
+	/* Test the values directly below and at every power of 10
+	 */
+	value_64bit     = 10;
+	expected_digits = 2;
+
+	while( expected_digits <= 20 )
+	{
+		number_of_digits = libfwnt_security_identifier_get_number_of_decimal_digits(
+		                    value_64bit - 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "number_of_digits",
+		 number_of_digits,
+		 expected_digits - 1 );
+
+		number_of_digits = libfwnt_security_identifier_get_number_of_decimal_digits(
+		                    value_64bit );
+
+		FWNT_TEST_ASSERT_EQUAL_SIZE(
+		 "number_of_digits",
+		 number_of_digits,
+		 expected_digits );
+
+		value_64bit     *= 10;
+		expected_digits += 1;
+	}
+	number_of_digits = libfwnt_security_identifier_get_number_of_decimal_digits(
+	                    (uint64_t) 0xffffffffffffffffUL );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_digits",
+	 number_of_digits,
+	 (size_t) 20 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
 
 /* Tests the libfwnt_security_identifier_copy_from_byte_stream function
@@ -470,25 +531,2430 @@ int fwnt_test_security_identifier_copy_from_byte_stream(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfwnt_security_identifier_free(
-	          &security_identifier,
-	          NULL );
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_byte_stream(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint8_t byte_stream[ 28 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_get_data_size(
+	          security_identifier,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 28 );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          byte_stream,
+	          fwnt_test_security_identifier_data1,
+	          28 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_data_size(
+	          security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          NULL,
+	          byte_stream,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          NULL,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          27,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_byte_stream(
+	          security_identifier,
+	          byte_stream,
+	          28,
+	          -1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_from_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to copy security identifier from UTF-8 string
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013",
+	          44,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          64,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-5-21-623811015-3229964156-30300820-1013",
+	          44 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test to copy security identifier from UTF-8 string with a hexadecimal authority
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "s-1-0x5-18",
+	          10,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          64,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-5-18",
+	          9 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test to copy security identifier from UTF-8 string with an alias
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "BA",
+	          2,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          64,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-5-32-544",
+	          13 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          NULL,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          NULL,
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-18",
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-18",
+	          9,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported alias
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "DA",
+	          2,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an invalid string
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-X-18",
+	          9,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-18-",
+	          10,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a revision number that is out of bounds
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-256-5-18",
+	          11,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a sub authority that is out of bounds
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-4294967296",
+	          17,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with too many sub authorities
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-1-2-3-4-5-6-7-8-9-10-11-12-13-14-15-16",
+	          45,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that the security identifier is not changed on error
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          64,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "S-1-5-32-544",
+	          13 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_compare_with_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_compare_with_byte_stream(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to compare security identifier with byte stream
+	 */
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1014",
+	          44,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          NULL,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          NULL,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          8,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          (uint8_t) 'X',
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_compare(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfwnt_security_identifier_t *first_security_identifier  = NULL;
+	libfwnt_security_identifier_t *second_security_identifier = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &first_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to compare security identifiers
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          first_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_compare(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_COMPARE_EQUAL );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1014",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_compare(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_COMPARE_LESS );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_compare(
+	          second_security_identifier,
+	          first_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_COMPARE_GREATER );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to compare security identifiers where one is a prefix of the other
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820",
+	          38,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_compare(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_COMPARE_GREATER );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to compare security identifiers with a different authority
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-16-4096",
+	          11,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_compare(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_COMPARE_LESS );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_compare(
+	          NULL,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_compare(
+	          first_security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &second_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &first_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &second_security_identifier,
+		 NULL );
+	}
+	if( first_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &first_security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_is_equal function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_is_equal(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfwnt_security_identifier_t *first_security_identifier  = NULL;
+	libfwnt_security_identifier_t *second_security_identifier = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &first_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to determine if security identifiers are equal
+	 */
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          first_security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_is_equal(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820",
+	          38,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_is_equal(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1014",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_is_equal(
+	          first_security_identifier,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_is_equal(
+	          NULL,
+	          second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_is_equal(
+	          first_security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &second_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &first_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &second_security_identifier,
+		 NULL );
+	}
+	if( first_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &first_security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_get_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_get_hash(
+     void )
+{
+	libcerror_error_t *error                                  = NULL;
+	libfwnt_security_identifier_t *first_security_identifier  = NULL;
+	libfwnt_security_identifier_t *second_security_identifier = NULL;
+	uint64_t first_hash                                       = 0;
+	uint64_t second_hash                                      = 0;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &first_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to retrieve the hash
+	 */
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          first_security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_hash(
+	          first_security_identifier,
+	          &first_hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that equal security identifiers have the same hash
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_hash(
+	          second_security_identifier,
+	          &second_hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_UINT64(
+	 "second_hash",
+	 second_hash,
+	 first_hash );
+
+	/* Test that different security identifiers have a different hash
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1014",
+	          43,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_hash(
+	          second_security_identifier,
+	          &second_hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_UINT64(
+	 "second_hash",
+	 second_hash,
+	 first_hash );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820",
+	          38,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_hash(
+	          second_security_identifier,
+	          &second_hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_NOT_EQUAL_UINT64(
+	 "second_hash",
+	 second_hash,
+	 first_hash );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_hash(
+	          NULL,
+	          &first_hash,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_hash(
+	          first_security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &second_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &first_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &second_security_identifier,
+		 NULL );
+	}
+	if( first_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &first_security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_key(
+     void )
+{
+	uint8_t first_key[ LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE ];
+	uint8_t second_key[ LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE ];
+
+	uint8_t expected_key[ LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE ] = {
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x15, 0x25, 0x2e, 0x99, 0xc7, 0xc0,
+		0x85, 0x57, 0x7c, 0x01, 0xce, 0x5a, 0x94, 0x00, 0x00, 0x03, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x05 };
+
+	libcerror_error_t *error                                  = NULL;
+	libfwnt_security_identifier_t *first_security_identifier  = NULL;
+	libfwnt_security_identifier_t *second_security_identifier = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &first_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &second_security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test to copy the security identifier to a key
+	 */
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          first_security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_key(
+	          first_security_identifier,
+	          first_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_key,
+	          expected_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the order of the keys matches the order of the security identifiers
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013-0",
+	          45,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_key(
+	          second_security_identifier,
+	          second_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_key,
+	          second_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE );
+
+	FWNT_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          second_security_identifier,
+	          (uint8_t *) "S-1-5-21-623811015-3229964156-30300821",
+	          38,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_to_key(
+	          second_security_identifier,
+	          second_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          first_key,
+	          second_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE );
+
+	FWNT_TEST_ASSERT_LESS_THAN_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_key(
+	          NULL,
+	          first_key,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_key(
+	          first_security_identifier,
+	          NULL,
+	          LIBFWNT_SECURITY_IDENTIFIER_KEY_SIZE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_key(
+	          first_security_identifier,
+	          first_key,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_key(
+	          first_security_identifier,
+	          first_key,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &second_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "second_security_identifier",
+	 second_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_free(
+	          &first_security_identifier,
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "first_security_identifier",
+	 first_security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &second_security_identifier,
+		 NULL );
+	}
+	if( first_security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &first_security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_get_well_known_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_get_well_known_type(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfwnt_security_identifier_t *security_identifier = NULL;
+	int result                                         = 0;
+	int well_known_type                                = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          security_identifier,
+	          (uint8_t *) "S-1-5-32-544",
+	          12,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_well_known_type(
+	          security_identifier,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "well_known_type",
+	 well_known_type,
+	 LIBFWNT_WELL_KNOWN_SID_BUILTIN_ADMINISTRATORS );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_get_well_known_type(
+	          security_identifier,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "well_known_type",
+	 well_known_type,
+	 LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_well_known_type(
+	          NULL,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_well_known_type(
+	          security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_get_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_get_string_size(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Test retrieve string size
+	 */
+	result = libfwnt_security_identifier_get_string_size(
+	          security_identifier,
+	          &string_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 44 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_string_size(
+	          NULL,
+	          &string_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_string_size(
+	          security_identifier,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_get_string_size(
+	          security_identifier,
+	          &string_size,
+	          0xffffffffUL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_copy_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_copy_to_utf8_string(
+     libfwnt_security_identifier_t *security_identifier )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test copy to UTF-8 string
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          NULL,
+	          utf8_string,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          NULL,
+	          47,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          18,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          0xffffffffUL,
+	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FWNT_TEST_ASSERT_IS_NULL(
-	 "security_identifier",
-	 security_identifier );
+	 -1 );
 
-	FWNT_TEST_ASSERT_IS_NULL(
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -497,30 +2963,28 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( security_identifier != NULL )
-	{
-		libfwnt_security_identifier_free(
-		 &security_identifier,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_get_string_size function
+/* Tests the libfwnt_security_identifier_copy_to_utf8_string_with_index function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_get_string_size(
+int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
      libfwnt_security_identifier_t *security_identifier )
 {
+	uint8_t utf8_string[ 64 ];
+
 	libcerror_error_t *error = NULL;
-	size_t string_size       = 0;
+	size_t utf8_string_index = 0;
 	int result               = 0;
 
-	/* Test retrieve string size
+	/* Test copy to UTF-8 string
 	 */
-	result = libfwnt_security_identifier_get_string_size(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
 	          security_identifier,
-	          &string_size,
+	          utf8_string,
+	          47,
+	          &utf8_string_index,
 	          0,
 	          &error );
 
@@ -535,9 +2999,11 @@ int fwnt_test_security_identifier_get_string_size(
 
 	/* Test error cases
 	 */
-	result = libfwnt_security_identifier_get_string_size(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
 	          NULL,
-	          &string_size,
+	          utf8_string,
+	          47,
+	          &utf8_string_index,
 	          0,
 	          &error );
 
@@ -553,9 +3019,11 @@ int fwnt_test_security_identifier_get_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_get_string_size(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
 	          security_identifier,
 	          NULL,
+	          47,
+	          &utf8_string_index,
 	          0,
 	          &error );
 
@@ -571,9 +3039,51 @@ int fwnt_test_security_identifier_get_string_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_get_string_size(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
 	          security_identifier,
-	          &string_size,
+	          utf8_string,
+	          18,
+	          &utf8_string_index,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          NULL,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	          security_identifier,
+	          utf8_string,
+	          47,
+	          &utf8_string_index,
 	          0xffffffffUL,
 	          &error );
 
@@ -600,23 +3110,26 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf8_string function
+/* Tests the libfwnt_security_identifier_copy_to_utf8_string_with_size function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf8_string(
+int fwnt_test_security_identifier_copy_to_utf8_string_with_size(
      libfwnt_security_identifier_t *security_identifier )
 {
 	uint8_t utf8_string[ 64 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	uint8_t *expected_utf8_string = (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013";
+	libcerror_error_t *error      = NULL;
+	size_t string_size            = 0;
+	int result                    = 0;
 
 	/* Test copy to UTF-8 string
 	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
 	          security_identifier,
 	          utf8_string,
-	          47,
+	          64,
+	          &string_size,
 	          0,
 	          &error );
 
@@ -625,16 +3138,82 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	 result,
 	 1 );
 
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 44 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          44 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test retrieve string size with a string that is too small
+	 */
+	string_size = 0;
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
+	          security_identifier,
+	          utf8_string,
+	          43,
+	          &string_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 44 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_size = 0;
+
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
+	          security_identifier,
+	          NULL,
+	          0,
+	          &string_size,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 44 );
+
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
 	          NULL,
 	          utf8_string,
-	          47,
+	          64,
+	          &string_size,
 	          0,
 	          &error );
 
@@ -650,10 +3229,11 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
 	          security_identifier,
-	          NULL,
-	          47,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_size,
 	          0,
 	          &error );
 
@@ -669,10 +3249,11 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
 	          security_identifier,
 	          utf8_string,
-	          18,
+	          64,
+	          NULL,
 	          0,
 	          &error );
 
@@ -688,10 +3269,11 @@ int fwnt_test_security_identifier_copy_to_utf8_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string(
+	result = libfwnt_security_identifier_copy_to_utf8_string_with_size(
 	          security_identifier,
 	          utf8_string,
-	          47,
+	          64,
+	          &string_size,
 	          0xffffffffUL,
 	          &error );
 
@@ -718,26 +3300,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwnt_security_identifier_copy_to_utf8_string_with_index function
+/* Tests the libfwnt_security_identifier_get_utf8_string_reference function
  * Returns 1 if successful or 0 if not
  */
-int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
+int fwnt_test_security_identifier_get_utf8_string_reference(
      libfwnt_security_identifier_t *security_identifier )
 {
-	uint8_t utf8_string[ 64 ];
+	uint8_t *expected_utf8_string = (uint8_t *) "S-1-5-21-623811015-3229964156-30300820-1013";
+	libcerror_error_t *error      = NULL;
+	const uint8_t *utf8_string    = NULL;
+	const uint8_t *utf8_string2   = NULL;
+	size_t utf8_string_length     = 0;
+	int result                    = 0;
 
-	libcerror_error_t *error = NULL;
-	size_t utf8_string_index = 0;
-	int result               = 0;
-
-	/* Test copy to UTF-8 string
+	/* Test regular cases
 	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	result = libfwnt_security_identifier_get_utf8_string_reference(
 	          security_identifier,
-	          utf8_string,
-	          47,
-	          &utf8_string_index,
-	          0,
+	          &utf8_string,
+	          &utf8_string_length,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -745,58 +3326,57 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	 result,
 	 1 );
 
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 43 );
+
 	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
-	          NULL,
+	result = memory_compare(
 	          utf8_string,
-	          47,
-	          &utf8_string_index,
-	          0,
-	          &error );
+	          expected_utf8_string,
+	          44 );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
+	 0 );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	/* Test that the cached string is returned
+	 */
+	result = libfwnt_security_identifier_get_utf8_string_reference(
 	          security_identifier,
-	          NULL,
-	          47,
-	          &utf8_string_index,
-	          0,
+	          &utf8_string2,
+	          &utf8_string_length,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string2",
+	 (size_t) utf8_string2,
+	 (size_t) utf8_string );
+
+	FWNT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
-	          security_identifier,
-	          utf8_string,
-	          18,
-	          &utf8_string_index,
-	          0,
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_get_utf8_string_reference(
+	          NULL,
+	          &utf8_string,
+	          &utf8_string_length,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -811,12 +3391,10 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	result = libfwnt_security_identifier_get_utf8_string_reference(
 	          security_identifier,
-	          utf8_string,
-	          47,
 	          NULL,
-	          0,
+	          &utf8_string_length,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -831,12 +3409,10 @@ int fwnt_test_security_identifier_copy_to_utf8_string_with_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwnt_security_identifier_copy_to_utf8_string_with_index(
+	result = libfwnt_security_identifier_get_utf8_string_reference(
 	          security_identifier,
-	          utf8_string,
-	          47,
-	          &utf8_string_index,
-	          0xffffffffUL,
+	          &utf8_string,
+	          NULL,
 	          &error );
 
 	FWNT_TEST_ASSERT_EQUAL_INT(
@@ -1419,12 +3995,44 @@ int main(
 	 "libfwnt_internal_security_identifier_free",
 	 fwnt_test_internal_security_identifier_free );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_get_number_of_decimal_digits",
+	 fwnt_test_security_identifier_get_number_of_decimal_digits );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
 
 	FWNT_TEST_RUN(
 	 "libfwnt_security_identifier_copy_from_byte_stream",
 	 fwnt_test_security_identifier_copy_from_byte_stream );
 
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_from_utf8_string",
+	 fwnt_test_security_identifier_copy_from_utf8_string );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_compare_with_byte_stream",
+	 fwnt_test_security_identifier_compare_with_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_compare",
+	 fwnt_test_security_identifier_compare );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_is_equal",
+	 fwnt_test_security_identifier_is_equal );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_get_hash",
+	 fwnt_test_security_identifier_get_hash );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_copy_to_key",
+	 fwnt_test_security_identifier_copy_to_key );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_get_well_known_type",
+	 fwnt_test_security_identifier_get_well_known_type );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize security_identifier for tests
@@ -1462,6 +4070,11 @@ int main(
 	 "error",
 	 error );
 
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_identifier_copy_to_byte_stream",
+	 fwnt_test_security_identifier_copy_to_byte_stream,
+	 security_identifier );
+
 	FWNT_TEST_RUN_WITH_ARGS(
 	 "libfwnt_security_identifier_get_string_size",
 	 fwnt_test_security_identifier_get_string_size,
@@ -1477,6 +4090,16 @@ int main(
 	 fwnt_test_security_identifier_copy_to_utf8_string_with_index,
 	 security_identifier );
 
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_identifier_copy_to_utf8_string_with_size",
+	 fwnt_test_security_identifier_copy_to_utf8_string_with_size,
+	 security_identifier );
+
+	FWNT_TEST_RUN_WITH_ARGS(
+	 "libfwnt_security_identifier_get_utf8_string_reference",
+	 fwnt_test_security_identifier_get_utf8_string_reference,
+	 security_identifier );
+
 	FWNT_TEST_RUN_WITH_ARGS(
 	 "libfwnt_security_identifier_copy_to_utf16_string",
 	 fwnt_test_security_identifier_copy_to_utf16_string,
@@ -0,0 +1,1472 @@
+/*
+ * Library security_identifier_pool type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_memory.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_security_identifier.h"
+#include "../libfwnt/libfwnt_security_identifier_pool.h"
+uint8_t fwnt_test_security_identifier_pool_data1[ 28 ] = {
+	0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 0xc7, 0x99, 0x2e, 0x25,
+	0x7c, 0x57, 0x85, 0xc0, 0x94, 0x5a, 0xce, 0x01, 0xf5, 0x03, 0x00, 0x00 };
+
+uint8_t fwnt_test_security_identifier_pool_data2[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwnt_security_identifier_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_identifier_pool_t *security_identifier_pool = NULL;
+	int result                                                   = 0;
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                              = 3;
+	int test_number                                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_pool_free(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_identifier_pool = (libfwnt_security_identifier_pool_t *) 0x12345678UL;
+
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	security_identifier_pool = NULL;
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWNT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwnt_security_identifier_pool_initialize with malloc failing
+		 */
+		fwnt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwnt_security_identifier_pool_initialize(
+		          &security_identifier_pool,
+			          &error );
+
+		if( fwnt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwnt_test_malloc_attempts_before_fail = -1;
+
+			if( security_identifier_pool != NULL )
+			{
+				libfwnt_security_identifier_pool_free(
+				 &security_identifier_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWNT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWNT_TEST_ASSERT_IS_NULL(
+			 "security_identifier_pool",
+			 security_identifier_pool );
+
+			FWNT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWNT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_pool != NULL )
+	{
+		libfwnt_security_identifier_pool_free(
+		 &security_identifier_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_free(
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_pool_intern_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_intern_byte_stream(
+     void )
+{
+	uint8_t byte_stream[ 12 ];
+
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_identifier_pool_t *security_identifier_pool = NULL;
+	int handle1                                                  = 0;
+	int handle2                                                  = 0;
+	int handle3                                                  = 0;
+	int iterator                                                 = 0;
+	int number_of_security_identifiers                           = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "handle1",
+	 handle1,
+	 0 );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data2,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "handle2",
+	 handle2,
+	 1 );
+
+	/* Test that the same security identifier returns the same handle
+	 */
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "handle3",
+	 handle3,
+	 handle1 );
+
+	/* Test with enough security identifiers to resize the pool
+	 */
+	if( memory_copy(
+	     byte_stream,
+	     fwnt_test_security_identifier_pool_data2,
+	     12 ) == NULL )
+	{
+		goto on_error;
+	}
+	for( iterator = 0;
+	     iterator < 256;
+	     iterator++ )
+	{
+		byte_stream[ 9 ]  = (uint8_t) iterator;
+		byte_stream[ 10 ] = 0x01;
+
+		result = libfwnt_security_identifier_pool_intern_byte_stream(
+		          security_identifier_pool,
+		          byte_stream,
+		          12,
+		          LIBFWNT_ENDIAN_LITTLE,
+		          &handle3,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "handle3",
+		 handle3,
+		 iterator + 2 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+	          security_identifier_pool,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 258 );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "handle3",
+	 handle3,
+	 handle1 );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data2,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle3,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "handle3",
+	 handle3,
+	 handle2 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          NULL,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          NULL,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          8,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          (uint8_t) 'X',
+	          &handle1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_pool_free(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_pool != NULL )
+	{
+		libfwnt_security_identifier_pool_free(
+		 &security_identifier_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_pool_intern_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_intern_security_identifier(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_identifier_pool_t *security_identifier_pool = NULL;
+	libfwnt_security_identifier_t *security_identifier           = NULL;
+	int handle1                                                  = 0;
+	int handle2                                                  = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_initialize(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_copy_from_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle1,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_pool_intern_security_identifier(
+	          security_identifier_pool,
+	          security_identifier,
+	          &handle2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "handle2",
+	 handle2,
+	 handle1 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_intern_security_identifier(
+	          NULL,
+	          security_identifier,
+	          &handle2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_intern_security_identifier(
+	          security_identifier_pool,
+	          NULL,
+	          &handle2,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_intern_security_identifier(
+	          security_identifier_pool,
+	          security_identifier,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_pool_free(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier != NULL )
+	{
+		libfwnt_security_identifier_free(
+		 &security_identifier,
+		 NULL );
+	}
+	if( security_identifier_pool != NULL )
+	{
+		libfwnt_security_identifier_pool_free(
+		 &security_identifier_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_pool_get_number_of_security_identifiers function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_get_number_of_security_identifiers(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_identifier_pool_t *security_identifier_pool = NULL;
+	int handle                                                   = 0;
+	int number_of_security_identifiers                           = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+	          security_identifier_pool,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 0 );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+	          security_identifier_pool,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_security_identifiers",
+	 number_of_security_identifiers,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+	          NULL,
+	          &number_of_security_identifiers,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_number_of_security_identifiers(
+	          security_identifier_pool,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_pool_free(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_pool != NULL )
+	{
+		libfwnt_security_identifier_pool_free(
+		 &security_identifier_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_pool_get_security_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_get_security_identifier(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_identifier_pool_t *security_identifier_pool = NULL;
+	libfwnt_security_identifier_t *security_identifier           = NULL;
+	int handle                                                   = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_pool_get_security_identifier(
+	          security_identifier_pool,
+	          handle,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	/* Test that the string is formatted before the security identifier is shared
+	 */
+	FWNT_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "utf8_string_length",
+	 (ssize_t) ( (libfwnt_internal_security_identifier_t *) security_identifier )->utf8_string_length,
+	 (ssize_t) 0 );
+
+	result = libfwnt_security_identifier_compare_with_byte_stream(
+	          security_identifier,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The security identifier is owned by the pool, hence free only clears the reference
+	 */
+	result = libfwnt_security_identifier_free(
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier",
+	 security_identifier );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_get_security_identifier(
+	          NULL,
+	          handle,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_security_identifier(
+	          security_identifier_pool,
+	          -1,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_security_identifier(
+	          security_identifier_pool,
+	          1,
+	          &security_identifier,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_security_identifier(
+	          security_identifier_pool,
+	          handle,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_pool_free(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_pool != NULL )
+	{
+		libfwnt_security_identifier_pool_free(
+		 &security_identifier_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_security_identifier_pool_get_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_security_identifier_pool_get_utf8_string(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfwnt_security_identifier_pool_t *security_identifier_pool = NULL;
+	const uint8_t *utf8_string1                                  = NULL;
+	const uint8_t *utf8_string2                                  = NULL;
+	size_t utf8_string_length                                    = 0;
+	int handle                                                   = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwnt_security_identifier_pool_initialize(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_security_identifier_pool_intern_byte_stream(
+	          security_identifier_pool,
+	          fwnt_test_security_identifier_pool_data1,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &handle,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          security_identifier_pool,
+	          handle,
+	          &utf8_string1,
+	          &utf8_string_length,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string1",
+	 utf8_string1 );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_length",
+	 utf8_string_length,
+	 (size_t) 43 );
+
+	result = memory_compare(
+	          utf8_string1,
+	          "S-1-5-21-623811015-3229964156-30300820-1013",
+	          44 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the string is formatted only once
+	 */
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          security_identifier_pool,
+	          handle,
+	          &utf8_string2,
+	          &utf8_string_length,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWNT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string2",
+	 (size_t) utf8_string2,
+	 (size_t) utf8_string1 );
+
+	/* Test error cases
+	 */
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          NULL,
+	          handle,
+	          &utf8_string1,
+	          &utf8_string_length,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          security_identifier_pool,
+	          -1,
+	          &utf8_string1,
+	          &utf8_string_length,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          security_identifier_pool,
+	          1,
+	          &utf8_string1,
+	          &utf8_string_length,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          security_identifier_pool,
+	          handle,
+	          NULL,
+	          &utf8_string_length,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_security_identifier_pool_get_utf8_string(
+	          security_identifier_pool,
+	          handle,
+	          &utf8_string1,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwnt_security_identifier_pool_free(
+	          &security_identifier_pool,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "security_identifier_pool",
+	 security_identifier_pool );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_identifier_pool != NULL )
+	{
+		libfwnt_security_identifier_pool_free(
+		 &security_identifier_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_initialize",
+	 fwnt_test_security_identifier_pool_initialize );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_free",
+	 fwnt_test_security_identifier_pool_free );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_intern_byte_stream",
+	 fwnt_test_security_identifier_pool_intern_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_intern_security_identifier",
+	 fwnt_test_security_identifier_pool_intern_security_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_get_number_of_security_identifiers",
+	 fwnt_test_security_identifier_pool_get_number_of_security_identifiers );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_get_security_identifier",
+	 fwnt_test_security_identifier_pool_get_security_identifier );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_security_identifier_pool_get_utf8_string",
+	 fwnt_test_security_identifier_pool_get_utf8_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,589 @@
+/*
+ * Library well-known security identifier functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwnt_test_libcerror.h"
+#include "fwnt_test_libfwnt.h"
+#include "fwnt_test_macros.h"
+#include "fwnt_test_unused.h"
+
+#include "../libfwnt/libfwnt_definitions.h"
+#include "../libfwnt/libfwnt_security_identifier.h"
+#include "../libfwnt/libfwnt_well_known_security_identifier.h"
+
+/* S-1-5-18
+ */
+uint8_t fwnt_test_well_known_security_identifier_data1[ 12 ] = {
+	0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x12, 0x00, 0x00, 0x00 };
+
+/* S-1-5-21-623811015-3229964156-30300820-500
+ */
+uint8_t fwnt_test_well_known_security_identifier_data2[ 28 ] = {
+	0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 0xc7, 0x99, 0x2e, 0x25,
+	0x7c, 0x57, 0x85, 0xc0, 0x94, 0x5a, 0xce, 0x01, 0xf4, 0x01, 0x00, 0x00 };
+
+/* S-1-5-21-623811015-3229964156-30300820-1013
+ */
+uint8_t fwnt_test_well_known_security_identifier_data3[ 28 ] = {
+	0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x15, 0x00, 0x00, 0x00, 0xc7, 0x99, 0x2e, 0x25,
+	0x7c, 0x57, 0x85, 0xc0, 0x94, 0x5a, 0xce, 0x01, 0xf5, 0x03, 0x00, 0x00 };
+
+/* Tests the libfwnt_well_known_security_identifier_get_type_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_well_known_security_identifier_get_type_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+	int well_known_type      = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+	          fwnt_test_well_known_security_identifier_data1,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "well_known_type",
+	 well_known_type,
+	 LIBFWNT_WELL_KNOWN_SID_LOCAL_SYSTEM );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+	          fwnt_test_well_known_security_identifier_data2,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "well_known_type",
+	 well_known_type,
+	 LIBFWNT_WELL_KNOWN_SID_ADMINISTRATOR );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+	          fwnt_test_well_known_security_identifier_data3,
+	          28,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "well_known_type",
+	 well_known_type,
+	 LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+	          NULL,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+	          fwnt_test_well_known_security_identifier_data1,
+	          4,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          &well_known_type,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwnt_well_known_security_identifier_get_type_from_byte_stream(
+	          fwnt_test_well_known_security_identifier_data1,
+	          12,
+	          LIBFWNT_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_well_known_security_identifier_get_sddl_alias function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_well_known_security_identifier_get_sddl_alias(
+     void )
+{
+	const char *sddl_alias = NULL;
+	int result             = 0;
+
+	/* Test regular cases
+	 */
+	sddl_alias = libfwnt_well_known_security_identifier_get_sddl_alias(
+	              LIBFWNT_WELL_KNOWN_SID_LOCAL_SYSTEM );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "sddl_alias",
+	 sddl_alias );
+
+	result = narrow_string_compare(
+	          sddl_alias,
+	          "SY",
+	          3 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sddl_alias = libfwnt_well_known_security_identifier_get_sddl_alias(
+	              LIBFWNT_WELL_KNOWN_SID_DOMAIN_ADMINS );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "sddl_alias",
+	 sddl_alias );
+
+	result = narrow_string_compare(
+	          sddl_alias,
+	          "DA",
+	          3 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sddl_alias = libfwnt_well_known_security_identifier_get_sddl_alias(
+	              LIBFWNT_WELL_KNOWN_SID_CAPABILITY );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "sddl_alias",
+	 sddl_alias );
+
+	/* Test error cases
+	 */
+	sddl_alias = libfwnt_well_known_security_identifier_get_sddl_alias(
+	              LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "sddl_alias",
+	 sddl_alias );
+
+	sddl_alias = libfwnt_well_known_security_identifier_get_sddl_alias(
+	              -1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "sddl_alias",
+	 sddl_alias );
+
+	sddl_alias = libfwnt_well_known_security_identifier_get_sddl_alias(
+	              LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY + 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "sddl_alias",
+	 sddl_alias );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwnt_well_known_security_identifier_get_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_well_known_security_identifier_get_name(
+     void )
+{
+	const char *name    = NULL;
+	int well_known_type = 0;
+
+	/* Test regular cases
+	 */
+	for( well_known_type = LIBFWNT_WELL_KNOWN_SID_NULL;
+	     well_known_type <= LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY;
+	     well_known_type++ )
+	{
+		name = libfwnt_well_known_security_identifier_get_name(
+		        well_known_type );
+
+		FWNT_TEST_ASSERT_IS_NOT_NULL(
+		 "name",
+		 name );
+	}
+	/* Test error cases
+	 */
+	name = libfwnt_well_known_security_identifier_get_name(
+	        LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "name",
+	 name );
+
+	name = libfwnt_well_known_security_identifier_get_name(
+	        LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY + 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "name",
+	 name );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+/* Tests the libfwnt_well_known_security_identifier_get_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_well_known_security_identifier_get_type(
+     void )
+{
+	libfwnt_internal_security_identifier_t security_identifier;
+
+	libcerror_error_t *error = NULL;
+	const char *string       = NULL;
+	int result               = 0;
+	int well_known_type      = 0;
+
+	/* Test that every security identifier in the table maps back onto its type
+	 */
+	for( well_known_type = LIBFWNT_WELL_KNOWN_SID_NULL;
+	     well_known_type <= LIBFWNT_WELL_KNOWN_SID_SERVICE_ASSERTED_IDENTITY;
+	     well_known_type++ )
+	{
+		string = libfwnt_well_known_security_identifiers[ well_known_type ].string;
+
+		if( string == NULL )
+		{
+			continue;
+		}
+		result = memory_set(
+		          &security_identifier,
+		          0,
+		          sizeof( libfwnt_internal_security_identifier_t ) ) != NULL;
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libfwnt_security_identifier_copy_from_utf8_string(
+		          (libfwnt_security_identifier_t *) &security_identifier,
+		          (uint8_t *) string,
+		          narrow_string_length( string ),
+		          0,
+		          &error );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWNT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwnt_well_known_security_identifier_get_type(
+		          &security_identifier );
+
+		FWNT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 well_known_type );
+	}
+	/* Test security identifiers that represent a class
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          (libfwnt_security_identifier_t *) &security_identifier,
+	          (uint8_t *) "S-1-5-5-0-12345",
+	          15,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_well_known_security_identifier_get_type(
+	          &security_identifier );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_WELL_KNOWN_SID_LOGON_SESSION );
+
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          (libfwnt_security_identifier_t *) &security_identifier,
+	          (uint8_t *) "S-1-15-3-1024-1065365936-1281604716-3511738428-1654721687-432734479-3232135806-4053264122-3456934681",
+	          100,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_well_known_security_identifier_get_type(
+	          &security_identifier );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_WELL_KNOWN_SID_CAPABILITY );
+
+	/* Test security identifiers that are not well-known
+	 */
+	result = libfwnt_security_identifier_copy_from_utf8_string(
+	          (libfwnt_security_identifier_t *) &security_identifier,
+	          (uint8_t *) "S-1-5-32-999",
+	          12,
+	          0,
+	          &error );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwnt_well_known_security_identifier_get_type(
+	          &security_identifier );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+
+	result = libfwnt_well_known_security_identifier_get_type(
+	          NULL );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFWNT_WELL_KNOWN_SID_UNKNOWN );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwnt_well_known_security_identifier_get_string_by_sddl_alias function
+ * Returns 1 if successful or 0 if not
+ */
+int fwnt_test_well_known_security_identifier_get_string_by_sddl_alias(
+     void )
+{
+	const char *string = NULL;
+	int result         = 0;
+
+	/* Test regular cases
+	 */
+	string = libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+	          (uint8_t *) "BA" );
+
+	FWNT_TEST_ASSERT_IS_NOT_NULL(
+	 "string",
+	 string );
+
+	result = narrow_string_compare(
+	          string,
+	          "S-1-5-32-544",
+	          13 );
+
+	FWNT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Aliases relative to a domain do not map onto a single security identifier
+	 */
+	string = libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+	          (uint8_t *) "DA" );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
+
+	/* Test error cases
+	 */
+	string = libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+	          (uint8_t *) "ZZ" );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
+
+	string = libfwnt_well_known_security_identifier_get_string_by_sddl_alias(
+	          NULL );
+
+	FWNT_TEST_ASSERT_IS_NULL(
+	 "string",
+	 string );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWNT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWNT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWNT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWNT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_well_known_security_identifier_get_type_from_byte_stream",
+	 fwnt_test_well_known_security_identifier_get_type_from_byte_stream );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_well_known_security_identifier_get_sddl_alias",
+	 fwnt_test_well_known_security_identifier_get_sddl_alias );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_well_known_security_identifier_get_name",
+	 fwnt_test_well_known_security_identifier_get_name );
+
+#if defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT )
+
+	FWNT_TEST_RUN(
+	 "libfwnt_well_known_security_identifier_get_type",
+	 fwnt_test_well_known_security_identifier_get_type );
+
+	FWNT_TEST_RUN(
+	 "libfwnt_well_known_security_identifier_get_string_by_sddl_alias",
+	 fwnt_test_well_known_security_identifier_get_string_by_sddl_alias );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWNT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -19,6 +19,7 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+import tracemalloc
 import unittest
 
 import pyfwnt
@@ -1020,6 +1021,148 @@ class LZNT1FunctionsTests(unittest.TestCase):
 
     self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
 
+    uncompressed_data = pyfwnt.lznt1_decompress(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data_size=7640)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    uncompressed_data = pyfwnt.lznt1_decompress(
+        bytearray(self._COMPRESSED_DATA), uncompressed_data_size=7640)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+  def test_lznt1_decompress_with_estimated_size(self):
+    """Tests the lznt1_decompress function without uncompressed data size."""
+    # Only the first 2 compressed chunks of the test data are complete.
+    uncompressed_data = pyfwnt.lznt1_decompress(self._COMPRESSED_DATA[:3575])
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(IOError):
+      pyfwnt.lznt1_decompress(
+          self._COMPRESSED_DATA, maximum_uncompressed_data_size=16)
+
+    # Truncated compressed data should fail without growing the uncompressed
+    # data up to the maximum uncompressed data size.
+    tracemalloc.start()
+    try:
+      with self.assertRaises(IOError):
+        pyfwnt.lznt1_decompress(
+            self._COMPRESSED_DATA[:4132],
+            maximum_uncompressed_data_size=0x7fffffff)
+
+      _, peak_size = tracemalloc.get_traced_memory()
+    finally:
+      tracemalloc.stop()
+
+    self.assertLess(peak_size, 1024 * 1024)
+
+  def test_lznt1_decompressor(self):
+    """Tests the lznt1_decompressor object."""
+    # Only the first 2 compressed chunks of the test data are complete.
+    compressed_data = self._COMPRESSED_DATA[:3575]
+
+    decompressor = pyfwnt.lznt1_decompressor()
+
+    uncompressed_data = b''
+    for offset in range(0, len(compressed_data), 100):
+      uncompressed_data += decompressor.decompress(
+          compressed_data[offset:offset + 100], max_length=1000)
+
+    uncompressed_data += decompressor.flush()
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    decompressor = pyfwnt.lznt1_decompressor()
+
+    uncompressed_data = decompressor.decompress(
+        memoryview(compressed_data), max_length=10)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA[:10])
+
+    uncompressed_data += decompressor.flush()
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(ValueError):
+      decompressor.decompress(compressed_data)
+
+    decompressor = pyfwnt.lznt1_decompressor()
+
+    decompressor.decompress(compressed_data[:100])
+
+    with self.assertRaises(IOError):
+      decompressor.flush()
+
+    # A single byte trailing the last complete chunk is truncated data.
+    decompressor = pyfwnt.lznt1_decompressor()
+
+    decompressor.decompress(compressed_data + b'\x01')
+
+    with self.assertRaises(IOError):
+      decompressor.flush()
+
+    # Data trailing the end of stream marker is ignored.
+    decompressor = pyfwnt.lznt1_decompressor()
+
+    uncompressed_data = decompressor.decompress(
+        compressed_data + b'\x00\x00\x01')
+
+    uncompressed_data += decompressor.flush()
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+  def test_lznt1_decompress_into(self):
+    """Tests the lznt1_decompress_into function."""
+    uncompressed_data = bytearray(7640)
+
+    uncompressed_data_size = pyfwnt.lznt1_decompress_into(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data)
+
+    self.assertEqual(uncompressed_data_size, len(self._UNCOMPRESSED_DATA))
+    self.assertEqual(
+        bytes(uncompressed_data[:uncompressed_data_size]),
+        self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(BufferError):
+      pyfwnt.lznt1_decompress_into(self._COMPRESSED_DATA, b'read-only')
+
+  def test_lznt1_decompress_many(self):
+    """Tests the lznt1_decompress_many function."""
+    compressed_data = [
+        self._COMPRESSED_DATA, bytearray(self._COMPRESSED_DATA),
+        memoryview(self._COMPRESSED_DATA)]
+
+    uncompressed_data = pyfwnt.lznt1_decompress_many(
+        compressed_data, [7640, 7640, 7640])
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 3)
+
+    uncompressed_data = pyfwnt.lznt1_decompress_many(
+        compressed_data * 4, [7640] * 12, threads=4)
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 12)
+
+    uncompressed_data = pyfwnt.lznt1_decompress_many([], [], threads=4)
+
+    self.assertEqual(uncompressed_data, [])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lznt1_decompress_many(compressed_data, [7640])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lznt1_decompress_many(
+          compressed_data, [7640, 7640, 0])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lznt1_decompress_many(
+          compressed_data, [7640] * 3, threads=0)
+
+    with self.assertRaises(IOError):
+      pyfwnt.lznt1_decompress_many(
+          [self._COMPRESSED_DATA, self._COMPRESSED_DATA], [7640, 16],
+          threads=2)
+
 
 if __name__ == "__main__":
   unittest.main(verbosity=2)
@@ -3055,6 +3055,72 @@ class LZXFunctionsTests(unittest.TestCase):
 
     self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
 
+    uncompressed_data = pyfwnt.lzx_decompress(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data_size=28672)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    uncompressed_data = pyfwnt.lzx_decompress(
+        bytearray(self._COMPRESSED_DATA), uncompressed_data_size=28672)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+  def test_lzx_decompress_with_estimated_size(self):
+    """Tests the lzx_decompress function without uncompressed data size."""
+    uncompressed_data = pyfwnt.lzx_decompress(self._COMPRESSED_DATA)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(IOError):
+      pyfwnt.lzx_decompress(
+          self._COMPRESSED_DATA, maximum_uncompressed_data_size=16)
+
+  def test_lzx_decompress_into(self):
+    """Tests the lzx_decompress_into function."""
+    uncompressed_data = bytearray(28672)
+
+    uncompressed_data_size = pyfwnt.lzx_decompress_into(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data)
+
+    self.assertEqual(uncompressed_data_size, len(self._UNCOMPRESSED_DATA))
+    self.assertEqual(
+        bytes(uncompressed_data[:uncompressed_data_size]),
+        self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(BufferError):
+      pyfwnt.lzx_decompress_into(self._COMPRESSED_DATA, b'read-only')
+
+  def test_lzx_decompress_many(self):
+    """Tests the lzx_decompress_many function."""
+    compressed_data = [
+        self._COMPRESSED_DATA, bytearray(self._COMPRESSED_DATA),
+        memoryview(self._COMPRESSED_DATA)]
+
+    uncompressed_data = pyfwnt.lzx_decompress_many(
+        compressed_data, [28672, 28672, 28672])
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 3)
+
+    uncompressed_data = pyfwnt.lzx_decompress_many(
+        compressed_data * 4, [28672] * 12, threads=4)
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 12)
+
+    uncompressed_data = pyfwnt.lzx_decompress_many([], [], threads=4)
+
+    self.assertEqual(uncompressed_data, [])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzx_decompress_many(compressed_data, [28672])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzx_decompress_many(
+          compressed_data, [28672, 28672, 0])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzx_decompress_many(
+          compressed_data, [28672] * 3, threads=0)
+
 
 if __name__ == "__main__":
   unittest.main(verbosity=2)
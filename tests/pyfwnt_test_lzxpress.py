@@ -19,11 +19,27 @@
 # You should have received a copy of the GNU Lesser General Public License
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
+import tracemalloc
 import unittest
 
 import pyfwnt
 
 
+class ClearingSize(object):
+  """Size that clears a list when it is converted to an integer."""
+
+  def __init__(self, size, list_to_clear):
+    """Initializes a size."""
+    super(ClearingSize, self).__init__()
+    self._list_to_clear = list_to_clear
+    self._size = size
+
+  def __index__(self):
+    """Converts the size to an integer."""
+    del self._list_to_clear[:]
+    return self._size
+
+
 class LZXPRESSFunctionsTests(unittest.TestCase):
   """Tests the LZXPRESS (un)compression functions."""
 
@@ -41,6 +57,99 @@ class LZXPRESSFunctionsTests(unittest.TestCase):
 
     self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
 
+    uncompressed_data = pyfwnt.lzxpress_decompress(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data_size=32)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    uncompressed_data = pyfwnt.lzxpress_decompress(
+        bytearray(self._COMPRESSED_DATA), uncompressed_data_size=32)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+  def test_lzxpress_decompress_with_estimated_size(self):
+    """Tests the lzxpress_decompress function without uncompressed data size."""
+    uncompressed_data = pyfwnt.lzxpress_decompress(self._COMPRESSED_DATA)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(IOError):
+      pyfwnt.lzxpress_decompress(
+          self._COMPRESSED_DATA, maximum_uncompressed_data_size=16)
+
+    # Truncated compressed data should fail without growing the uncompressed
+    # data up to the maximum uncompressed data size.
+    tracemalloc.start()
+    try:
+      with self.assertRaises(IOError):
+        pyfwnt.lzxpress_decompress(
+            b'\xff\xff\xff\xff\x07\x00',
+            maximum_uncompressed_data_size=0x7fffffff)
+
+      _, peak_size = tracemalloc.get_traced_memory()
+    finally:
+      tracemalloc.stop()
+
+    self.assertLess(peak_size, 1024 * 1024)
+
+  def test_lzxpress_decompress_into(self):
+    """Tests the lzxpress_decompress_into function."""
+    uncompressed_data = bytearray(32)
+
+    uncompressed_data_size = pyfwnt.lzxpress_decompress_into(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data)
+
+    self.assertEqual(uncompressed_data_size, len(self._UNCOMPRESSED_DATA))
+    self.assertEqual(
+        bytes(uncompressed_data[:uncompressed_data_size]),
+        self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(BufferError):
+      pyfwnt.lzxpress_decompress_into(self._COMPRESSED_DATA, b'read-only')
+
+  def test_lzxpress_decompress_many(self):
+    """Tests the lzxpress_decompress_many function."""
+    compressed_data = [
+        self._COMPRESSED_DATA, bytearray(self._COMPRESSED_DATA),
+        memoryview(self._COMPRESSED_DATA)]
+
+    uncompressed_data = pyfwnt.lzxpress_decompress_many(
+        compressed_data, [32, 32, 32])
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 3)
+
+    uncompressed_data = pyfwnt.lzxpress_decompress_many(
+        compressed_data * 4, [32] * 12, threads=4)
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 12)
+
+    uncompressed_data = pyfwnt.lzxpress_decompress_many([], [], threads=4)
+
+    self.assertEqual(uncompressed_data, [])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzxpress_decompress_many(compressed_data, [32])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzxpress_decompress_many(
+          compressed_data, [32, 32, 0])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzxpress_decompress_many(
+          compressed_data, [32] * 3, threads=0)
+
+    # Converting a size must not invalidate the compressed data of the caller.
+    compressed_data = [
+        bytes(bytearray(self._COMPRESSED_DATA)) for _ in range(3)]
+    uncompressed_data_sizes = [
+        ClearingSize(32, compressed_data) for _ in range(3)]
+
+    uncompressed_data = pyfwnt.lzxpress_decompress_many(
+        compressed_data, uncompressed_data_sizes)
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 3)
+    self.assertEqual(compressed_data, [])
+
 
 class LZXPRESSHuffmanFunctionsTests(unittest.TestCase):
   """Tests the LZXPRESS Huffman (un)compression functions."""
@@ -79,6 +188,63 @@ class LZXPRESSHuffmanFunctionsTests(unittest.TestCase):
 
     self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
 
+    uncompressed_data = pyfwnt.lzxpress_huffman_decompress(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data_size=26)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+    uncompressed_data = pyfwnt.lzxpress_huffman_decompress(
+        bytearray(self._COMPRESSED_DATA), uncompressed_data_size=26)
+
+    self.assertEqual(uncompressed_data, self._UNCOMPRESSED_DATA)
+
+  def test_lzxpress_huffman_decompress_into(self):
+    """Tests the lzxpress_huffman_decompress_into function."""
+    uncompressed_data = bytearray(26)
+
+    uncompressed_data_size = pyfwnt.lzxpress_huffman_decompress_into(
+        memoryview(self._COMPRESSED_DATA), uncompressed_data)
+
+    self.assertEqual(uncompressed_data_size, len(self._UNCOMPRESSED_DATA))
+    self.assertEqual(
+        bytes(uncompressed_data[:uncompressed_data_size]),
+        self._UNCOMPRESSED_DATA)
+
+    with self.assertRaises(BufferError):
+      pyfwnt.lzxpress_huffman_decompress_into(self._COMPRESSED_DATA, b'read-only')
+
+  def test_lzxpress_huffman_decompress_many(self):
+    """Tests the lzxpress_huffman_decompress_many function."""
+    compressed_data = [
+        self._COMPRESSED_DATA, bytearray(self._COMPRESSED_DATA),
+        memoryview(self._COMPRESSED_DATA)]
+
+    uncompressed_data = pyfwnt.lzxpress_huffman_decompress_many(
+        compressed_data, [26, 26, 26])
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 3)
+
+    uncompressed_data = pyfwnt.lzxpress_huffman_decompress_many(
+        compressed_data * 4, [26] * 12, threads=4)
+
+    self.assertEqual(uncompressed_data, [self._UNCOMPRESSED_DATA] * 12)
+
+    uncompressed_data = pyfwnt.lzxpress_huffman_decompress_many(
+        [], [], threads=4)
+
+    self.assertEqual(uncompressed_data, [])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzxpress_huffman_decompress_many(compressed_data, [26])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzxpress_huffman_decompress_many(
+          compressed_data, [26, 26, 0])
+
+    with self.assertRaises(ValueError):
+      pyfwnt.lzxpress_huffman_decompress_many(
+          compressed_data, [26] * 3, threads=0)
+
 
 if __name__ == "__main__":
   unittest.main(verbosity=2)
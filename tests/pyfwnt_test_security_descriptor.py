@@ -52,6 +52,26 @@ class SecurityDescriptorTypeTests(unittest.TestCase):
     with self.assertRaises(IOError):
       security_descriptor.copy_from_byte_stream(self._TEST_DATA[:16])
 
+  def test_get_revision_number(self):
+    """Tests the get_revision_number function and revision_number property."""
+    security_descriptor = pyfwnt.security_descriptor()
+    security_descriptor.copy_from_byte_stream(self._TEST_DATA)
+
+    revision_number = security_descriptor.get_revision_number()
+    self.assertEqual(revision_number, 1)
+
+    self.assertEqual(security_descriptor.revision_number, 1)
+
+  def test_get_control_flags(self):
+    """Tests the get_control_flags function and control_flags property."""
+    security_descriptor = pyfwnt.security_descriptor()
+    security_descriptor.copy_from_byte_stream(self._TEST_DATA)
+
+    control_flags = security_descriptor.get_control_flags()
+    self.assertEqual(control_flags, 0x8004)
+
+    self.assertEqual(security_descriptor.control_flags, 0x8004)
+
   def test_get_owner(self):
     """Tests the get_owner function."""
     security_descriptor = pyfwnt.security_descriptor()
@@ -90,6 +110,20 @@ class SecurityDescriptorTypeTests(unittest.TestCase):
     access_control_list = security_descriptor.get_system_acl()
     self.assertIsNone(access_control_list)
 
+  def test_get_sddl_string(self):
+    """Tests the get_sddl_string function and sddl_string property."""
+    security_descriptor = pyfwnt.security_descriptor()
+    security_descriptor.copy_from_byte_stream(self._TEST_DATA)
+
+    expected_string = (
+        'O:S-1-5-21-1757981266-484763869-1060284298-1003G:BA'
+        'D:(A;;0x12019f;;;SY)(A;;0x12019f;;;BA)')
+
+    string = security_descriptor.get_sddl_string()
+    self.assertEqual(string, expected_string)
+
+    self.assertEqual(security_descriptor.sddl_string, expected_string)
+
 
 if __name__ == "__main__":
   unittest.main(verbosity=2)
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "access_control_entry access_control_list bit_stream error huffman_tree lznt1 lzx lzxpress notify security_descriptor security_identifier support"
+$LibraryTests = "access_check_plan access_control_entry access_control_list access_token allocator arena bit_stream error huffman_tree locale_identifier lznt1 lzx lzxpress notify sddl security_descriptor security_descriptor_cache security_descriptor_view security_identifier security_identifier_pool support well_known_security_identifier"
 $LibraryTestsWithInput = ""
 $OptionSets = ""
 